@@ -0,0 +1,62 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ApparentHorizons/ExtrapolateStrahlkorperInTime.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+template <typename Frame>
+Strahlkorper<Frame> extrapolate_strahlkorper_in_time(
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    const double time) noexcept {
+  ASSERT(not previous_strahlkorpers.empty(),
+         "Need at least one Strahlkorper to extrapolate from");
+  const auto& newest_strahlkorper = previous_strahlkorpers.front().second;
+  const size_t l_max = newest_strahlkorper.l_max();
+  const size_t m_max = newest_strahlkorper.m_max();
+
+  DataVector coefs(newest_strahlkorper.coefficients().size(), 0.0);
+  for (size_t i = 0; i < previous_strahlkorpers.size(); ++i) {
+    const auto& [time_i, strahlkorper_i] = previous_strahlkorpers[i];
+    ASSERT(strahlkorper_i.center() == newest_strahlkorper.center(),
+           "Cannot extrapolate Strahlkorpers with different centers");
+    double weight = 1.0;
+    for (size_t j = 0; j < previous_strahlkorpers.size(); ++j) {
+      if (j != i) {
+        const double time_j = previous_strahlkorpers[j].first;
+        ASSERT(time_i != time_j,
+               "Cannot extrapolate from two Strahlkorpers at time " << time_i);
+        weight *= (time - time_j) / (time_i - time_j);
+      }
+    }
+    if (strahlkorper_i.l_max() == l_max and strahlkorper_i.m_max() == m_max) {
+      coefs += weight * strahlkorper_i.coefficients();
+    } else {
+      coefs += weight *
+               Strahlkorper<Frame>(l_max, m_max, strahlkorper_i).coefficients();
+    }
+  }
+  return Strahlkorper<Frame>(std::move(coefs), newest_strahlkorper);
+}
+
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                                 \
+  template Strahlkorper<FRAME(data)> extrapolate_strahlkorper_in_time(       \
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&        \
+          previous_strahlkorpers,                                            \
+      const double time) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (::Frame::Grid, ::Frame::Inertial))
+
+#undef INSTANTIATE
+#undef FRAME
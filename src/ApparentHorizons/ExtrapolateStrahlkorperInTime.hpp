@@ -0,0 +1,28 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <deque>
+#include <utility>
+
+/// \cond
+template <typename Frame>
+class Strahlkorper;
+/// \endcond
+
+/// Extrapolates the coefficients of the surfaces in
+/// `previous_strahlkorpers`, given as pairs of times and Strahlkorpers
+/// with the most recent first, to `time` using the Lagrange polynomial
+/// through all of them.  This is used to construct the initial guess
+/// for a horizon find from the horizons found at earlier times.
+///
+/// The returned Strahlkorper has the resolution and expansion center of
+/// the most recent surface; the other surfaces are prolonged or
+/// restricted to that resolution, and are assumed to have the same
+/// expansion center.
+template <typename Frame>
+Strahlkorper<Frame> extrapolate_strahlkorper_in_time(
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    double time) noexcept;
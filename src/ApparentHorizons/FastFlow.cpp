@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <optional>
 #include <pup.h>
 #include <string>
 #include <utility>
@@ -19,6 +20,7 @@
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Options/ParseOptions.hpp"
+#include "Parallel/PupStlCpp17.hpp"
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
@@ -35,7 +37,8 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
                    FastFlow::TruncationTol::type trunc_tol,
                    FastFlow::DivergenceTol::type divergence_tol,
                    FastFlow::DivergenceIter::type divergence_iter,
-                   FastFlow::MaxIts::type max_its) noexcept
+                   FastFlow::MaxIts::type max_its,
+                   std::optional<size_t> initial_l_max) noexcept
     : alpha_(alpha),
       beta_(beta),
       abs_tol_(abs_tol),
@@ -47,15 +50,25 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
       current_iter_(0),
       previous_residual_mesh_norm_(0.0),
       min_residual_mesh_norm_(std::numeric_limits<double>::max()),
-      iter_at_min_residual_mesh_norm_(0) {}
+      iter_at_min_residual_mesh_norm_(0),
+      initial_l_max_(initial_l_max),
+      iterating_at_initial_l_max_(initial_l_max_.has_value()) {}
+
+template <typename Frame>
+size_t FastFlow::current_l_surface(
+    const Strahlkorper<Frame>& strahlkorper) const noexcept {
+  const size_t l_max = strahlkorper.ylm_spherepack().l_max();
+  return iterating_at_initial_l_max_ ? std::min(*initial_l_max_, l_max)
+                                     : l_max;
+}
 
 template <typename Frame>
 size_t FastFlow::current_l_mesh(const Strahlkorper<Frame>& strahlkorper) const
     noexcept {
-  const size_t l_max = strahlkorper.ylm_spherepack().l_max();
-  // This is the formula used in SpEC (if l_max>=4). We may want to make this
-  // formula an option in the future, if we want to experiment with it.
-  return static_cast<size_t>(std::floor(1.5 * l_max));
+  const size_t l_surface = current_l_surface(strahlkorper);
+  // This is the formula used in SpEC (if l_surface>=4). We may want to make
+  // this formula an option in the future, if we want to experiment with it.
+  return static_cast<size_t>(std::floor(1.5 * l_surface));
 }
 
 namespace {
@@ -92,11 +105,24 @@ FastFlow::iterate_horizon_finder(
     const tnsr::II<DataVector, 3, Frame>& upper_spatial_metric,
     const tnsr::ii<DataVector, 3, Frame>& extrinsic_curvature,
     const tnsr::Ijj<DataVector, 3, Frame>& christoffel_2nd_kind) noexcept {
-  const size_t l_surface = current_strahlkorper->l_max();
+  const size_t l_max = current_strahlkorper->l_max();
+  const size_t l_surface = current_l_surface(*current_strahlkorper);
   const size_t l_mesh = current_l_mesh(*current_strahlkorper);
 
+  // While iterating at the initial resolution, we solve for the
+  // coefficients of the surface restricted to l_surface, and store
+  // the result prolonged back to l_max.
+  std::optional<Strahlkorper<Frame>> restricted_strahlkorper{};
+  if (l_surface < l_max) {
+    restricted_strahlkorper.emplace(l_surface, l_surface,
+                                    *current_strahlkorper);
+  }
+  const Strahlkorper<Frame>& surface = restricted_strahlkorper.has_value()
+                                           ? *restricted_strahlkorper
+                                           : *current_strahlkorper;
+
   // Evaluate the Strahlkorper on a higher resolution mesh
-  const Strahlkorper<Frame> strahlkorper(l_mesh, l_mesh, *current_strahlkorper);
+  const Strahlkorper<Frame> strahlkorper(l_mesh, l_mesh, surface);
 
   // Make a DataBox with this strahlkorper.
   // Do we want to define ComputeItems for expansion, normalized
@@ -178,15 +204,13 @@ FastFlow::iterate_horizon_finder(
   // Restrict to the basis of the surface
   const auto residual_on_surface =
       strahlkorper.ylm_spherepack().prolong_or_restrict(
-          weighted_residual_coefs, current_strahlkorper->ylm_spherepack());
+          weighted_residual_coefs, surface.ylm_spherepack());
 
   // Evaluate the norm of the residual on the surface of size l_surface.
   // See comment on pointwise norm vs integral norm above.
-  const auto residual_ylm_norm =
-      sqrt(current_strahlkorper->ylm_spherepack().average(
-          current_strahlkorper->ylm_spherepack().phys_to_spec(
-              square(current_strahlkorper->ylm_spherepack().spec_to_phys(
-                  residual_on_surface)))));
+  const auto residual_ylm_norm = sqrt(surface.ylm_spherepack().average(
+      surface.ylm_spherepack().phys_to_spec(square(
+          surface.ylm_spherepack().spec_to_phys(residual_on_surface)))));
 
   // Fill iter_info
   const auto minmax_residual =
@@ -216,9 +240,9 @@ FastFlow::iterate_horizon_finder(
   // residual_mesh_norm-previous_residual_mesh_norm_ is small on the
   // first step, since previous_residual_mesh_norm_ is not defined, so
   // we skip this part of the check on the first iteration.
+  std::optional<Status> convergence_status{};
   if (residual_ylm_norm < abs_tol_) {
-    // clang-tidy: std::move of trivially-copyable type
-    return std::make_pair(Status::AbsTol, std::move(iter_info));  // NOLINT
+    convergence_status = Status::AbsTol;
   } else if (residual_ylm_norm < trunc_tol_ * residual_mesh_norm) {
     // This may be convergence by TruncationTol, but first make sure
     // that either residual_mesh_norm is converging, or that it is the
@@ -227,10 +251,29 @@ FastFlow::iterate_horizon_finder(
     if (previous_residual_mesh_norm_ == 0 or
         equal_within_roundoff(residual_mesh_norm, previous_residual_mesh_norm_,
                               divergence_tol_ - 1.0, 0.0)) {
+      convergence_status = Status::TruncationTol;
+    }
+  }
+
+  if (convergence_status.has_value()) {
+    if (not restricted_strahlkorper.has_value()) {
       // clang-tidy: std::move of trivially-copyable type
-      return std::make_pair(Status::TruncationTol,
+      return std::make_pair(*convergence_status,
                             std::move(iter_info));  // NOLINT
     }
+    // Converged at the initial resolution, so prolong the surface to
+    // full resolution and start converging again.  The residual
+    // history at the lower resolution says nothing about the
+    // residuals at full resolution, so it is discarded.
+    iterating_at_initial_l_max_ = false;
+    ++current_iter_;
+    *current_strahlkorper = Strahlkorper<Frame>(l_max, l_max, surface);
+    previous_residual_mesh_norm_ = 0.0;
+    min_residual_mesh_norm_ = std::numeric_limits<double>::max();
+    iter_at_min_residual_mesh_norm_ = current_iter_;
+    // clang-tidy: std::move of trivially-copyable type
+    return std::make_pair(Status::SuccessfulIteration,
+                          std::move(iter_info));  // NOLINT
   }
 
   // Treat the case in which residual_mesh_norm is increasing
@@ -253,16 +296,19 @@ FastFlow::iterate_horizon_finder(
   // Gundlach, PRD 57, 863 (1998), eq. 44.
   const double flow_A = alpha_ / (l_surface * (l_surface + 1)) + beta_;
   const double flow_B = beta_ / alpha_;
-  auto coefs = current_strahlkorper->coefficients();
-  for (auto cit = SpherepackIterator(current_strahlkorper->l_max(),
-                                     current_strahlkorper->l_max());
-       cit; ++cit) {
+  auto coefs = surface.coefficients();
+  for (auto cit = SpherepackIterator(l_surface, l_surface); cit; ++cit) {
     coefs[cit()] -= flow_A /
                     (1.0 + flow_B * static_cast<double>(cit.l()) *
                                (static_cast<double>(cit.l()) + 1)) *
                     residual_on_surface[cit()];
   }
-  *current_strahlkorper = Strahlkorper<Frame>(coefs, *current_strahlkorper);
+  if (restricted_strahlkorper.has_value()) {
+    *current_strahlkorper = Strahlkorper<Frame>(
+        l_max, l_max, Strahlkorper<Frame>(std::move(coefs), surface));
+  } else {
+    *current_strahlkorper = Strahlkorper<Frame>(coefs, *current_strahlkorper);
+  }
 
   // Set up for next iter
   previous_residual_mesh_norm_ = residual_mesh_norm;
@@ -301,6 +347,8 @@ void FastFlow::pup(PUP::er& p) noexcept {
   p | previous_residual_mesh_norm_;
   p | min_residual_mesh_norm_;
   p | iter_at_min_residual_mesh_norm_;
+  p | initial_l_max_;
+  p | iterating_at_initial_l_max_;
 }
 
 std::ostream& operator<<(std::ostream& os,
@@ -338,7 +386,9 @@ bool operator==(const FastFlow& lhs, const FastFlow& rhs) noexcept {
              rhs.previous_residual_mesh_norm_ and
          lhs.min_residual_mesh_norm_ == rhs.min_residual_mesh_norm_ and
          lhs.iter_at_min_residual_mesh_norm_ ==
-             rhs.iter_at_min_residual_mesh_norm_;
+             rhs.iter_at_min_residual_mesh_norm_ and
+         lhs.initial_l_max_ == rhs.initial_l_max_ and
+         lhs.iterating_at_initial_l_max_ == rhs.iterating_at_initial_l_max_;
 }
 
 template <>
@@ -360,6 +410,8 @@ FastFlow::FlowType Options::create_from_yaml<FastFlow::FlowType>::create<void>(
 
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define INSTANTIATE(_, data)                                                \
+  template size_t FastFlow::current_l_surface(                              \
+      const Strahlkorper<FRAME(data)>& strahlkorper) const noexcept;        \
   template size_t FastFlow::current_l_mesh(                                 \
       const Strahlkorper<FRAME(data)>& strahlkorper) const noexcept;        \
   template std::pair<FastFlow::Status, FastFlow::IterInfo>                  \
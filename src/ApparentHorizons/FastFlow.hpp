@@ -5,10 +5,12 @@
 
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <ostream>
 #include <utility>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/TMPL.hpp"
@@ -116,8 +118,18 @@ class FastFlow {
     static type suggested_value() noexcept { return 100; }
   };
 
+  struct InitialLMax {
+    using type = Options::Auto<size_t, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "Iterate on the surface restricted to this L_max until converged, "
+        "then continue at full resolution, or 'None' to always iterate at "
+        "full resolution."};
+    static type suggested_value() noexcept { return {}; }
+  };
+
   using options = tmpl::list<Flow, Alpha, Beta, AbsTol, TruncationTol,
-                             DivergenceTol, DivergenceIter, MaxIts>;
+                             DivergenceTol, DivergenceIter, MaxIts,
+                             InitialLMax>;
 
   static constexpr Options::String help{
       "Find a Strahlkorper using a 'fast flow' method.\n"
@@ -138,12 +150,19 @@ class FastFlow {
       "If instead |R_{mesh}|_i > DivergenceTol * min_{j}(|R_{mesh}|_j) where\n"
       "i is the iteration index and j runs from 0 to i-DivergenceIter, then\n"
       "FastFlow exits with Status::DivergenceError.  Here DivergenceIter and\n"
-      "DivergenceTol are input parameters."};
+      "DivergenceTol are input parameters.\n\n"
+      "If InitialLMax is smaller than l_surface, the surface is first\n"
+      "restricted to InitialLMax and iterated to convergence at that\n"
+      "resolution, where each iteration is cheaper and the low-l modes that\n"
+      "dominate a poor initial guess converge quickly.  The converged\n"
+      "surface is then prolonged to l_surface and iterated to convergence\n"
+      "again. The total number of iterations is limited by MaxIts."};
 
   FastFlow(Flow::type flow, Alpha::type alpha, Beta::type beta,
            AbsTol::type abs_tol, TruncationTol::type trunc_tol,
            DivergenceTol::type divergence_tol,
-           DivergenceIter::type divergence_iter, MaxIts::type max_its) noexcept;
+           DivergenceIter::type divergence_iter, MaxIts::type max_its,
+           std::optional<size_t> initial_l_max = std::nullopt) noexcept;
 
   FastFlow() noexcept
       : FastFlow(FlowType::Fast, 1.0, 0.5, 1.e-12, 1.e-2, 1.2, 5, 100) {}
@@ -171,9 +190,17 @@ class FastFlow {
 
   size_t current_iteration() const noexcept { return current_iter_; }
 
-  /// Given a Strahlkorper defined up to some maximum Y_lm l called
-  /// l_surface, returns a larger value of l, l_mesh, that is used for
-  /// evaluating convergence.
+  /// Given a Strahlkorper, returns the maximum Y_lm l called l_surface
+  /// that the current iteration solves for. This is the `l_max` of the
+  /// Strahlkorper, unless the finder is still iterating at the
+  /// resolution given by the `InitialLMax` option.
+  template <typename Frame>
+  size_t current_l_surface(const Strahlkorper<Frame>& strahlkorper) const
+      noexcept;
+
+  /// Given a Strahlkorper defined up to some maximum Y_lm l,
+  /// returns a value of l, l_mesh, larger than `current_l_surface()`,
+  /// that is used for evaluating convergence.
   template <typename Frame>
   size_t current_l_mesh(const Strahlkorper<Frame>& strahlkorper) const noexcept;
 
@@ -183,6 +210,7 @@ class FastFlow {
     previous_residual_mesh_norm_ = 0.0;
     min_residual_mesh_norm_ = std::numeric_limits<double>::max();
     iter_at_min_residual_mesh_norm_ = 0;
+    iterating_at_initial_l_max_ = initial_l_max_.has_value();
   }
 
  private:
@@ -194,6 +222,8 @@ class FastFlow {
   size_t current_iter_;
   double previous_residual_mesh_norm_, min_residual_mesh_norm_;
   size_t iter_at_min_residual_mesh_norm_;
+  std::optional<size_t> initial_l_max_;
+  bool iterating_at_initial_l_max_;
 };
 
 SPECTRE_ALWAYS_INLINE bool converged(const FastFlow::Status& status) noexcept {
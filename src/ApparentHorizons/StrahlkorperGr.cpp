@@ -87,36 +87,60 @@ tnsr::I<DataVector, 2, Frame::Spherical<Fr>> get_trace_christoffel_second_kind(
   // reimplement this code to avoid dividing by sin(theta).
   //
   // Note: YlmSpherepack gradients are flat-space Pfaffian derivatives.
-  auto grad_surface_metric_theta_theta =
-      ylm.gradient(square(get(sin_theta)) * get<0, 0>(surface_metric));
-  get<0>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<1>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
-  get<0>(grad_surface_metric_theta_theta) -=
+  //
+  // All three fields are differentiated in a single batched transform,
+  // so they are stored one after another and accessed through
+  // non-owning views.
+  const size_t num_points = get(sin_theta).size();
+  const auto field = [num_points](DataVector& fields,
+                                  const size_t index) noexcept {
+    // clang-tidy: 'do not use pointer arithmetic'
+    return DataVector(fields.data() + index * num_points,  // NOLINT
+                      num_points);
+  };
+  DataVector fields_to_differentiate(3 * num_points);
+  DataVector sin_theta_squared_surface_metric_theta_theta =
+      field(fields_to_differentiate, 0);
+  DataVector sin_theta_surface_metric_theta_phi =
+      field(fields_to_differentiate, 1);
+  DataVector surface_metric_phi_phi = field(fields_to_differentiate, 2);
+  sin_theta_squared_surface_metric_theta_theta =
+      square(get(sin_theta)) * get<0, 0>(surface_metric);
+  sin_theta_surface_metric_theta_phi =
+      get(sin_theta) * get<0, 1>(surface_metric);
+  surface_metric_phi_phi = get<1, 1>(surface_metric);
+  auto gradients = ylm.gradient_batch(fields_to_differentiate, 3);
+
+  DataVector grad_surface_metric_theta_theta_0 = field(get<0>(gradients), 0);
+  DataVector grad_surface_metric_theta_theta_1 = field(get<1>(gradients), 0);
+  grad_surface_metric_theta_theta_0 /= square(get(sin_theta));
+  grad_surface_metric_theta_theta_1 /= square(get(sin_theta));
+  grad_surface_metric_theta_theta_0 -=
       2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_theta_phi =
-      ylm.gradient(get(sin_theta) * get<0, 1>(surface_metric));
-
-  get<0>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<1>(grad_surface_metric_theta_phi) /= get(sin_theta);
-  get<0>(grad_surface_metric_theta_phi) -=
+  DataVector grad_surface_metric_theta_phi_0 = field(get<0>(gradients), 1);
+  DataVector grad_surface_metric_theta_phi_1 = field(get<1>(gradients), 1);
+  grad_surface_metric_theta_phi_0 /= get(sin_theta);
+  grad_surface_metric_theta_phi_1 /= get(sin_theta);
+  grad_surface_metric_theta_phi_0 -=
       get<0, 1>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_phi_phi = ylm.gradient(get<1, 1>(surface_metric));
+  const DataVector grad_surface_metric_phi_phi_0 = field(get<0>(gradients), 2);
+  const DataVector grad_surface_metric_phi_phi_1 = field(get<1>(gradients), 2);
 
   auto deriv_surface_metric =
       make_with_value<tnsr::ijj<DataVector, 2, Frame::Spherical<Fr>>>(
           get<0, 0>(surface_metric), 0.0);
   // Get the partial derivative of the metric from the Pfaffian derivative
-  get<0, 0, 0>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_theta);
+  get<0, 0, 0>(deriv_surface_metric) = grad_surface_metric_theta_theta_0;
   get<1, 0, 0>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_theta);
-  get<0, 0, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_theta_phi);
+      get(sin_theta) * grad_surface_metric_theta_theta_1;
+  get<0, 0, 1>(deriv_surface_metric) = grad_surface_metric_theta_phi_0;
   get<1, 0, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_theta_phi);
-  get<0, 1, 1>(deriv_surface_metric) = get<0>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_theta_phi_1;
+  get<0, 1, 1>(deriv_surface_metric) = grad_surface_metric_phi_phi_0;
   get<1, 1, 1>(deriv_surface_metric) =
-      get(sin_theta) * get<1>(grad_surface_metric_phi_phi);
+      get(sin_theta) * grad_surface_metric_phi_phi_1;
 
   return trace_last_indices(
       raise_or_lower_first_index(
@@ -676,10 +700,16 @@ void spin_function(
     component = 0.0;
   }
 
-  auto extrinsic_curvature_theta_normal_sin_theta =
-      make_with_value<Scalar<DataVector>>(area_element, 0.0);
-  auto extrinsic_curvature_phi_normal =
-      make_with_value<Scalar<DataVector>>(area_element, 0.0);
+  // Both terms are differentiated in a single batched transform, so
+  // they are stored one after another and accessed through non-owning
+  // views.
+  const size_t num_points = get(area_element).size();
+  DataVector fields_to_differentiate(2 * num_points, 0.0);
+  DataVector extrinsic_curvature_phi_normal(fields_to_differentiate.data(),
+                                            num_points);
+  // clang-tidy: 'do not use pointer arithmetic'
+  DataVector extrinsic_curvature_theta_normal_sin_theta(
+      fields_to_differentiate.data() + num_points, num_points);  // NOLINT
 
   // using result as temporary
   DataVector& extrinsic_curvature_dot_normal = get(*result);
@@ -696,28 +726,30 @@ void spin_function(
     // the spherepack gradient, which includes a
     // sin_theta in the denominator of the phi derivative.
     // Will do this outside the i,j loops.
-    get(extrinsic_curvature_theta_normal_sin_theta) +=
+    extrinsic_curvature_theta_normal_sin_theta +=
         extrinsic_curvature_dot_normal * tangents.get(i, 0);
 
     // Note: I must multiply by sin_theta because tangents.get(i,1)
     // actually contains \partial_\phi / sin(theta), but I want just
     //\partial_\phi. Will do this outside the i,j loops.
-    get(extrinsic_curvature_phi_normal) +=
+    extrinsic_curvature_phi_normal +=
         extrinsic_curvature_dot_normal * tangents.get(i, 1);
   }
 
   // using result as temporary
   DataVector& sin_theta = get(*result);
   sin_theta = sin(strahlkorper.ylm_spherepack().theta_phi_points()[0]);
-  get(extrinsic_curvature_theta_normal_sin_theta) *= sin_theta;
-  get(extrinsic_curvature_phi_normal) *= sin_theta;
+  extrinsic_curvature_theta_normal_sin_theta *= sin_theta;
+  extrinsic_curvature_phi_normal *= sin_theta;
 
   // now computing actual result
-  get(*result) = (get<0>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_phi_normal))) -
-                  get<1>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_theta_normal_sin_theta)))) /
-                 (sin_theta * get(area_element));
+  const auto gradients =
+      strahlkorper.ylm_spherepack().gradient_batch(fields_to_differentiate, 2);
+  for (size_t s = 0; s < num_points; ++s) {
+    get(*result)[s] = (get<0>(gradients)[s] -
+                       get<1>(gradients)[s + num_points]) /
+                      (sin_theta[s] * get(area_element)[s]);
+  }
 }
 
 template <typename Frame>
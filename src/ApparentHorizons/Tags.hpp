@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <deque>
 #include <string>
+#include <utility>
 
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/StrahlkorperGr.hpp"
@@ -29,12 +31,13 @@ namespace ah::Tags {
 struct FastFlow : db::SimpleTag {
   using type = ::FastFlow;
 };
-/// Tag for holding the previously-found value of a Strahlkorper,
-/// which is saved for extrapolation for future initial guesses
-/// and for recovering the initial guess on failure of the algorithm.
+/// Tag for holding the most recently found values of a Strahlkorper
+/// and the times at which they were found, most recent first.  These are
+/// saved for extrapolating initial guesses in time for future horizon
+/// finds, and for recovering the initial guess on failure of the algorithm.
 template <typename Frame>
-struct PreviousStrahlkorper : db::SimpleTag {
-  using type = ::Strahlkorper<Frame>;
+struct PreviousStrahlkorpers : db::SimpleTag {
+  using type = std::deque<std::pair<double, ::Strahlkorper<Frame>>>;
 };
 }  // namespace ah::Tags
 
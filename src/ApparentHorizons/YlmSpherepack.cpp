@@ -13,6 +13,7 @@
 #include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Transpose.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -59,7 +60,7 @@ YlmSpherepack::YlmSpherepack(const size_t l_max, const size_t m_max) noexcept
   if (m_max_ < 2) {
     ERROR("Must use m_max>=2, not m_max=" << m_max_);
   }
-  fill_scalar_work_arrays();
+  storage_ = YlmSpherepack_detail::cached_storage(l_max_, m_max_);
 }
 
 void YlmSpherepack::phys_to_spec_impl(
@@ -83,7 +84,7 @@ void YlmSpherepack::phys_to_spec_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  auto& work_phys_to_spec = storage_.work_phys_to_spec;
+  const auto& work_phys_to_spec = storage_->work_phys_to_spec;
   shags_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -122,7 +123,7 @@ void YlmSpherepack::spec_to_phys_impl(
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
 
-  auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   shsgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
          effective_physical_offset, effective_spectral_offset,
          static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -218,9 +219,6 @@ void YlmSpherepack::gradient_from_coefs_impl(
          "physical and spectral strides must be equal "
          "for loop_over_offset=true");
 
-  if (storage_.work_vector_spec_to_phys.empty()) {
-    fill_vector_work_arrays();
-  }
   const size_t l1 = m_max_ + 1;
   const double* const f_k = spectral_coefs;
   const double* const a = f_k;
@@ -237,7 +235,7 @@ void YlmSpherepack::gradient_from_coefs_impl(
       loop_over_offset ? -1 : int(physical_offset);
   const int effective_spectral_offset =
       loop_over_offset ? -1 : int(spectral_offset);
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
+  const auto& work_vector_spec_to_phys = storage_->work_vector_spec_to_phys;
   gradgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           effective_physical_offset, effective_spectral_offset,
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1, df[0],
@@ -304,6 +302,120 @@ YlmSpherepack::FirstDeriv YlmSpherepack::gradient_from_coefs_all_offsets(
   return result;
 }
 
+// The batched functions interleave the fields so that SPHEREPACK can
+// treat them as the 'radial' points of an I1 x S2 array and transform
+// them all in one pass.
+void YlmSpherepack::phys_to_spec_batch(
+    const gsl::not_null<double*> spectral_coefs,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    phys_to_spec_impl(spectral_coefs, collocation_values, 1, 0, 1, 0, false);
+    return;
+  }
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(spectral_coefs, interleaved_coefs.data(), number_of_fields,
+                spectral_size());
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void YlmSpherepack::spec_to_phys_batch(
+    const gsl::not_null<double*> collocation_values,
+    const gsl::not_null<const double*> spectral_coefs,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    spec_to_phys_impl(collocation_values, spectral_coefs, 1, 0, 1, 0, false);
+    return;
+  }
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  raw_transpose(make_not_null(interleaved_coefs.data()), spectral_coefs.get(),
+                spectral_size(), number_of_fields);
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(collocation_values, interleaved_values.data(),
+                number_of_fields, physical_size());
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
+void YlmSpherepack::gradient_batch(
+    const std::array<double*, 2>& df,
+    const gsl::not_null<const double*> collocation_values,
+    const size_t number_of_fields) const noexcept {
+  if (number_of_fields == 1) {
+    gradient(df, collocation_values);
+    return;
+  }
+  auto& interleaved_values =
+      memory_pool_.get(number_of_fields * physical_size());
+  auto& interleaved_coefs =
+      memory_pool_.get(number_of_fields * spectral_size());
+  auto& interleaved_dphi = memory_pool_.get(number_of_fields * physical_size());
+  raw_transpose(make_not_null(interleaved_values.data()),
+                collocation_values.get(), physical_size(), number_of_fields);
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    number_of_fields, 0, number_of_fields, 0, true);
+  // The interleaved collocation values are no longer needed, so their
+  // storage holds the theta derivative.
+  const std::array<double*, 2> interleaved_df{
+      {interleaved_values.data(), interleaved_dphi.data()}};
+  gradient_from_coefs_impl(interleaved_df, interleaved_coefs.data(),
+                           number_of_fields, 0, number_of_fields, 0, true);
+  raw_transpose(make_not_null(df[0]), interleaved_values.data(),
+                number_of_fields, physical_size());
+  raw_transpose(make_not_null(df[1]), interleaved_dphi.data(),
+                number_of_fields, physical_size());
+  memory_pool_.free(interleaved_dphi);
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+DataVector YlmSpherepack::phys_to_spec_batch(
+    const DataVector& collocation_values,
+    const size_t number_of_fields) const noexcept {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  DataVector result(spectral_size() * number_of_fields);
+  phys_to_spec_batch(result.data(), collocation_values.data(),
+                     number_of_fields);
+  return result;
+}
+
+DataVector YlmSpherepack::spec_to_phys_batch(
+    const DataVector& spectral_coefs,
+    const size_t number_of_fields) const noexcept {
+  ASSERT(spectral_coefs.size() == spectral_size() * number_of_fields,
+         "Sizes don't match: " << spectral_coefs.size() << " vs "
+                               << spectral_size() * number_of_fields);
+  DataVector result(physical_size() * number_of_fields);
+  spec_to_phys_batch(result.data(), spectral_coefs.data(), number_of_fields);
+  return result;
+}
+
+YlmSpherepack::FirstDeriv YlmSpherepack::gradient_batch(
+    const DataVector& collocation_values,
+    const size_t number_of_fields) const noexcept {
+  ASSERT(collocation_values.size() == physical_size() * number_of_fields,
+         "Sizes don't match: " << collocation_values.size() << " vs "
+                               << physical_size() * number_of_fields);
+  FirstDeriv result(physical_size() * number_of_fields);
+  gradient_batch({{result.get(0).data(), result.get(1).data()}},
+                 collocation_values.data(), number_of_fields);
+  return result;
+}
+
 void YlmSpherepack::scalar_laplacian(
     const gsl::not_null<double*> scalar_laplacian,
     const gsl::not_null<const double*> collocation_values,
@@ -328,7 +440,7 @@ void YlmSpherepack::scalar_laplacian_from_coefs(
   const size_t work_size = n_theta_ * (3 * n_phi_ + 2 * l1 + 1);
   auto& work = memory_pool_.get(work_size);
   int err = 0;
-  auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
+  const auto& work_scalar_spec_to_phys = storage_->work_scalar_spec_to_phys;
   slapgs_(static_cast<int>(physical_stride), static_cast<int>(spectral_stride),
           static_cast<int>(physical_offset), static_cast<int>(spectral_offset),
           static_cast<int>(n_theta_), static_cast<int>(n_phi_), 0, 1,
@@ -382,69 +494,23 @@ std::array<DataVector, 2> YlmSpherepack::theta_phi_points() const noexcept {
 }
 
 const std::vector<double>& YlmSpherepack::theta_points() const noexcept {
-  auto& theta = storage_.theta;
-  if (theta.empty()) {
-    theta.resize(n_theta_);
-    auto& work = memory_pool_.get(n_theta_ + 1);
-    auto& unused_weights = memory_pool_.get(n_theta_);
-    int err = 0;
-    gaqd_(static_cast<int>(n_theta_), theta.data(), unused_weights.data(),
-          work.data(), static_cast<int>(n_theta_ + 1), &err);
-    memory_pool_.free(unused_weights);
-    memory_pool_.free(work);
-    if (UNLIKELY(err != 0)) {
-      ERROR("gaqd error " << err << " in YlmSpherepack");
-    }
-  }
-  return theta;
+  return storage_->theta;
 }
 
 const std::vector<double>& YlmSpherepack::phi_points() const noexcept {
-  // The following is not static or constexpr because n_phi_ depends
-  // on *this.
-  const double two_pi_over_n_phi = 2.0 * M_PI / n_phi_;
-  auto& phi = storage_.phi;
-  if (phi.empty()) {
-    phi.resize(n_phi_);
-    for (size_t i = 0; i < n_phi_; ++i) {
-      phi[i] = two_pi_over_n_phi * i;
-    }
-  }
-  return phi;
+  return storage_->phi;
 }
 
 void YlmSpherepack::second_derivative(
     const std::array<double*, 2>& df, const gsl::not_null<SecondDeriv*> ddf,
     const gsl::not_null<const double*> collocation_values,
     const size_t physical_stride, const size_t physical_offset) const noexcept {
-  // Initialize trig functions at collocation points
-  auto& cos_theta = storage_.cos_theta;
-  auto& sin_theta = storage_.sin_theta;
-  auto& sin_phi = storage_.sin_phi;
-  auto& cos_phi = storage_.cos_phi;
-  auto& cot_theta = storage_.cot_theta;
-  auto& cosec_theta = storage_.cosec_theta;
-  if (cos_theta.empty()) {
-    cos_theta.resize(n_theta_);
-    sin_theta.resize(n_theta_);
-    cosec_theta.resize(n_theta_);
-    cot_theta.resize(n_theta_);
-    cos_phi.resize(n_phi_);
-    sin_phi.resize(n_phi_);
-
-    const std::vector<double>& theta = theta_points();
-    for (size_t i = 0; i < n_theta_; ++i) {
-      cos_theta[i] = cos(theta[i]);
-      sin_theta[i] = sin(theta[i]);
-      cosec_theta[i] = 1.0 / sin_theta[i];
-      cot_theta[i] = cos_theta[i] * cosec_theta[i];
-    }
-    const std::vector<double>& phi = phi_points();
-    for (size_t i = 0; i < n_phi_; ++i) {
-      cos_phi[i] = cos(phi[i]);
-      sin_phi[i] = sin(phi[i]);
-    }
-  }
+  const auto& cos_theta = storage_->cos_theta;
+  const auto& sin_theta = storage_->sin_theta;
+  const auto& sin_phi = storage_->sin_phi;
+  const auto& cos_phi = storage_->cos_phi;
+  const auto& cot_theta = storage_->cot_theta;
+  const auto& cosec_theta = storage_->cosec_theta;
   // Get first derivatives
   gradient(df, collocation_values, physical_stride, physical_offset);
 
@@ -613,76 +679,16 @@ YlmSpherepack::InterpolationInfo<T> YlmSpherepack::set_up_interpolation_info(
   // beta(l+1,x) [NOT beta(l,x)] in 'beta'.  We will also compute and
   // store the x-independent piece of Pbar(m)(m) in 'pmm' and we
   // will compute and store the x-independent piece of Pbar(m+1)(m)/Pbar(m)(m)
-  // in a component of 'alpha'. See below for storage.
+  // in a component of 'alpha'.
   // Note Pbar(m)(m)   is (2m-1)!! (1-x^2)^(n/2) sqrt((2m+1)/(2 (2m)!))
   // and  Pbar(m+1)(m) is (2m+1)!! x(1-x^2)^(n/2)sqrt((2m+3)/(2(2m+1)!))
   //  Ratio Pbar(m+1)(m)/Pbar(m)(m)   = x sqrt(2m+3)
   //  Ratio Pbar(m+1)(m+1)/Pbar(m)(m) = sqrt(1-x^2) sqrt((2m+3)/(2m+2))
-
-  const size_t l1 = m_max_ + 1;
-
-  auto& alpha = storage_.work_interp_alpha;
-  auto& beta = storage_.work_interp_beta;
-  auto& pmm = storage_.work_interp_pmm;
-  auto& index = storage_.work_interp_index;
-  if (alpha.empty()) {
-    // We need to compute alpha, beta, index, and pmm only once.
-    const size_t array_size = n_theta_ * l1 - l1 * (l1 - 1) / 2;
-    index.resize(array_size);
-    alpha.resize(array_size);
-    beta.resize(array_size);
-    pmm.resize(l1);
-
-    // Fill alpha,beta,index arrays in the same order as the Clenshaw
-    // recurrence, so that we can index them easier during the recurrence.
-    // First do m=0.
-    size_t idx = 0;
-    for (size_t n = n_theta_ - 1; n > 0; --n, ++idx) {
-      const auto n_dbl = static_cast<double>(n);
-      const double tnp1 = 2.0 * n_dbl + 1;
-      const double np1sq = n_dbl * n_dbl + 2.0 * n_dbl + 1.0;
-      alpha[idx] = sqrt(tnp1 * (tnp1 + 2.0) / np1sq);
-      beta[idx] = -sqrt((tnp1 + 4.0) / tnp1 * np1sq / (np1sq + 2 * n_dbl + 3));
-      index[idx] = n_dbl * l1;
-    }
-    // The next value of beta stores beta(n=1,m=0).
-    // The next value of alpha stores Pbar(n=1,m=0)/(x*Pbar(n=0,m=0)).
-    // These two values are needed for the final Clenshaw recurrence formula.
-    beta[idx] = -0.5 * sqrt(5.0);
-    alpha[idx] = sqrt(3.0);
-    index[idx] = 0;  // Index of coef in the final recurrence formula
-    ++idx;
-
-    // Now do other m.
-    for (size_t m = 1; m < l1; ++m) {
-      for (size_t n = n_theta_ - 1; n > m; --n, ++idx) {
-        const double tnp1 = 2.0 * n + 1;
-        const double np1sqmmsq = (n + 1.0 + m) * (n + 1.0 - m);
-        alpha[idx] = sqrt(tnp1 * (tnp1 + 2.0) / np1sqmmsq);
-        beta[idx] =
-            -sqrt((tnp1 + 4.0) / tnp1 * np1sqmmsq / (np1sqmmsq + 2. * n + 3.));
-        index[idx] = m + n * l1;
-      }
-      // The next value of beta stores beta(n=m+1,m).
-      // The next value of alpha stores Pbar(n=m+1,m)/(x*Pbar(n=m,m)).
-      // These two values are needed for the final Clenshaw recurrence formula.
-      beta[idx] = -0.5 * sqrt((2.0 * m + 5) / (m + 1.0));
-      alpha[idx] = sqrt(2.0 * m + 3);
-      index[idx] =
-          m + m * l1;  // Index of coef in the final recurrence formula.
-      ++idx;
-    }
-    ASSERT(idx == index.size(),
-           "Wrong size " << idx << ", expected " << index.size());
-
-    // Now do pmm, which stores Pbar(m,m).
-    pmm[0] = M_SQRT1_2;  // 1/sqrt(2) = Pbar(0)(0)
-    for (size_t m = 1; m < l1; ++m) {
-      pmm[m] = pmm[m - 1] * sqrt((2.0 * m + 1.0) / (2.0 * m));
-    }
-  }
-
-  return InterpolationInfo(m_max_, pmm, target_points);
+  //
+  // alpha, beta, index, and pmm do not depend on the target points, so
+  // they are computed once per resolution in YlmSpherepack_detail::Storage.
+  return InterpolationInfo(m_max_, storage_->work_interp_pmm,
+                           target_points);
 }
 
 template <typename T>
@@ -706,9 +712,9 @@ void YlmSpherepack::interpolate_from_coefs(
     const gsl::not_null<T*> result, const R& spectral_coefs,
     const InterpolationInfo<T>& interpolation_info,
     const size_t spectral_stride, const size_t spectral_offset) const noexcept {
-  const auto& alpha = storage_.work_interp_alpha;
-  const auto& beta = storage_.work_interp_beta;
-  const auto& index = storage_.work_interp_index;
+  const auto& alpha = storage_->work_interp_alpha;
+  const auto& beta = storage_->work_interp_beta;
+  const auto& index = storage_->work_interp_index;
   // alpha holds alpha(n,m,x)/x, beta holds beta(n+1,m).
   // index holds the index into the coefficient array.
   // All are indexed together.
@@ -815,101 +821,6 @@ T YlmSpherepack::interpolate_from_coefs(
   return result;
 }
 
-void YlmSpherepack::fill_vector_work_arrays() const noexcept {
-  const size_t l2 = (n_theta_ + 1) / 2;
-  auto& work_vector_spec_to_phys = storage_.work_vector_spec_to_phys;
-
-  // Allocate memory for vector work arrays
-  // Throughout this file, the l1, mdb, mdc values
-  // are set to min(n_theta_, (n_phi_+2)/2)), which is consistent
-  // with l1 and mdab for scalars.  This is generally
-  // larger than what is required by Spherepack
-  // for vectors: min(n_theta_, (n_phi_+1)/2)).
-  const size_t l_vhsgs =
-      n_theta_ * l2 * (n_theta_ + 1) + n_phi_ + 15 + 2 * n_theta_;
-  work_vector_spec_to_phys.assign(l_vhsgs, 0.0);
-
-  // Initialize vector work arrays
-  const size_t ldwg = (3 * n_theta_ * (n_theta_ + 3) + 2) / 2;
-  auto& dworkg = memory_pool_.get(ldwg);
-  int err = 0;
-  vhsgsi_(static_cast<int>(n_theta_), static_cast<int>(n_phi_),
-          work_vector_spec_to_phys.data(), static_cast<int>(l_vhsgs),
-          dworkg.data(), static_cast<int>(ldwg), &err);
-  if (UNLIKELY(err != 0)) {
-    ERROR("vhsgsi error " << err << " in YlmSpherepack");
-  }
-  memory_pool_.free(dworkg);
-}
-
-void YlmSpherepack::fill_scalar_work_arrays() const noexcept {
-  auto& work_phys_to_spec = storage_.work_phys_to_spec;
-  auto& work_scalar_spec_to_phys = storage_.work_scalar_spec_to_phys;
-  auto& quadrature_weights = storage_.quadrature_weights;
-
-  {
-    auto& weights = memory_pool_.get(n_theta_);
-    auto& work0 = memory_pool_.get(n_theta_);
-    auto& work1 = memory_pool_.get(n_theta_ + 1);
-    int err = 0;
-    gaqd_(static_cast<int>(n_theta_), work0.data(), weights.data(),
-          work1.data(), static_cast<int>(n_theta_ + 1), &err);
-    memory_pool_.free(work0);
-    memory_pool_.free(work1);
-    if (UNLIKELY(err != 0)) {
-      ERROR("gaqd error " << err << " in YlmSpherepack");
-    }
-
-    quadrature_weights.assign(n_theta_ * n_phi_, 2 * M_PI / n_phi_);
-    for (size_t i = 0; i < n_theta_; ++i) {
-      for (size_t j = 0; j < n_phi_; ++j) {
-        quadrature_weights[i + j * n_theta_] *= weights[i];
-      }
-    }
-    memory_pool_.free(weights);
-  }
-
-  // Allocate memory for scalar work arrays.
-
-  // Below note that l1, l2, and ylm_work_size are ints, not size_ts, and
-  // note the use of n_phi and n_theta.  The reason for this: The last
-  // term in the expression for ylm_work_size can sometimes be negative.  If
-  // evaluated using unsigned ints instead of ints, then this will
-  // underflow and give a huge number.
-  const auto l1 = static_cast<int>(m_max_ + 1);
-  const auto l2 = static_cast<int>(n_theta_ + 1) / 2;
-  const auto n_phi = static_cast<int>(n_phi_);
-  const auto n_theta = static_cast<int>(n_theta_);
-  const int ylm_work_size = n_phi + 15 + n_theta * (3 * (l1 + l2) - 2) +
-                            (l1 - 1) * (l2 * (2 * n_theta - l1) - 3 * l1) / 2;
-  ASSERT(ylm_work_size >= 0, "Bad size " << ylm_work_size);
-  const auto l_ylm = static_cast<size_t>(ylm_work_size);
-
-  work_phys_to_spec.assign(l_ylm, 0.0);
-  work_scalar_spec_to_phys.assign(l_ylm, 0.0);
-
-  // Initialize scalar work arrays
-  const size_t work_size = 4 * n_theta_ * (n_theta_ + 2) + 2;
-  auto& work = memory_pool_.get(work_size);
-  const size_t deriv_work_size = n_theta_ * (n_theta_ + 4);
-  auto& deriv_work = memory_pool_.get(deriv_work_size);
-  int err = 0;
-  shagsi_(n_theta, n_phi, work_phys_to_spec.data(), ylm_work_size, work.data(),
-          static_cast<int>(work_size), deriv_work.data(),
-          static_cast<int>(deriv_work_size), &err);
-  if (UNLIKELY(err != 0)) {
-    ERROR("shagsi error " << err << " in YlmSpherepack");
-  }
-  shsgsi_(n_theta, n_phi, work_scalar_spec_to_phys.data(), ylm_work_size,
-          work.data(), static_cast<int>(work_size), deriv_work.data(),
-          static_cast<int>(deriv_work_size), &err);
-  if (UNLIKELY(err != 0)) {
-    ERROR("shsgsi error " << err << " in YlmSpherepack");
-  }
-  memory_pool_.free(deriv_work);
-  memory_pool_.free(work);
-}
-
 DataVector YlmSpherepack::prolong_or_restrict(
     const DataVector& spectral_coefs,
     const YlmSpherepack& target) const noexcept {
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -276,6 +277,36 @@ class YlmSpherepack {
                                              size_t stride = 1) const noexcept;
   /// @}
 
+  /// @{
+  /// Spectral transformations and gradient of `number_of_fields`
+  /// independent functions at once.  The fields are stored one after
+  /// another, i.e. field `k` starts at `k * physical_size()` in
+  /// `collocation_values` and `df` and at `k * spectral_size()` in
+  /// `spectral_coefs`.  All fields are transformed in a single
+  /// SPHEREPACK pass, so the Legendre functions are traversed once
+  /// instead of once per field.
+  void phys_to_spec_batch(gsl::not_null<double*> spectral_coefs,
+                          gsl::not_null<const double*> collocation_values,
+                          size_t number_of_fields) const noexcept;
+  void spec_to_phys_batch(gsl::not_null<double*> collocation_values,
+                          gsl::not_null<const double*> spectral_coefs,
+                          size_t number_of_fields) const noexcept;
+  void gradient_batch(const std::array<double*, 2>& df,
+                      gsl::not_null<const double*> collocation_values,
+                      size_t number_of_fields) const noexcept;
+  /// @}
+
+  /// @{
+  /// Simpler interfaces to the batched functions above.  The input and
+  /// the result hold the fields one after another.
+  DataVector phys_to_spec_batch(const DataVector& collocation_values,
+                                size_t number_of_fields) const noexcept;
+  DataVector spec_to_phys_batch(const DataVector& spectral_coefs,
+                                size_t number_of_fields) const noexcept;
+  FirstDeriv gradient_batch(const DataVector& collocation_values,
+                            size_t number_of_fields) const noexcept;
+  /// @}
+
   /// Computes Laplacian in physical space.
   /// To act on a slice of the input and output arrays, specify stride
   /// and offset (assumed to be the same for input and output).
@@ -330,7 +361,7 @@ class YlmSpherepack {
       gsl::not_null<const double*> collocation_values,
       size_t physical_stride = 1, size_t physical_offset = 0) const noexcept {
     // clang-tidy: 'do not use pointer arithmetic'
-    return ddot_(n_theta_ * n_phi_, storage_.quadrature_weights.data(), 1,
+    return ddot_(n_theta_ * n_phi_, storage_->quadrature_weights.data(), 1,
                  collocation_values.get() + physical_offset,  // NOLINT
                  physical_stride);
   }
@@ -340,7 +371,7 @@ class YlmSpherepack {
   /// at point i.
   SPECTRE_ALWAYS_INLINE const std::vector<double>& integration_weights()
       const noexcept {
-    return storage_.quadrature_weights;
+    return storage_->quadrature_weights;
   }
 
   /// Adds a constant (i.e. \f$f(\theta,\phi)\f$ += \f$c\f$) to the function
@@ -437,12 +468,11 @@ class YlmSpherepack {
                                 size_t physical_stride = 1,
                                 size_t physical_offset = 0,
                                 bool loop_over_offset = false) const noexcept;
-  void fill_scalar_work_arrays() const noexcept;
-  void fill_vector_work_arrays() const noexcept;
   size_t l_max_, m_max_, n_theta_, n_phi_;
   size_t spectral_size_;
   mutable YlmSpherepack_detail::MemoryPool memory_pool_;
-  mutable YlmSpherepack_detail::Storage storage_;
+  // Shared by all YlmSpherepacks with the same l_max and m_max.
+  std::shared_ptr<const YlmSpherepack_detail::Storage> storage_;
 };  // class YlmSpherepack
 
 bool operator==(const YlmSpherepack& lhs, const YlmSpherepack& rhs) noexcept;
@@ -1,13 +1,202 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <cmath>
 #include <ostream>
+#include <utility>
 
 #include "ApparentHorizons/YlmSpherepackHelper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Spherepack.hpp"
+#include "Utilities/StaticCache.hpp"
 
 namespace YlmSpherepack_detail {
 
+Storage::Storage(const size_t l_max, const size_t m_max) noexcept {
+  const size_t n_theta = l_max + 1;
+  const size_t n_phi = 2 * m_max + 1;
+
+  // Collocation points and quadrature weights.
+  {
+    theta.resize(n_theta);
+    std::vector<double> weights(n_theta);
+    std::vector<double> work(n_theta + 1);
+    int err = 0;
+    gaqd_(static_cast<int>(n_theta), theta.data(), weights.data(),
+          work.data(), static_cast<int>(n_theta + 1), &err);
+    if (UNLIKELY(err != 0)) {
+      ERROR("gaqd error " << err << " in YlmSpherepack");
+    }
+
+    quadrature_weights.assign(n_theta * n_phi, 2 * M_PI / n_phi);
+    for (size_t i = 0; i < n_theta; ++i) {
+      for (size_t j = 0; j < n_phi; ++j) {
+        quadrature_weights[i + j * n_theta] *= weights[i];
+      }
+    }
+
+    const double two_pi_over_n_phi = 2.0 * M_PI / n_phi;
+    phi.resize(n_phi);
+    for (size_t i = 0; i < n_phi; ++i) {
+      phi[i] = two_pi_over_n_phi * i;
+    }
+  }
+
+  // Trig functions at collocation points
+  cos_theta.resize(n_theta);
+  sin_theta.resize(n_theta);
+  cosec_theta.resize(n_theta);
+  cot_theta.resize(n_theta);
+  for (size_t i = 0; i < n_theta; ++i) {
+    cos_theta[i] = cos(theta[i]);
+    sin_theta[i] = sin(theta[i]);
+    cosec_theta[i] = 1.0 / sin_theta[i];
+    cot_theta[i] = cos_theta[i] * cosec_theta[i];
+  }
+  cos_phi.resize(n_phi);
+  sin_phi.resize(n_phi);
+  for (size_t i = 0; i < n_phi; ++i) {
+    cos_phi[i] = cos(phi[i]);
+    sin_phi[i] = sin(phi[i]);
+  }
+
+  // Scalar work arrays.
+  {
+    // Below note that l1, l2, and ylm_work_size are ints, not size_ts, and
+    // note the use of n_phi and n_theta.  The reason for this: The last
+    // term in the expression for ylm_work_size can sometimes be negative.
+    // If evaluated using unsigned ints instead of ints, then this will
+    // underflow and give a huge number.
+    const auto l1 = static_cast<int>(m_max + 1);
+    const auto l2 = static_cast<int>(n_theta + 1) / 2;
+    const auto n_phi_int = static_cast<int>(n_phi);
+    const auto n_theta_int = static_cast<int>(n_theta);
+    const int ylm_work_size =
+        n_phi_int + 15 + n_theta_int * (3 * (l1 + l2) - 2) +
+        (l1 - 1) * (l2 * (2 * n_theta_int - l1) - 3 * l1) / 2;
+    ASSERT(ylm_work_size >= 0, "Bad size " << ylm_work_size);
+    const auto l_ylm = static_cast<size_t>(ylm_work_size);
+
+    work_phys_to_spec.assign(l_ylm, 0.0);
+    work_scalar_spec_to_phys.assign(l_ylm, 0.0);
+
+    const size_t work_size = 4 * n_theta * (n_theta + 2) + 2;
+    std::vector<double> work(work_size);
+    const size_t deriv_work_size = n_theta * (n_theta + 4);
+    std::vector<double> deriv_work(deriv_work_size);
+    int err = 0;
+    shagsi_(n_theta_int, n_phi_int, work_phys_to_spec.data(), ylm_work_size,
+            work.data(), static_cast<int>(work_size), deriv_work.data(),
+            static_cast<int>(deriv_work_size), &err);
+    if (UNLIKELY(err != 0)) {
+      ERROR("shagsi error " << err << " in YlmSpherepack");
+    }
+    shsgsi_(n_theta_int, n_phi_int, work_scalar_spec_to_phys.data(),
+            ylm_work_size, work.data(), static_cast<int>(work_size),
+            deriv_work.data(), static_cast<int>(deriv_work_size), &err);
+    if (UNLIKELY(err != 0)) {
+      ERROR("shsgsi error " << err << " in YlmSpherepack");
+    }
+  }
+
+  // Vector work arrays.
+  {
+    // The l1, mdb, mdc values used with these arrays are set to
+    // min(n_theta, (n_phi+2)/2)), which is consistent with l1 and mdab
+    // for scalars.  This is generally larger than what is required by
+    // Spherepack for vectors: min(n_theta, (n_phi+1)/2)).
+    const size_t l2 = (n_theta + 1) / 2;
+    const size_t l_vhsgs =
+        n_theta * l2 * (n_theta + 1) + n_phi + 15 + 2 * n_theta;
+    work_vector_spec_to_phys.assign(l_vhsgs, 0.0);
+
+    const size_t ldwg = (3 * n_theta * (n_theta + 3) + 2) / 2;
+    std::vector<double> dworkg(ldwg);
+    int err = 0;
+    vhsgsi_(static_cast<int>(n_theta), static_cast<int>(n_phi),
+            work_vector_spec_to_phys.data(), static_cast<int>(l_vhsgs),
+            dworkg.data(), static_cast<int>(ldwg), &err);
+    if (UNLIKELY(err != 0)) {
+      ERROR("vhsgsi error " << err << " in YlmSpherepack");
+    }
+  }
+
+  // Coefficients of the Clenshaw recurrence used for interpolation.
+  // See YlmSpherepack::set_up_interpolation_info for their meaning.
+  {
+    const size_t l1 = m_max + 1;
+    const size_t array_size = n_theta * l1 - l1 * (l1 - 1) / 2;
+    auto& alpha = work_interp_alpha;
+    auto& beta = work_interp_beta;
+    auto& pmm = work_interp_pmm;
+    auto& index = work_interp_index;
+    index.resize(array_size);
+    alpha.resize(array_size);
+    beta.resize(array_size);
+    pmm.resize(l1);
+
+    // Fill alpha,beta,index arrays in the same order as the Clenshaw
+    // recurrence, so that we can index them easier during the recurrence.
+    // First do m=0.
+    size_t idx = 0;
+    for (size_t n = n_theta - 1; n > 0; --n, ++idx) {
+      const auto n_dbl = static_cast<double>(n);
+      const double tnp1 = 2.0 * n_dbl + 1;
+      const double np1sq = n_dbl * n_dbl + 2.0 * n_dbl + 1.0;
+      alpha[idx] = sqrt(tnp1 * (tnp1 + 2.0) / np1sq);
+      beta[idx] = -sqrt((tnp1 + 4.0) / tnp1 * np1sq / (np1sq + 2 * n_dbl + 3));
+      index[idx] = n_dbl * l1;
+    }
+    // The next value of beta stores beta(n=1,m=0).
+    // The next value of alpha stores Pbar(n=1,m=0)/(x*Pbar(n=0,m=0)).
+    // These two values are needed for the final Clenshaw recurrence formula.
+    beta[idx] = -0.5 * sqrt(5.0);
+    alpha[idx] = sqrt(3.0);
+    index[idx] = 0;  // Index of coef in the final recurrence formula
+    ++idx;
+
+    // Now do other m.
+    for (size_t m = 1; m < l1; ++m) {
+      for (size_t n = n_theta - 1; n > m; --n, ++idx) {
+        const double tnp1 = 2.0 * n + 1;
+        const double np1sqmmsq = (n + 1.0 + m) * (n + 1.0 - m);
+        alpha[idx] = sqrt(tnp1 * (tnp1 + 2.0) / np1sqmmsq);
+        beta[idx] =
+            -sqrt((tnp1 + 4.0) / tnp1 * np1sqmmsq / (np1sqmmsq + 2. * n + 3.));
+        index[idx] = m + n * l1;
+      }
+      // The next value of beta stores beta(n=m+1,m).
+      // The next value of alpha stores Pbar(n=m+1,m)/(x*Pbar(n=m,m)).
+      // These two values are needed for the final Clenshaw recurrence
+      // formula.
+      beta[idx] = -0.5 * sqrt((2.0 * m + 5) / (m + 1.0));
+      alpha[idx] = sqrt(2.0 * m + 3);
+      index[idx] =
+          m + m * l1;  // Index of coef in the final recurrence formula.
+      ++idx;
+    }
+    ASSERT(idx == index.size(),
+           "Wrong size " << idx << ", expected " << index.size());
+
+    // Now do pmm, which stores Pbar(m,m).
+    pmm[0] = M_SQRT1_2;  // 1/sqrt(2) = Pbar(0)(0)
+    for (size_t m = 1; m < l1; ++m) {
+      pmm[m] = pmm[m - 1] * sqrt((2.0 * m + 1.0) / (2.0 * m));
+    }
+  }
+}
+
+std::shared_ptr<const Storage> cached_storage(const size_t l_max,
+                                              const size_t m_max) noexcept {
+  static const KeyedStaticCache<std::pair<size_t, size_t>,
+                                std::shared_ptr<const Storage>>
+      cache{};
+  return cache(std::make_pair(l_max, m_max), [&l_max, &m_max]() noexcept {
+    return std::make_shared<const Storage>(l_max, m_max);
+  });
+}
+
 std::vector<double>& MemoryPool::get(size_t n_pts) noexcept {
   for (auto& elem : memory_pool_) {
     if (not elem.currently_in_use) {
@@ -5,14 +5,20 @@
 
 #include <array>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "Utilities/Gsl.hpp"
 
 namespace YlmSpherepack_detail {
 
-/// Holds the various 'work' arrays for YlmSpherepack.
+/// Holds the various 'work' arrays for YlmSpherepack.  These depend
+/// only on l_max and m_max and are never modified after construction,
+/// so they are computed once per resolution and shared by all
+/// YlmSpherepacks (see `cached_storage`).
 struct Storage {
+  Storage(size_t l_max, size_t m_max) noexcept;
+
   std::vector<double> work_phys_to_spec;
   std::vector<double> work_scalar_spec_to_phys;
   std::vector<double> work_vector_spec_to_phys;
@@ -25,6 +31,13 @@ struct Storage {
   std::vector<size_t> work_interp_index;
 };
 
+/// Returns the `Storage` for the given resolution, computing it on
+/// first use.  Entries are kept for the lifetime of the process, since
+/// only a handful of resolutions are used in practice and surfaces are
+/// frequently created and destroyed at the same resolution.
+std::shared_ptr<const Storage> cached_storage(size_t l_max,
+                                              size_t m_max) noexcept;
+
 /// This is a quick way of providing temporary space that is
 /// re-utilized many times without the expense of mallocs.  This
 /// turned out to be important for optimizing SpEC (because
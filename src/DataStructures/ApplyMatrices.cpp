@@ -3,11 +3,14 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Transpose.hpp"
@@ -86,6 +89,145 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
   }
   return result;
 }
+
+// Applies `matrix` to every stripe of `data` in one dimension, where
+// consecutive points in the stripe are separated by `stride` and there are
+// `number_of_stripes` blocks of `Columns * stride` points.  The contraction
+// length is known at compile time so the inner sum is fully unrolled, and the
+// loop over `stride` (the points in the lower dimensions) vectorizes because
+// each term in the sum is a contiguous load.
+template <size_t Columns, typename ElementType>
+void sum_factorize_in_dimension(const gsl::not_null<ElementType*> result,
+                                const Matrix& matrix,
+                                const ElementType* const data,
+                                const size_t stride,
+                                const size_t number_of_stripes) noexcept {
+  const size_t rows = matrix.rows();
+  std::array<double, Columns> matrix_row{};
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t column = 0; column < Columns; ++column) {
+      gsl::at(matrix_row, column) = matrix(row, column);
+    }
+    for (size_t stripe = 0; stripe < number_of_stripes; ++stripe) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const ElementType* const data_stripe = data + stripe * Columns * stride;
+      ElementType* const result_stripe =
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          result.get() + (stripe * rows + row) * stride;
+      for (size_t k = 0; k < stride; ++k) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ElementType sum = matrix_row[0] * data_stripe[k];
+        for (size_t column = 1; column < Columns; ++column) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          sum += matrix_row[column] * data_stripe[column * stride + k];
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result_stripe[k] = sum;
+      }
+    }
+  }
+}
+
+template <typename ElementType>
+using SumFactorizationKernel = void (*)(gsl::not_null<ElementType*>,
+                                        const Matrix&, const ElementType*,
+                                        size_t, size_t) noexcept;
+
+template <typename ElementType, size_t... Is>
+constexpr std::array<SumFactorizationKernel<ElementType>, sizeof...(Is)>
+make_sum_factorization_kernels(std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&sum_factorize_in_dimension<Is + 1, ElementType>...}};
+}
+
+// Kernels specialized on the number of columns of the matrix, indexed by
+// `columns - 1`.
+template <typename ElementType>
+constexpr std::array<SumFactorizationKernel<ElementType>,
+                     apply_matrices_detail::max_sum_factorization_extent>
+    sum_factorization_kernels = make_sum_factorization_kernels<ElementType>(
+        std::make_index_sequence<
+            apply_matrices_detail::max_sum_factorization_extent>{});
+
+template <typename MatrixType, size_t Dim>
+bool use_sum_factorization(const std::array<MatrixType, Dim>& matrices,
+                           const Index<Dim>& extents) noexcept {
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix != Matrix{} and
+        (extents[d] == 0 or
+         extents[d] > apply_matrices_detail::max_sum_factorization_extent)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Applies the matrices one dimension at a time without any transposes,
+// alternating between two scratch buffers.  The last non-identity
+// dimension writes directly into `result`.
+template <typename ElementType, typename MatrixType, size_t Dim>
+void apply_sum_factorization(
+    const gsl::not_null<ElementType*> result,
+    const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
+    const Index<Dim>& extents,
+    const size_t number_of_independent_components) noexcept {
+  size_t number_of_matrices = 0;
+  size_t scratch_size = number_of_independent_components;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      scratch_size *= extents[d];
+    } else {
+      ++number_of_matrices;
+      scratch_size *= std::max(matrix.rows(), matrix.columns());
+    }
+  }
+  if (number_of_matrices == 0) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::copy(data, data + number_of_independent_components * extents.product(),
+              result.get());
+    return;
+  }
+
+  // This kernel runs for every element many times per step, so take the
+  // scratch memory from the thread's arena instead of the heap
+  Arena& arena = Arena::local();
+  const ArenaScope arena_scope{make_not_null(&arena)};
+  ElementType* const scratch =
+      number_of_matrices > 1
+          ? arena.allocate<ElementType>(
+                std::min(number_of_matrices - 1, size_t{2}) * scratch_size)
+          : nullptr;
+  const std::array<ElementType*, 2> buffers{
+      {scratch,
+       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+       number_of_matrices > 2 ? scratch + scratch_size : scratch}};
+
+  std::array<size_t, Dim> current_extents = extents.indices();
+  const ElementType* input = data;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    size_t stride = 1;
+    for (size_t i = 0; i < d; ++i) {
+      stride *= gsl::at(current_extents, i);
+    }
+    size_t number_of_stripes = number_of_independent_components;
+    for (size_t i = d + 1; i < Dim; ++i) {
+      number_of_stripes *= gsl::at(current_extents, i);
+    }
+    --number_of_matrices;
+    ElementType* const output =
+        number_of_matrices == 0 ? result.get()
+                                : gsl::at(buffers, number_of_matrices % 2);
+    gsl::at(sum_factorization_kernels<ElementType>, matrix.columns() - 1)(
+        make_not_null(output), matrix, input, stride, number_of_stripes);
+    gsl::at(current_extents, d) = matrix.rows();
+    input = output;
+  }
+}
 }  // namespace
 
 namespace apply_matrices_detail {
@@ -96,6 +238,13 @@ void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
     const Index<Dim>& extents,
     const size_t number_of_independent_components) noexcept {
+  if constexpr (sizeof...(DimensionIsIdentity) == 0) {
+    if (use_sum_factorization(matrices, extents)) {
+      apply_sum_factorization(result, matrices, data, extents,
+                              number_of_independent_components);
+      return;
+    }
+  }
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
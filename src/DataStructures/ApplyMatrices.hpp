@@ -19,6 +19,11 @@ class Index;
 /// \endcond
 
 namespace apply_matrices_detail {
+/// Matrices with at most this many columns are applied with a sum-factorized
+/// kernel specialized on the number of columns.  Larger matrices fall back to
+/// BLAS calls with transposes between the dimensions.
+constexpr size_t max_sum_factorization_extent = 12;
+
 template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
 struct Impl {
   template <typename MatrixType>
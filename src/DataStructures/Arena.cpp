@@ -0,0 +1,89 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/Arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+size_t round_up_to_alignment(const size_t bytes) noexcept {
+  return (bytes + Arena::alignment - 1) / Arena::alignment * Arena::alignment;
+}
+}  // namespace
+
+Arena::Arena(const size_t initial_capacity) noexcept {
+  if (initial_capacity > 0) {
+    add_block(initial_capacity);
+  }
+}
+
+void Arena::rewind(const Marker& marker) noexcept {
+  ASSERT(marker.block < current_block_ or
+             (marker.block == current_block_ and marker.offset <= offset_),
+         "Can't rewind the arena to a state after its current state.");
+  current_block_ = marker.block;
+  offset_ = marker.offset;
+  if (current_block_ == 0 and offset_ == 0 and blocks_.size() > 1) {
+    // Merge the blocks, so the memory that was needed since the arena was
+    // last empty fits into the first block from now on
+    const size_t total_size = capacity();
+    blocks_.clear();
+    add_block(total_size);
+  }
+}
+
+size_t Arena::bytes_in_use() const noexcept {
+  size_t bytes = offset_;
+  for (size_t i = 0; i < current_block_; ++i) {
+    bytes += blocks_[i].size;
+  }
+  return bytes;
+}
+
+size_t Arena::capacity() const noexcept {
+  size_t total_size = 0;
+  for (const auto& block : blocks_) {
+    total_size += block.size;
+  }
+  return total_size;
+}
+
+Arena& Arena::local() noexcept {
+  thread_local Arena arena{};
+  return arena;
+}
+
+void* Arena::allocate_bytes(const size_t bytes) noexcept {
+  const size_t aligned_bytes = round_up_to_alignment(std::max(bytes, 1_st));
+  while (current_block_ < blocks_.size() and
+         offset_ + aligned_bytes > blocks_[current_block_].size) {
+    // The rest of the current block is left unused
+    ++current_block_;
+    offset_ = 0;
+  }
+  if (current_block_ == blocks_.size()) {
+    add_block(std::max(aligned_bytes, 2 * capacity()));
+    offset_ = 0;
+  }
+  std::byte* const result = blocks_[current_block_].data.get() + offset_;
+  offset_ += aligned_bytes;
+  return result;
+}
+
+void Arena::add_block(const size_t minimum_size) noexcept {
+  const size_t size = round_up_to_alignment(minimum_size);
+  blocks_.push_back(Block{
+      std::unique_ptr<std::byte[], AlignedDelete>{static_cast<std::byte*>(
+          ::operator new(size, std::align_val_t{alignment}))},
+      size});
+}
+
+void Arena::AlignedDelete::operator()(std::byte* const data) const noexcept {
+  ::operator delete(data, std::align_val_t{alignment});
+}
@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A bump allocator for short-lived scratch memory.
+ *
+ * Allocating from an `Arena` only advances an offset into a block of memory
+ * that the arena holds, and memory is never freed individually. Instead, the
+ * arena is rewound to an earlier state with `rewind`, which releases all
+ * memory that was allocated since then at once. Use an `ArenaScope` to rewind
+ * at the end of a scope.
+ *
+ * When an allocation doesn't fit into the current block, a new block at least
+ * twice as large as all previous ones is allocated. Once the arena is rewound
+ * to its empty state the blocks are merged into one, so a code path that
+ * allocates the same amount of scratch memory each time it runs allocates
+ * from the heap only the first few times.
+ *
+ * Memory from the arena is uninitialized and aligned for `double` and
+ * `std::complex<double>`. It is only valid until the arena is rewound past
+ * the allocation, so objects that use it must not outlive the `ArenaScope`
+ * in which they were allocated.
+ *
+ * \see `Arena::local()` for an arena per thread, i.e. per processing element
+ * \see The non-owning constructor of `Variables` to place a `Variables` in
+ * memory from an arena.
+ */
+class Arena {
+ public:
+  /// The state of an arena, which it can be rewound to
+  struct Marker {
+    size_t block = 0;
+    size_t offset = 0;
+  };
+
+  Arena() = default;
+  explicit Arena(size_t initial_capacity) noexcept;
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  Arena(Arena&&) = default;
+  Arena& operator=(Arena&&) = default;
+  ~Arena() = default;
+
+  /// Memory for `count` objects of type `T`, which is uninitialized
+  template <typename T>
+  T* allocate(const size_t count) noexcept {
+    static_assert(alignof(T) <= alignment,
+                  "The arena can't align memory for this type.");
+    return static_cast<T*>(allocate_bytes(count * sizeof(T)));
+  }
+
+  /// The current state of the arena
+  Marker marker() const noexcept { return {current_block_, offset_}; }
+
+  /// Release all memory that was allocated after `marker` was taken
+  void rewind(const Marker& marker) noexcept;
+
+  /// Release all memory that was allocated from the arena
+  void reset() noexcept { rewind(Marker{}); }
+
+  /// The number of bytes that are currently allocated from the arena
+  size_t bytes_in_use() const noexcept;
+
+  /// The total size of the blocks that the arena holds
+  size_t capacity() const noexcept;
+
+  /// The number of blocks that the arena holds
+  size_t number_of_blocks() const noexcept { return blocks_.size(); }
+
+  /// An arena that is local to the calling thread, so it can be used without
+  /// synchronization by all code that runs on a processing element
+  static Arena& local() noexcept;
+
+  static constexpr size_t alignment = 64;
+
+ private:
+  struct AlignedDelete {
+    void operator()(std::byte* data) const noexcept;
+  };
+
+  struct Block {
+    std::unique_ptr<std::byte[], AlignedDelete> data;
+    size_t size;
+  };
+
+  void* allocate_bytes(size_t bytes) noexcept;
+  void add_block(size_t minimum_size) noexcept;
+
+  std::vector<Block> blocks_{};
+  size_t current_block_ = 0;
+  size_t offset_ = 0;
+};
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Rewinds an `Arena` to its state at construction when the scope ends.
+ *
+ * Scopes can be nested, so functions can use scratch memory from
+ * `Arena::local()` without knowing whether their caller does as well.
+ */
+class ArenaScope {
+ public:
+  explicit ArenaScope(const gsl::not_null<Arena*> arena) noexcept
+      : arena_(arena), marker_(arena->marker()) {}
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+  ~ArenaScope() noexcept { arena_->rewind(marker_); }
+
+ private:
+  gsl::not_null<Arena*> arena_;
+  Arena::Marker marker_;
+};
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <utility>  // IWYU pragma: keep  // for std::move
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/TempBuffer.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -35,6 +36,13 @@ class CachedTempBuffer {
   CachedTempBuffer(const size_t size, Computer computer) noexcept
       : data_(size), computer_(std::move(computer)) {}
 
+  /// Construct the buffer with the given computer, taking the memory of the
+  /// underlying `TempBuffer` from the `arena`. The buffer must then not
+  /// outlive the `ArenaScope` it was created in.
+  CachedTempBuffer(const size_t size, const gsl::not_null<Arena*> arena,
+                   Computer computer) noexcept
+      : data_(size, arena), computer_(std::move(computer)) {}
+
   /// Obtain a value from the buffer, computing it if necessary.
   template <typename Tag>
   const typename Tag::type& get_var(Tag /*meta*/) noexcept {
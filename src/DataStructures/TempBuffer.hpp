@@ -5,7 +5,9 @@
 
 #include <cstddef>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -23,6 +25,10 @@
  * Variables.  If DataType is a fundamental type, then TempBuffer is a
  * TaggedTuple.
  *
+ * A TempBuffer of DataVectors can take its memory from an `Arena` instead of
+ * the heap by passing the arena to the constructor, which is cheaper in hot
+ * loops and avoids contention in the allocator when running multithreaded.
+ * The TempBuffer must then not outlive the `ArenaScope` it was created in.
  */
 template <typename TagList,
           bool is_fundamental = std::is_fundamental_v<
@@ -33,9 +39,17 @@ template <typename TagList>
 struct TempBuffer<TagList, true> : tuples::tagged_tuple_from_typelist<TagList> {
   explicit TempBuffer(const size_t /*size*/) noexcept
       : tuples::tagged_tuple_from_typelist<TagList>::TaggedTuple(){}
+  TempBuffer(const size_t /*size*/, const gsl::not_null<Arena*> /*arena*/)
+      noexcept
+      : tuples::tagged_tuple_from_typelist<TagList>::TaggedTuple(){}
 };
 
 template <typename TagList>
 struct TempBuffer<TagList, false> : Variables<TagList> {
   using Variables<TagList>::Variables;
+  TempBuffer(const size_t size, const gsl::not_null<Arena*> arena) noexcept
+      : Variables<TagList>(
+            arena->allocate<typename Variables<TagList>::value_type>(
+                size * Variables<TagList>::number_of_independent_components),
+            size) {}
 };
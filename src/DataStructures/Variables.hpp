@@ -27,6 +27,7 @@
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeSignalingNan.hpp"
@@ -142,6 +143,18 @@ class Variables<tmpl::list<Tags...>> {
 
   Variables(size_t number_of_grid_points, value_type value) noexcept;
 
+  /// Construct a non-owning Variables that points to the memory starting at
+  /// `start`, which must hold `number_of_grid_points` times
+  /// `number_of_independent_components` values and must outlive the Variables.
+  ///
+  /// A non-owning Variables can't be resized. Copying or moving another
+  /// Variables into it copies the data into the memory it points to. This is
+  /// useful to place scratch data in preallocated memory, such as an `Arena`.
+  /// Move-constructing from a non-owning Variables points to the same memory,
+  /// but move-assigning it to an owning Variables copies the data, so the
+  /// owning Variables never ends up pointing to memory that it doesn't own.
+  Variables(pointer start, size_t number_of_grid_points) noexcept;
+
   Variables(Variables&& rhs) noexcept;
   Variables& operator=(Variables&& rhs) noexcept;
 
@@ -187,6 +200,13 @@ class Variables<tmpl::list<Tags...>> {
   void initialize(size_t number_of_grid_points, value_type value) noexcept;
   /// @}
 
+  /// Make this a non-owning Variables that points to the memory starting at
+  /// `start`. See the non-owning constructor for details.
+  void set_data_ref(pointer start, size_t number_of_grid_points) noexcept;
+
+  /// Whether the Variables owns its memory
+  bool is_owning() const noexcept { return owning_; }
+
   constexpr SPECTRE_ALWAYS_INLINE size_t
   number_of_grid_points() const noexcept {
     return number_of_grid_points_;
@@ -434,6 +454,7 @@ class Variables<tmpl::list<Tags...>> {
   std::unique_ptr<value_type[]> variable_data_impl_{};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
+  bool owning_ = true;
 
   // variable_data_ is only used to plug into the Blaze expression templates
   pointer_type variable_data_;
@@ -448,6 +469,9 @@ class Variables<tmpl::list<>> {
   using tags_list = tmpl::list<>;
   Variables() noexcept = default;
   explicit Variables(const size_t /*number_of_grid_points*/) noexcept {};
+  Variables(double* const /*start*/,
+            const size_t /*number_of_grid_points*/) noexcept {}
+  static constexpr size_t number_of_independent_components = 0;
   static constexpr size_t size() noexcept { return 0; }
 };
 
@@ -504,9 +528,33 @@ Variables<tmpl::list<Tags...>>::Variables(const size_t number_of_grid_points,
   initialize(number_of_grid_points, value);
 }
 
+template <typename... Tags>
+Variables<tmpl::list<Tags...>>::Variables(
+    const pointer start, const size_t number_of_grid_points) noexcept {
+  set_data_ref(start, number_of_grid_points);
+}
+
+template <typename... Tags>
+void Variables<tmpl::list<Tags...>>::set_data_ref(
+    const pointer start, const size_t number_of_grid_points) noexcept {
+  variable_data_impl_.reset();
+  owning_ = false;
+  number_of_grid_points_ = number_of_grid_points;
+  size_ = number_of_grid_points * number_of_independent_components;
+  variable_data_.reset(start, size_);
+  add_reference_variable_data();
+}
+
 template <typename... Tags>
 void Variables<tmpl::list<Tags...>>::initialize(
     const size_t number_of_grid_points) noexcept {
+  if (UNLIKELY(not owning_ and
+               number_of_grid_points_ != number_of_grid_points)) {
+    ERROR("A non-owning Variables with "
+          << number_of_grid_points_ << " grid points can't be resized to "
+          << number_of_grid_points
+          << " grid points, because it would overrun the memory it was given.");
+  }
   if (number_of_grid_points_ != number_of_grid_points) {
     number_of_grid_points_ = number_of_grid_points;
     size_ = number_of_grid_points * number_of_independent_components;
@@ -526,8 +574,7 @@ template <typename... Tags>
 void Variables<tmpl::list<Tags...>>::initialize(
     const size_t number_of_grid_points, const value_type value) noexcept {
   initialize(number_of_grid_points);
-  std::fill(variable_data_impl_.get(), variable_data_impl_.get() + size_,
-            value);
+  std::fill(data(), data() + size_, value);
 }
 
 /// \cond HIDDEN_SYMBOLS
@@ -559,14 +606,16 @@ Variables<tmpl::list<Tags...>>::Variables(
     : variable_data_impl_(std::move(rhs.variable_data_impl_)),
       size_(rhs.size()),
       number_of_grid_points_(rhs.number_of_grid_points()),
+      owning_(rhs.owning_),
       reference_variable_data_(std::move(rhs.reference_variable_data_)) {
   rhs.variable_data_impl_.reset();
   rhs.size_ = 0;
   rhs.number_of_grid_points_ = 0;
+  rhs.owning_ = true;
   if (size_ == 0) {
     return;
   }
-  variable_data_.reset(variable_data_impl_.get(), size_);
+  variable_data_.reset(owning_ ? variable_data_impl_.get() : rhs.data(), size_);
 }
 
 template <typename... Tags>
@@ -575,8 +624,17 @@ Variables<tmpl::list<Tags...>>& Variables<tmpl::list<Tags...>>::operator=(
   if (this == &rhs) {
     return *this;
   }
+  if (not owning_ or not rhs.owning_) {
+    // Either the memory of this Variables or that of `rhs` is owned elsewhere,
+    // e.g. by an `Arena`, so copy the data. Taking over the memory of a
+    // non-owning `rhs` would leave this Variables pointing to memory that may
+    // be released before it.
+    *this = rhs;
+    return *this;
+  }
   variable_data_impl_ = std::move(rhs.variable_data_impl_);
   rhs.variable_data_impl_.reset();
+  rhs.owning_ = true;
   size_ = rhs.size_;
   rhs.size_ = 0;
   number_of_grid_points_ = std::move(rhs.number_of_grid_points_);
@@ -628,6 +686,7 @@ Variables<tmpl::list<Tags...>>::Variables(
     : variable_data_impl_(std::move(rhs.variable_data_impl_)),
       size_(rhs.size()),
       number_of_grid_points_(rhs.number_of_grid_points()),
+      owning_(rhs.owning_),
       reference_variable_data_(std::move(rhs.reference_variable_data_)) {
   static_assert(
       (std::is_same_v<typename Tags::type, typename WrappedTags::type> and ...),
@@ -635,10 +694,11 @@ Variables<tmpl::list<Tags...>>::Variables(
   rhs.variable_data_impl_.reset();
   rhs.size_ = 0;
   rhs.number_of_grid_points_ = 0;
+  rhs.owning_ = true;
   if (size_ == 0) {
     return;
   }
-  variable_data_.reset(variable_data_impl_.get(), size_);
+  variable_data_.reset(owning_ ? variable_data_impl_.get() : rhs.data(), size_);
 }
 
 template <typename... Tags>
@@ -651,8 +711,17 @@ Variables<tmpl::list<Tags...>>& Variables<tmpl::list<Tags...>>::operator=(
   static_assert(
       (std::is_same_v<typename Tags::type, typename WrappedTags::type> and ...),
       "Tensor types do not match!");
+  if (not owning_ or not rhs.owning_) {
+    // Either the memory of this Variables or that of `rhs` is owned elsewhere,
+    // e.g. by an `Arena`, so copy the data. Taking over the memory of a
+    // non-owning `rhs` would leave this Variables pointing to memory that may
+    // be released before it.
+    *this = rhs;
+    return *this;
+  }
   variable_data_impl_ = std::move(rhs.variable_data_impl_);
   rhs.variable_data_impl_.reset();
+  rhs.owning_ = true;
   size_ = rhs.size_;
   rhs.size_ = 0;
   number_of_grid_points_ = std::move(rhs.number_of_grid_points_);
@@ -668,7 +737,7 @@ void Variables<tmpl::list<Tags...>>::pup(PUP::er& p) noexcept {
   if (p.isUnpacking()) {
     initialize(number_of_grid_points);
   }
-  PUParray(p, variable_data_impl_.get(), size_);
+  PUParray(p, data(), size_);
 }
 /// \endcond
 
@@ -724,7 +793,9 @@ void Variables<tmpl::list<Tags...>>::add_reference_variable_data() noexcept {
   if (size_ == 0) {
     return;
   }
-  variable_data_.reset(variable_data_impl_.get(), size_);
+  if (owning_) {
+    variable_data_.reset(variable_data_impl_.get(), size_);
+  }
   size_t variable_offset = 0;
   tmpl::for_each<tags_list>([this, &variable_offset](auto tag_v) noexcept {
     using Tag = tmpl::type_from<decltype(tag_v)>;
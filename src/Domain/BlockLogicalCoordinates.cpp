@@ -3,16 +3,26 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Block.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/BlockId.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
@@ -21,6 +31,250 @@ using block_logical_coord_holder = std::optional<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>;
 using functions_of_time_type = std::unordered_map<
     std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+
+// Whether the block logical coordinate `xi` of a point in a block lies on the
+// boundary of the block. The point is in the block if `xi` is in [-1, 1], but
+// the inverse maps only find `xi` up to roundoff, so a point that is also in a
+// neighboring block may come out of the inverse just inside the boundary.
+bool is_on_logical_boundary(const double xi) noexcept {
+  return equal_within_roundoff(std::abs(xi), 1.0);
+}
+
+// The block logical coordinates of the point `x_frame` if it is in the
+// `block`
+template <size_t Dim, typename Frame>
+std::optional<tnsr::I<double, Dim, ::Frame::Logical>> coordinates_in_block(
+    const Block<Dim>& block, const tnsr::I<double, Dim, Frame>& x_frame,
+    const double time,
+    const functions_of_time_type& functions_of_time) noexcept {
+  tnsr::I<double, Dim, ::Frame::Logical> x_logical{};
+  if (block.is_time_dependent()) {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      // Point is in the inertial frame, so we need to map to the grid
+      // frame and then the logical frame.
+      const auto moving_inv =
+          block.moving_mesh_grid_to_inertial_map().inverse(
+              x_frame, time, functions_of_time);
+      if (not moving_inv.has_value()) {
+        return std::nullopt;
+      }
+      // logical to grid map is time-independent.
+      const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
+          moving_inv.value());
+      if (inv.has_value()) {
+        x_logical = inv.value();
+      } else {
+        return std::nullopt;  // Not in this block
+      }
+    } else {  // frame is different than ::Frame::Inertial
+      // Currently 'time' is unused in this branch.
+      // To make the compiler happy, need to trick it to think that
+      // 'time' is used.
+      (void) time;
+      // Currently we only support Grid and Inertial frames in the
+      // block, so make sure Frame is ::Frame::Grid. (The
+      // Inertial case was handled above.)
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+
+      // Point is in the grid frame, just map to logical frame.
+      const auto inv =
+          block.moving_mesh_logical_to_grid_map().inverse(x_frame);
+      if (inv.has_value()) {
+        x_logical = inv.value();
+      } else {
+        return std::nullopt;  // Not in this block
+      }
+    }
+  } else {  // not block.is_time_dependent()
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      const auto inv = block.stationary_map().inverse(x_frame);
+      if (inv.has_value()) {
+        x_logical = inv.value();
+      } else {
+        return std::nullopt;  // Not in this block
+      }
+    } else {
+      // If the map is time-independent, then the grid and
+      // inertial frames are the same.  So if we are in the grid frame,
+      // convert to the inertial frame.  Otherwise throw a static_assert.
+      // Once we support more frames (e.g. distorted) this logic will
+      // change.
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = x_frame.get(d);
+      }
+      const auto inv = block.stationary_map().inverse(x_inertial);
+      if (inv.has_value()) {
+        x_logical = inv.value();
+      } else {
+        return std::nullopt;  // Not in this block
+      }
+    }
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    // Assumes that logical coordinates go from -1 to +1 in each
+    // dimension.
+    if (x_logical.get(d) < -1.0 or x_logical.get(d) > 1.0) {
+      return std::nullopt;
+    }
+  }
+  return x_logical;
+}
+
+// The block logical coordinates of all points `x` at once, and whether each
+// point is in the `block`
+template <size_t Dim, typename Frame>
+std::pair<tnsr::I<DataVector, Dim, ::Frame::Logical>, std::vector<bool>>
+coordinates_in_block(
+    const Block<Dim>& block, const tnsr::I<DataVector, Dim, Frame>& x,
+    const double time,
+    const functions_of_time_type& functions_of_time) noexcept {
+  const size_t num_pts = get<0>(x).size();
+  tnsr::I<DataVector, Dim, ::Frame::Logical> x_logical{num_pts};
+  std::vector<bool> is_in_block{};
+  if (block.is_time_dependent()) {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      tnsr::I<DataVector, Dim, ::Frame::Grid> x_grid{num_pts};
+      block.moving_mesh_grid_to_inertial_map().inverse(
+          make_not_null(&x_grid), make_not_null(&is_in_block), x, time,
+          functions_of_time);
+      std::vector<bool> is_invertible{};
+      block.moving_mesh_logical_to_grid_map().inverse(
+          make_not_null(&x_logical), make_not_null(&is_invertible), x_grid);
+      for (size_t s = 0; s < num_pts; ++s) {
+        is_in_block[s] = is_in_block[s] and is_invertible[s];
+      }
+    } else {
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      block.moving_mesh_logical_to_grid_map().inverse(
+          make_not_null(&x_logical), make_not_null(&is_in_block), x);
+    }
+  } else {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      block.stationary_map().inverse(make_not_null(&x_logical),
+                                     make_not_null(&is_in_block), x);
+    } else {
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      // If the map is time-independent, then the grid and inertial frames
+      // are the same.
+      tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = x.get(d);
+      }
+      block.stationary_map().inverse(make_not_null(&x_logical),
+                                     make_not_null(&is_in_block), x_inertial);
+    }
+  }
+  for (size_t s = 0; s < num_pts; ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      // Assumes that logical coordinates go from -1 to +1 in each
+      // dimension.
+      is_in_block[s] = is_in_block[s] and x_logical.get(d)[s] >= -1.0 and
+                       x_logical.get(d)[s] <= 1.0;
+    }
+  }
+  return {std::move(x_logical), std::move(is_in_block)};
+}
+
+// An axis-aligned box in `Frame` that contains a block, padded so that it
+// most likely contains all of the block even though the block's map is
+// only sampled at a few points. It is used only to decide which blocks to try
+// first, so a box that misses part of its block costs time but doesn't change
+// the result.
+template <size_t Dim>
+struct BoundingBox {
+  std::array<double, Dim> lower{};
+  std::array<double, Dim> upper{};
+
+  template <typename Frame>
+  bool contains(const tnsr::I<double, Dim, Frame>& x) const noexcept {
+    for (size_t d = 0; d < Dim; ++d) {
+      if (x.get(d) < gsl::at(lower, d) or x.get(d) > gsl::at(upper, d)) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+// The number of samples per dimension on each face of the block
+constexpr size_t bounding_box_samples_per_dim = 5;
+// The fraction of the size of the box by which it is padded on each side
+constexpr double bounding_box_padding = 0.1;
+
+// Points on a uniform grid on the faces of the logical cube. Since the maps
+// are bijective, the image of the faces bounds the image of the block.
+template <size_t Dim>
+tnsr::I<DataVector, Dim, ::Frame::Logical> logical_face_samples() noexcept {
+  constexpr size_t n = bounding_box_samples_per_dim;
+  std::vector<std::array<double, Dim>> samples{};
+  std::array<size_t, Dim> index{};
+  while (index[Dim - 1] < n) {
+    const bool on_face = alg::any_of(
+        index, [](const size_t i) noexcept { return i == 0 or i == n - 1; });
+    if (on_face) {
+      std::array<double, Dim> sample{};
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(sample, d) =
+            -1.0 + 2.0 * static_cast<double>(gsl::at(index, d)) /
+                       static_cast<double>(n - 1);
+      }
+      samples.push_back(sample);
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      ++gsl::at(index, d);
+      if (gsl::at(index, d) < n or d == Dim - 1) {
+        break;
+      }
+      gsl::at(index, d) = 0;
+    }
+  }
+  tnsr::I<DataVector, Dim, ::Frame::Logical> result{samples.size()};
+  for (size_t s = 0; s < samples.size(); ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      result.get(d)[s] = gsl::at(samples[s], d);
+    }
+  }
+  return result;
+}
+
+template <size_t Dim, typename Frame>
+BoundingBox<Dim> bounding_box(
+    const Block<Dim>& block,
+    const tnsr::I<DataVector, Dim, ::Frame::Logical>& logical_samples,
+    const double time,
+    const functions_of_time_type& functions_of_time) noexcept {
+  tnsr::I<DataVector, Dim, Frame> samples{};
+  if (block.is_time_dependent()) {
+    auto grid_samples =
+        block.moving_mesh_logical_to_grid_map()(logical_samples);
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      samples = block.moving_mesh_grid_to_inertial_map()(
+          std::move(grid_samples), time, functions_of_time);
+    } else {
+      samples = std::move(grid_samples);
+    }
+  } else {
+    auto inertial_samples = block.stationary_map()(logical_samples);
+    for (size_t d = 0; d < Dim; ++d) {
+      samples.get(d) = std::move(inertial_samples.get(d));
+    }
+  }
+  BoundingBox<Dim> box{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const double lower = min(samples.get(d));
+    const double upper = max(samples.get(d));
+    const double padding = bounding_box_padding * (upper - lower);
+    gsl::at(box.lower, d) = lower - padding;
+    gsl::at(box.upper, d) = upper + padding;
+  }
+  return box;
+}
 }  // namespace
 
 template <size_t Dim, typename Frame>
@@ -30,95 +284,97 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     const functions_of_time_type& functions_of_time) noexcept {
   const size_t num_pts = get<0>(x).size();
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
+  if (num_pts == 0) {
+    return block_coord_holders;
+  }
+  const auto& blocks = domain.blocks();
+  const auto point = [&x](const size_t s) noexcept {
     tnsr::I<double, Dim, Frame> x_frame(0.0);
     for (size_t d = 0; d < Dim; ++d) {
       x_frame.get(d) = x.get(d)[s];
     }
-    tnsr::I<double, Dim, typename ::Frame::Logical> x_logical{};
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      if (block.is_time_dependent()) {
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          // Point is in the inertial frame, so we need to map to the grid
-          // frame and then the logical frame.
-          const auto moving_inv =
-              block.moving_mesh_grid_to_inertial_map().inverse(
-                  x_frame, time, functions_of_time);
-          if (not moving_inv.has_value()) {
-            continue;
-          }
-          // logical to grid map is time-independent.
-          const auto inv = block.moving_mesh_logical_to_grid_map().inverse(
-              moving_inv.value());
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {  // frame is different than ::Frame::Inertial
-          // Currently 'time' is unused in this branch.
-          // To make the compiler happy, need to trick it to think that
-          // 'time' is used.
-          (void) time;
-          // Currently we only support Grid and Inertial frames in the
-          // block, so make sure Frame is ::Frame::Grid. (The
-          // Inertial case was handled above.)
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-
-          // Point is in the grid frame, just map to logical frame.
-          const auto inv =
-              block.moving_mesh_logical_to_grid_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
-      } else {  // not block.is_time_dependent()
-        if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
-          const auto inv = block.stationary_map().inverse(x_frame);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        } else {
-          // If the map is time-independent, then the grid and
-          // inertial frames are the same.  So if we are in the grid frame,
-          // convert to the inertial frame.  Otherwise throw a static_assert.
-          // Once we support more frames (e.g. distorted) this logic will
-          // change.
-          static_assert(std::is_same_v<Frame, ::Frame::Grid>,
-                        "Cannot convert from given frame to Grid frame");
-          tnsr::I<double, Dim, ::Frame::Inertial> x_inertial(0.0);
-          for (size_t d = 0; d < Dim; ++d) {
-            x_inertial.get(d) = x_frame.get(d);
-          }
-          const auto inv = block.stationary_map().inverse(x_inertial);
-          if (inv.has_value()) {
-            x_logical = inv.value();
-          } else {
-            continue;  // Not in this block
-          }
-        }
+    return x_frame;
+  };
+
+  // Instead of inverting the map of every block at every point, first find
+  // the points that lie in the bounding box of each block and try only those.
+  // The blocks are processed in order, so each point is assigned to the block
+  // with the smallest id among the blocks whose box contains it.
+  const auto logical_samples = logical_face_samples<Dim>();
+  std::vector<BoundingBox<Dim>> boxes{};
+  boxes.reserve(blocks.size());
+  for (const auto& block : blocks) {
+    boxes.push_back(bounding_box<Dim, Frame>(block, logical_samples, time,
+                                             functions_of_time));
+  }
+  std::vector<std::vector<size_t>> points_in_boxes(blocks.size());
+  for (size_t s = 0; s < num_pts; ++s) {
+    const auto x_frame = point(s);
+    for (size_t b = 0; b < blocks.size(); ++b) {
+      if (boxes[b].contains(x_frame)) {
+        points_in_boxes[b].push_back(s);
       }
-      bool is_contained = true;
+    }
+  }
+  std::vector<size_t> points_to_check{};
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    points_to_check.clear();
+    for (const size_t s : points_in_boxes[b]) {
+      if (not block_coord_holders[s].has_value()) {
+        points_to_check.push_back(s);
+      }
+    }
+    if (points_to_check.empty()) {
+      continue;
+    }
+    // Invert the maps for all points in the box at once
+    tnsr::I<DataVector, Dim, Frame> x_in_box{points_to_check.size()};
+    for (size_t i = 0; i < points_to_check.size(); ++i) {
       for (size_t d = 0; d < Dim; ++d) {
-        // Assumes that logical coordinates go from -1 to +1 in each
-        // dimension.
-        is_contained = is_contained and x_logical.get(d) >= -1.0 and
-                       x_logical.get(d) <= 1.0;
-      }
-      if (is_contained) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
-        block_coord_holders[s] =
-            make_id_pair(domain::BlockId(block.id()), std::move(x_logical));
+        x_in_box.get(d)[i] = x.get(d)[points_to_check[i]];
+      }
+    }
+    const auto [x_logical, is_in_block] =
+        coordinates_in_block(blocks[b], x_in_box, time, functions_of_time);
+    for (size_t i = 0; i < points_to_check.size(); ++i) {
+      if (is_in_block[i]) {
+        tnsr::I<double, Dim, ::Frame::Logical> x_logical_point{};
+        for (size_t d = 0; d < Dim; ++d) {
+          x_logical_point.get(d) = x_logical.get(d)[i];
+        }
+        block_coord_holders[points_to_check[i]] = make_id_pair(
+            domain::BlockId(blocks[b].id()), std::move(x_logical_point));
+      }
+    }
+  }
+
+  // Each point will be in one and only one block, unless it is on a shared
+  // boundary. In that case, choose the first matching block (and this block
+  // will have the smallest block_id). Check the blocks whose bounding box
+  // missed the point, in case the box didn't cover all of the block, which is
+  // only necessary for points that weren't found at all or that lie on the
+  // boundary of the block they were assigned to.
+  for (size_t s = 0; s < num_pts; ++s) {
+    size_t blocks_to_check = blocks.size();
+    if (block_coord_holders[s].has_value()) {
+      const auto& x_logical = block_coord_holders[s].value().data;
+      if (alg::none_of(x_logical, [](const double xi) noexcept {
+            return is_on_logical_boundary(xi);
+          })) {
+        continue;
+      }
+      blocks_to_check = block_coord_holders[s].value().id.get_index();
+    }
+    const auto x_frame = point(s);
+    for (size_t b = 0; b < blocks_to_check; ++b) {
+      if (boxes[b].contains(x_frame)) {
+        continue;
+      }
+      auto x_logical =
+          coordinates_in_block(blocks[b], x_frame, time, functions_of_time);
+      if (x_logical.has_value()) {
+        block_coord_holders[s] = make_id_pair(domain::BlockId(blocks[b].id()),
+                                              std::move(x_logical.value()));
         break;
       }
     }
@@ -38,6 +38,12 @@ class IdPair;
 /// If a point is on a shared boundary of two or more `Block`s, it is
 /// returned only once, and is considered to belong to the `Block`
 /// with the smaller `BlockId`.
+///
+/// To avoid inverting the map of every `Block` at every point, the maps are
+/// first evaluated on the faces of each `Block` to find a bounding box around
+/// it at the given `time`. The points in each box are inverted together,
+/// and only points that no box leads to, or that lie on a block boundary,
+/// are tried against the other `Block`s.
 template <size_t Dim, typename Frame>
 auto block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -22,6 +23,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -122,6 +124,26 @@ class CoordinateMapBase : public PUP::able {
       std::string,
       std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
       noexcept = 0;
+
+  /// Apply the inverse `Maps` to all points in `target_points` at once.
+  /// `is_invertible` is resized to the number of points and is `false` at
+  /// points where the map isn't invertible, in which case the corresponding
+  /// `source_points` are unspecified. Maps that provide an `inverse` for all
+  /// points at once, such as
+  /// `domain::CoordinateMaps::TimeDependent::CubicScale`, solve for all
+  /// points together.
+  virtual void inverse(
+      gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_points,
+      gsl::not_null<std::vector<bool>*> is_invertible,
+      const tnsr::I<DataVector, Dim, TargetFrame>& target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+      std::string,
+      std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+      functions_of_time = std::unordered_map<
+      std::string,
+      std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
+      noexcept = 0;
   /// @}
 
   /// @{
@@ -329,6 +351,18 @@ class CoordinateMap
     return inverse_impl(std::move(target_point), time, functions_of_time,
                         std::make_index_sequence<sizeof...(Maps)>{});
   }
+  void inverse(
+      gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_points,
+      gsl::not_null<std::vector<bool>*> is_invertible,
+      const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{}) const
+      noexcept override;
   /// @}
 
   /// @{
@@ -503,6 +537,16 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const noexcept;
 
+  template <size_t... Is>
+  void inverse_impl(
+      gsl::not_null<std::array<DataVector, dim>*> mapped_points,
+      gsl::not_null<std::vector<bool>*> is_invertible, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const noexcept;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
@@ -20,6 +20,7 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
@@ -149,6 +150,43 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : std::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+void CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse(
+    const gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_points,
+    const gsl::not_null<std::vector<bool>*> is_invertible,
+    const tnsr::I<DataVector, dim, TargetFrame>& target_points,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const noexcept {
+  const size_t number_of_points = get<0>(target_points).size();
+  is_invertible->assign(number_of_points, true);
+  std::array<DataVector, dim> mapped_points{};
+  for (size_t d = 0; d < dim; ++d) {
+    gsl::at(mapped_points, d) = target_points.get(d);
+  }
+  inverse_impl(make_not_null(&mapped_points), is_invertible, time,
+               functions_of_time, std::make_index_sequence<sizeof...(Maps)>{});
+  for (size_t d = 0; d < dim; ++d) {
+    source_points->get(d) = std::move(gsl::at(mapped_points, d));
+  }
+}
+
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+void CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
+    const gsl::not_null<std::array<DataVector, dim>*> mapped_points,
+    const gsl::not_null<std::vector<bool>*> is_invertible, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const noexcept {
+  // this is the inverse function, so the iterator sequence below is reversed
+  EXPAND_PACK_LEFT_TO_RIGHT(CoordinateMap_detail::apply_inverse(
+      mapped_points, is_invertible,
+      std::get<sizeof...(Maps) - 1 - Is>(maps_), time, functions_of_time));
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
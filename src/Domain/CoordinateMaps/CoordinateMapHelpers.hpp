@@ -4,17 +4,23 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 namespace domain {
@@ -262,5 +268,70 @@ auto apply_inverse_jacobian(
   return identity<Dim>(dereference_wrapper(source_points[0]));
 }
 /// @}
+
+CREATE_IS_CALLABLE(inverse)
+CREATE_IS_CALLABLE_V(inverse)
+
+/// Apply the inverse of the map to all points in `points` for which
+/// `is_invertible` is `true`, setting it to `false` where the inverse fails.
+/// Maps can invert all points at once by providing an overload of `inverse`
+/// that takes the points and the mask by `gsl::not_null` (followed by the
+/// time and functions of time for time-dependent maps). Otherwise the
+/// pointwise inverse is called at each point.
+template <size_t Dim, typename Map>
+void apply_inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> points,
+    const gsl::not_null<std::vector<bool>*> is_invertible, const Map& the_map,
+    const double t,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) noexcept {
+  using FunctionsOfTimeMap = std::unordered_map<
+      std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>;
+  constexpr bool is_time_dependent = domain::is_map_time_dependent_v<Map>;
+  if constexpr (is_time_dependent) {
+    if constexpr (is_inverse_callable_v<
+                      Map, gsl::not_null<std::array<DataVector, Dim>*>,
+                      gsl::not_null<std::vector<bool>*>, double,
+                      FunctionsOfTimeMap>) {
+      the_map.inverse(points, is_invertible, t, functions_of_time);
+      return;
+    }
+  } else {
+    (void)t;
+    (void)functions_of_time;
+    if (UNLIKELY(the_map.is_identity())) {
+      return;
+    }
+    if constexpr (is_inverse_callable_v<
+                      Map, gsl::not_null<std::array<DataVector, Dim>*>,
+                      gsl::not_null<std::vector<bool>*>>) {
+      the_map.inverse(points, is_invertible);
+      return;
+    }
+  }
+  std::array<double, Dim> point{};
+  for (size_t s = 0; s < is_invertible->size(); ++s) {
+    if (not(*is_invertible)[s]) {
+      continue;
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(point, d) = gsl::at(*points, d)[s];
+    }
+    std::optional<std::array<double, Dim>> source_point{};
+    if constexpr (is_time_dependent) {
+      source_point = the_map.inverse(point, t, functions_of_time);
+    } else {
+      source_point = the_map.inverse(point);
+    }
+    if (source_point.has_value()) {
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(*points, d)[s] = gsl::at(*source_point, d);
+      }
+    } else {
+      (*is_invertible)[s] = false;
+    }
+  }
+}
 }  // namespace CoordinateMap_detail
 }  // namespace domain
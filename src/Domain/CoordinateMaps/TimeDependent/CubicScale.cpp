@@ -3,8 +3,11 @@
 
 #include "Domain/CoordinateMaps/TimeDependent/CubicScale.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -13,6 +16,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -202,6 +206,118 @@ std::optional<std::array<double, Dim>> CubicScale<Dim>::inverse(
   return {std::move(result)};
 }
 
+template <size_t Dim>
+void CubicScale<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> coords,
+    const gsl::not_null<std::vector<bool>*> is_invertible, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const noexcept {
+  ASSERT(functions_of_time.find(f_of_t_a_) != functions_of_time.end(),
+         "Could not find function of time: '"
+             << f_of_t_a_ << "' in functions of time. Known functions are "
+             << keys_of(functions_of_time));
+  ASSERT(functions_of_time.find(f_of_t_b_) != functions_of_time.end(),
+         "Could not find function of time: '"
+             << f_of_t_b_ << "' in functions of time. Known functions are "
+             << keys_of(functions_of_time));
+  const size_t number_of_points = (*coords)[0].size();
+  ASSERT(is_invertible->size() == number_of_points,
+         "The mask has " << is_invertible->size() << " entries but there are "
+                         << number_of_points << " points.");
+
+  const double a_of_t = functions_of_time.at(f_of_t_a_)->func(time)[0][0];
+  if (functions_of_time_equal_) {
+    // optimization for linear radial scaling
+    const double one_over_a_of_t = 1.0 / a_of_t;
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(*coords, i) *= one_over_a_of_t;
+    }
+    return;
+  }
+
+  const double b_of_t = functions_of_time.at(f_of_t_b_)->func(time)[0][0];
+  if (a_of_t <= 0.0) {
+    ERROR("We require expansion_a > 0 for invertibility, however expansion_a = "
+          << a_of_t << ".");
+  }
+  if (b_of_t < 2.0 / 3.0 * a_of_t or b_of_t <= 0.0) {
+    ERROR("The map is invertible only if 0 < expansion_b < expansion_a*2/3, "
+          << " but expansion_b = " << b_of_t << " and expansion_a = " << a_of_t
+          << ".");
+  }
+
+  // See the pointwise inverse for the equation that is solved. Here the
+  // Newton-Raphson iterations are done for all points at once. Points that
+  // have converged, or that are outside the range of the map, are no longer
+  // updated, and the rare point that doesn't converge falls back to the
+  // safeguarded pointwise root find.
+  const DataVector target_dimensionless_radius =
+      magnitude(*coords) * one_over_outer_boundary_;
+  const double cubic_coef_a = (b_of_t - a_of_t);
+  DataVector source_dimensionless_radius = target_dimensionless_radius / b_of_t;
+  std::vector<bool> is_converged(number_of_points, false);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (not(*is_invertible)[s]) {
+      is_converged[s] = true;
+    } else if (UNLIKELY(target_dimensionless_radius[s] >
+                        b_of_t * (1.0 + 2.0 * std::numeric_limits<
+                                                  double>::epsilon()))) {
+      (*is_invertible)[s] = false;
+      is_converged[s] = true;
+    } else if (UNLIKELY(target_dimensionless_radius[s] == 0.0)) {
+      is_converged[s] = true;
+    }
+  }
+  constexpr size_t maximum_iterations = 50;
+  bool all_converged = false;
+  DataVector correction{number_of_points};
+  for (size_t iteration = 0; iteration < maximum_iterations and
+                             not all_converged;
+       ++iteration) {
+    correction = (source_dimensionless_radius *
+                      (cubic_coef_a * square(source_dimensionless_radius) +
+                       a_of_t) -
+                  target_dimensionless_radius) /
+                 (3.0 * cubic_coef_a * square(source_dimensionless_radius) +
+                  a_of_t);
+    all_converged = true;
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (is_converged[s]) {
+        continue;
+      }
+      const double previous = source_dimensionless_radius[s];
+      source_dimensionless_radius[s] =
+          std::clamp(previous - correction[s], 0.0, 1.0);
+      is_converged[s] = std::abs(source_dimensionless_radius[s] - previous) <=
+                        1.0e-14 * source_dimensionless_radius[s];
+      all_converged = all_converged and is_converged[s];
+    }
+  }
+
+  std::array<double, Dim> point{};
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (not(*is_invertible)[s] or target_dimensionless_radius[s] == 0.0) {
+      continue;
+    }
+    if (UNLIKELY(not is_converged[s])) {
+      for (size_t i = 0; i < Dim; ++i) {
+        gsl::at(point, i) = gsl::at(*coords, i)[s];
+      }
+      point = inverse(point, time, functions_of_time).value();
+      for (size_t i = 0; i < Dim; ++i) {
+        gsl::at(*coords, i)[s] = gsl::at(point, i);
+      }
+      continue;
+    }
+    const double scale_factor =
+        source_dimensionless_radius[s] / target_dimensionless_radius[s];
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(*coords, i)[s] *= scale_factor;
+    }
+  }
+}
+
 template <size_t Dim>
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, Dim> CubicScale<Dim>::frame_velocity(
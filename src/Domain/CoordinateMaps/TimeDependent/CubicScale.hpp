@@ -10,11 +10,14 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace domain {
 namespace FunctionsOfTime {
 class FunctionOfTime;
@@ -125,6 +128,18 @@ class CubicScale {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const noexcept;
 
+  /// Applies the inverse to all points in `coords` at once, solving the
+  /// cubic equations for all points in lockstep. Only points for which
+  /// `is_invertible` is `true` are used, and `is_invertible` is set to `false`
+  /// for points that are outside the range of the map.
+  void inverse(
+      gsl::not_null<std::array<DataVector, Dim>*> coords,
+      gsl::not_null<std::vector<bool>*> is_invertible, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time) const noexcept;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, Dim> frame_velocity(
       const std::array<T, Dim>& source_coords, double time,
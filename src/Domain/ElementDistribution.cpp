@@ -6,12 +6,16 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <numeric>
 #include <utility>
 #include <vector>
 
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
 namespace domain {
@@ -89,6 +93,72 @@ size_t z_curve_index(const ElementId<Dim>& element_id) noexcept {
   }
   return element_order_index;
 }
+
+// The index of the element along a Hilbert curve through its block. The
+// coordinates of the element are first scaled to the most-refined dimension,
+// so for anisotropic refinement the elements are ordered by the position of
+// their lower corner along the curve through the most-refined dimension.
+//
+// This uses the algorithm of Skilling (2004), which transforms the
+// coordinates in place into the "transposed" Hilbert index, whose bits are
+// then interleaved.
+template <size_t Dim>
+size_t hilbert_curve_index(const ElementId<Dim>& element_id) noexcept {
+  size_t number_of_bits = 0;
+  for (size_t i = 0; i < Dim; ++i) {
+    number_of_bits = std::max(number_of_bits,
+                              element_id.segment_id(i).refinement_level());
+  }
+  if (number_of_bits == 0) {
+    return 0;
+  }
+  std::array<size_t, Dim> x{};
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(x, i) =
+        element_id.segment_id(i).index()
+        << (number_of_bits - element_id.segment_id(i).refinement_level());
+  }
+
+  const size_t highest_bit = two_to_the(number_of_bits - 1);
+  // undo the excess work of the inverse transform
+  for (size_t q = highest_bit; q > 1; q >>= 1) {
+    const size_t p = q - 1;
+    for (size_t i = 0; i < Dim; ++i) {
+      if ((gsl::at(x, i) & q) != 0) {
+        x[0] ^= p;
+      } else {
+        const size_t t = (x[0] ^ gsl::at(x, i)) & p;
+        x[0] ^= t;
+        gsl::at(x, i) ^= t;
+      }
+    }
+  }
+  // Gray encode
+  for (size_t i = 1; i < Dim; ++i) {
+    gsl::at(x, i) ^= gsl::at(x, i - 1);
+  }
+  size_t t = 0;
+  for (size_t q = highest_bit; q > 1; q >>= 1) {
+    if ((gsl::at(x, Dim - 1) & q) != 0) {
+      t ^= q - 1;
+    }
+  }
+  for (size_t i = 0; i < Dim; ++i) {
+    gsl::at(x, i) ^= t;
+  }
+
+  // Interleave the bits, starting from the most significant bit of the first
+  // dimension. With at most 16 refinement levels in each of at most three
+  // dimensions this does not overflow.
+  size_t element_order_index = 0;
+  for (size_t bit_index = number_of_bits; bit_index-- > 0;) {
+    for (size_t i = 0; i < Dim; ++i) {
+      element_order_index =
+          (element_order_index << 1) | ((gsl::at(x, i) >> bit_index) & 1);
+    }
+  }
+  return element_order_index;
+}
 }  // namespace
 
 template <size_t Dim>
@@ -158,10 +228,87 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "Processor not successfully chosen. This indicates a flaw in the logic "
       "of BlockZCurveProcDistribution.");
 }
+
+template <size_t Dim>
+WeightedHilbertCurveProcDistribution<Dim>::WeightedHilbertCurveProcDistribution(
+    const size_t number_of_procs,
+    const std::vector<std::array<size_t, Dim>>& refinements_by_block,
+    const std::function<double(const ElementId<Dim>&)>& element_cost) noexcept
+    : block_element_distribution_(refinements_by_block.size()) {
+  ASSERT(not refinements_by_block.empty(),
+         "`refinements_by_block` must be non-empty.");
+  ASSERT(number_of_procs > 0, "There must be at least one processor.");
+  // The elements of each block, with their index along the Hilbert curve and
+  // their cost, sorted along the curve
+  std::vector<std::vector<std::pair<size_t, double>>> curve_by_block(
+      refinements_by_block.size());
+  double total_cost = 0.0;
+  for (size_t block_id = 0; block_id < refinements_by_block.size();
+       ++block_id) {
+    const std::vector<ElementId<Dim>> element_ids =
+        initial_element_ids(block_id, refinements_by_block[block_id]);
+    auto& curve = curve_by_block[block_id];
+    curve.reserve(element_ids.size());
+    for (const auto& element_id : element_ids) {
+      const double cost = element_cost ? element_cost(element_id) : 1.0;
+      ASSERT(cost > 0.0, "The cost of element " << element_id << " is "
+                                                << cost
+                                                << ", but must be positive.");
+      curve.emplace_back(hilbert_curve_index(element_id), cost);
+      total_cost += cost;
+    }
+    alg::sort(curve, [](const std::pair<size_t, double>& lhs,
+                        const std::pair<size_t, double>& rhs) noexcept {
+      return lhs.first < rhs.first;
+    });
+  }
+
+  // Each element is assigned to the processor whose share of the total cost
+  // contains the midpoint of the element's cost interval along the curve.
+  // This keeps the intervals contiguous and the cost per processor within
+  // the cost of one element of the average.
+  const double cost_per_proc =
+      total_cost / static_cast<double>(number_of_procs);
+  double cost_so_far = 0.0;
+  for (size_t block_id = 0; block_id < curve_by_block.size(); ++block_id) {
+    auto& distribution = block_element_distribution_[block_id];
+    for (const auto& [curve_index, cost] : curve_by_block[block_id]) {
+      const size_t proc = std::min(
+          static_cast<size_t>((cost_so_far + 0.5 * cost) / cost_per_proc),
+          number_of_procs - 1);
+      if (distribution.empty() or distribution.back().second != proc) {
+        distribution.emplace_back(curve_index, proc);
+      }
+      cost_so_far += cost;
+    }
+  }
+}
+
+template <size_t Dim>
+size_t WeightedHilbertCurveProcDistribution<Dim>::get_proc_for_element(
+    const ElementId<Dim>& element_id) const noexcept {
+  const size_t element_order_index = hilbert_curve_index(element_id);
+  const auto& distribution =
+      gsl::at(block_element_distribution_, element_id.block_id());
+  // Find the last interval that starts at or before the element
+  const auto interval = std::upper_bound(
+      distribution.begin(), distribution.end(), element_order_index,
+      [](const size_t index, const std::pair<size_t, size_t>& start) noexcept {
+        return index < start.first;
+      });
+  ASSERT(interval != distribution.begin(),
+         "Processor not successfully chosen for element "
+             << element_id
+             << ". This indicates a flaw in the logic of "
+                "WeightedHilbertCurveProcDistribution.");
+  return std::prev(interval)->second;
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(r, data) \
-  template class BlockZCurveProcDistribution<GET_DIM(data)>;
+#define INSTANTIATION(r, data)                             \
+  template class BlockZCurveProcDistribution<GET_DIM(data)>; \
+  template class WeightedHilbertCurveProcDistribution<GET_DIM(data)>;
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
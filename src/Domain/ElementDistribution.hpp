@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -108,4 +109,54 @@ struct BlockZCurveProcDistribution {
   std::vector<std::vector<std::pair<size_t, size_t>>>
       block_element_distribution_;
 };
+
+/*!
+ * \brief Distribution strategy for assigning elements to CPUs using a Hilbert
+ * space-filling curve, balancing the total cost of the elements on each
+ * processor.
+ *
+ * \details The elements of each block are ordered along a Hilbert curve, and
+ * the curves of all blocks are joined in order of the block ids to traverse
+ * the whole domain. Each element is given a cost by `element_cost`, e.g. its
+ * number of grid points, possibly scaled by the expense of the numerical
+ * method used on the element or the type of its block. The curve is then cut
+ * into `number_of_procs` contiguous intervals of approximately equal total
+ * cost, so processors are assigned equal amounts of work rather than equal
+ * numbers of elements. If no `element_cost` is given, all elements have the
+ * same cost, and the number of elements on each processor differs by at most
+ * one.
+ *
+ * In contrast to the Morton curve used by `BlockZCurveProcDistribution`,
+ * consecutive elements along a Hilbert curve are always face neighbors, so
+ * the elements that a processor is assigned within a block form a single
+ * orthogonally connected cluster (for blocks that have the same refinement
+ * level in all dimensions). For anisotropic refinement the curve of the
+ * most-refined dimension is used, and elements are ordered by their position
+ * along it.
+ *
+ * The curve is computed with the algorithm in \cite Skilling2004, which works
+ * in any number of dimensions.
+ *
+ * \note The block ids only determine the order in which blocks are traversed,
+ * so the distribution clusters elements across blocks best if blocks with
+ * nearby ids are neighbors, which is the case for most domain creators.
+ */
+template <size_t Dim>
+struct WeightedHilbertCurveProcDistribution {
+  WeightedHilbertCurveProcDistribution(
+      size_t number_of_procs,
+      const std::vector<std::array<size_t, Dim>>& refinements_by_block,
+      const std::function<double(const ElementId<Dim>&)>& element_cost =
+          {}) noexcept;
+
+  /// Gets the suggested processor number for a particular element
+  size_t get_proc_for_element(const ElementId<Dim>& element_id) const noexcept;
+
+ private:
+  // For each block, the index along the Hilbert curve of the first element
+  // of each interval of elements that is assigned to a processor, and the
+  // processor number, sorted by the index along the curve
+  std::vector<std::vector<std::pair<size_t, size_t>>>
+      block_element_distribution_;
+};
 }  // namespace domain
@@ -4,11 +4,17 @@
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
+#include <thread>
+#include <tuple>
 #include <utility>  // IWYU pragma: keep
 
 #include "DataStructures/DataVector.hpp"
@@ -27,6 +33,25 @@ PiecewisePolynomial<MaxDeriv>::PiecewisePolynomial(
     : deriv_info_at_update_times_{{t, std::move(initial_func_and_derivs)}},
       expiration_time_(expiration_time) {}
 
+template <size_t MaxDeriv>
+PiecewisePolynomial<MaxDeriv>::PiecewisePolynomial(
+    const PiecewisePolynomial& rhs) noexcept
+    : FunctionOfTime(rhs),
+      deriv_info_at_update_times_(rhs.deriv_info_at_update_times_),
+      expiration_time_(rhs.expiration_time_) {}
+
+template <size_t MaxDeriv>
+PiecewisePolynomial<MaxDeriv>& PiecewisePolynomial<MaxDeriv>::operator=(
+    const PiecewisePolynomial& rhs) noexcept {
+  if (this != &rhs) {
+    FunctionOfTime::operator=(rhs);
+    deriv_info_at_update_times_ = rhs.deriv_info_at_update_times_;
+    expiration_time_ = rhs.expiration_time_;
+    cache_ = std::make_unique<Cache>();
+  }
+  return *this;
+}
+
 template <size_t MaxDeriv>
 std::unique_ptr<FunctionOfTime> PiecewisePolynomial<MaxDeriv>::get_clone()
     const noexcept {
@@ -70,6 +95,64 @@ PiecewisePolynomial<MaxDeriv>::func_and_derivs(const double t) const noexcept {
   return result;
 }
 
+template <size_t MaxDeriv>
+template <size_t MaxDerivReturned>
+std::array<DataVector, MaxDerivReturned + 1>
+PiecewisePolynomial<MaxDeriv>::cached_func_and_derivs(
+    const double t) const noexcept {
+  static_assert(MaxDerivReturned <= 2,
+                "Only the function and its first two derivatives are cached.");
+  auto& cache = std::get<MaxDerivReturned>(*cache_);
+
+  // Looks up the time in the cache. A reader only registers with the slot that
+  // holds the time, and does so before loading its entry, so a thread that
+  // replaces the entry sees the reader and waits for it to finish.
+  const auto find_in_cache = [&cache, &t]() noexcept
+      -> std::optional<std::array<DataVector, MaxDerivReturned + 1>> {
+    for (auto& slot : cache.slots) {
+      if (slot.time.load() != t) {
+        continue;
+      }
+      slot.number_of_readers.fetch_add(1);
+      const auto* const entry = slot.entry.load();
+      // The slot may have been replaced since its time was checked
+      if (entry != nullptr and entry->time == t) {
+        auto result = entry->func_and_derivs;
+        slot.number_of_readers.fetch_sub(1);
+        return result;
+      }
+      slot.number_of_readers.fetch_sub(1);
+    }
+    return std::nullopt;
+  };
+  if (auto cached = find_in_cache(); cached.has_value()) {
+    return std::move(*cached);
+  }
+
+  auto result = func_and_derivs<MaxDerivReturned>(t);
+  // Threads that miss at the same time evaluate concurrently, but only fill a
+  // slot if no other thread has done so in the meantime
+  if (find_in_cache().has_value()) {
+    return result;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+  auto* const new_entry = new CacheEntry<MaxDerivReturned>{t, result};
+  auto& slot = gsl::at(cache.slots,
+                       cache.next_slot.fetch_add(1) % number_of_cached_times);
+  // Invalidating the time first means that no new readers register with the
+  // slot, so the wait below only covers the readers that registered before
+  // the entry was replaced and finishes even under continuous reads. The time
+  // is published only after the wait for the same reason.
+  slot.time.store(std::numeric_limits<double>::quiet_NaN());
+  const std::unique_ptr<const CacheEntry<MaxDerivReturned>> replaced_entry{
+      slot.entry.exchange(new_entry)};
+  while (slot.number_of_readers.load() != 0) {
+    std::this_thread::yield();
+  }
+  slot.time.store(t);
+  return result;
+}
+
 template <size_t MaxDeriv>
 void PiecewisePolynomial<MaxDeriv>::update(
     // Clang-tidy says to use 'const DataVector& updated_max_deriv'.
@@ -125,6 +208,8 @@ void PiecewisePolynomial<MaxDeriv>::update(
 
   func[MaxDeriv] = std::move(updated_max_deriv);
   deriv_info_at_update_times_.emplace_back(time_of_update, std::move(func));
+  // The derivative that was updated changes at `time_of_update`
+  cache_ = std::make_unique<Cache>();
 }
 
 template <size_t MaxDeriv>
@@ -198,6 +283,9 @@ void PiecewisePolynomial<MaxDeriv>::pup(PUP::er& p) {
   FunctionOfTime::pup(p);
   p | deriv_info_at_update_times_;
   p | expiration_time_;
+  if (p.isUnpacking()) {
+    cache_ = std::make_unique<Cache>();
+  }
 }
 
 template <size_t MaxDeriv>
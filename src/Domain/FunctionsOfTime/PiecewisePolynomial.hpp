@@ -4,10 +4,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <limits>
 #include <memory>
 #include <pup.h>
+#include <tuple>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
@@ -18,6 +20,13 @@ namespace domain {
 namespace FunctionsOfTime {
 /// \ingroup ComputationalDomainGroup
 /// \brief A function that has a piecewise-constant `MaxDeriv`th derivative.
+///
+/// Evaluations of the function and of its first one or two derivatives are
+/// cached separately for the `number_of_cached_times` most recently evaluated
+/// times, since all elements that share the function (e.g. through the
+/// `Parallel::GlobalCache`) evaluate it at the same few substep times. Reading
+/// the cache doesn't take a lock, so it can be used concurrently from multiple
+/// threads. The cache is cleared when the function is updated.
 template <size_t MaxDeriv>
 class PiecewisePolynomial : public FunctionOfTime {
  public:
@@ -29,8 +38,9 @@ class PiecewisePolynomial : public FunctionOfTime {
   ~PiecewisePolynomial() override = default;
   PiecewisePolynomial(PiecewisePolynomial&&) noexcept = default;
   PiecewisePolynomial& operator=(PiecewisePolynomial&&) noexcept = default;
-  PiecewisePolynomial(const PiecewisePolynomial&) = default;
-  PiecewisePolynomial& operator=(const PiecewisePolynomial&) = default;
+  // The cache isn't copied, so copies can be made while other threads use it
+  PiecewisePolynomial(const PiecewisePolynomial& rhs) noexcept;
+  PiecewisePolynomial& operator=(const PiecewisePolynomial& rhs) noexcept;
 
   explicit PiecewisePolynomial(CkMigrateMessage* /*unused*/) {}
 
@@ -42,19 +52,21 @@ class PiecewisePolynomial : public FunctionOfTime {
 
   /// Returns the function at an arbitrary time `t`.
   std::array<DataVector, 1> func(double t) const noexcept override {
-    return func_and_derivs<0>(t);
+    return cached_func_and_derivs<0>(t);
   }
   /// Returns the function and its first derivative at an arbitrary time `t`.
   std::array<DataVector, 2> func_and_deriv(double t) const noexcept override {
-    return func_and_derivs<1>(t);
+    return cached_func_and_derivs<1>(t);
   }
   /// Returns the function and the first two derivatives at an arbitrary time
   /// `t`.
   std::array<DataVector, 3> func_and_2_derivs(double t) const
       noexcept override {
-    return func_and_derivs<2>(t);
+    return cached_func_and_derivs<2>(t);
   }
 
+  static constexpr size_t number_of_cached_times = 4;
+
   /// Updates the `MaxDeriv`th derivative of the function at the given time.
   /// `updated_max_deriv` is a vector of the `MaxDeriv`ths for each component.
   /// `next_expiration_time` is the next expiration time.
@@ -89,6 +101,47 @@ class PiecewisePolynomial : public FunctionOfTime {
   std::array<DataVector, MaxDerivReturned + 1> func_and_derivs(double t) const
       noexcept;
 
+  /// The function and `MaxDerivReturned` derivatives at a time `t`
+  template <size_t MaxDerivReturned>
+  struct CacheEntry {
+    double time;
+    std::array<DataVector, MaxDerivReturned + 1> func_and_derivs;
+  };
+  /// An entry is only deleted once it has been replaced and no thread is
+  /// reading it anymore. The slot also holds the time of its entry, so readers
+  /// only register with the slot that holds their time. Each slot has its own
+  /// cache line so readers of different slots don't contend.
+  template <size_t MaxDerivReturned>
+  struct alignas(64) CacheSlot {
+    std::atomic<double> time{std::numeric_limits<double>::quiet_NaN()};
+    std::atomic<const CacheEntry<MaxDerivReturned>*> entry{nullptr};
+    std::atomic<size_t> number_of_readers{0};
+  };
+  /// The slots for one number of derivatives, which are replaced in turn
+  template <size_t MaxDerivReturned>
+  struct CacheSlots {
+    CacheSlots() = default;
+    CacheSlots(const CacheSlots&) = delete;
+    CacheSlots& operator=(const CacheSlots&) = delete;
+    CacheSlots(CacheSlots&&) = delete;
+    CacheSlots& operator=(CacheSlots&&) = delete;
+    ~CacheSlots() noexcept {
+      for (auto& slot : slots) {
+        delete slot.entry.load();  // NOLINT(cppcoreguidelines-owning-memory)
+      }
+    }
+
+    std::array<CacheSlot<MaxDerivReturned>, number_of_cached_times> slots{};
+    std::atomic<size_t> next_slot{0};
+  };
+  using Cache = std::tuple<CacheSlots<0>, CacheSlots<1>, CacheSlots<2>>;
+
+  /// Returns the function and `MaxDerivReturned` derivatives at the time `t`
+  /// from the cache, evaluating and caching them first if necessary.
+  template <size_t MaxDerivReturned>
+  std::array<DataVector, MaxDerivReturned + 1> cached_func_and_derivs(
+      double t) const noexcept;
+
   // There exists a DataVector for each deriv order that contains
   // the values of that deriv order for all components.
   using value_type = std::array<DataVector, MaxDeriv + 1>;
@@ -121,6 +174,10 @@ class PiecewisePolynomial : public FunctionOfTime {
 
   std::vector<DerivInfo> deriv_info_at_update_times_;
   double expiration_time_{std::numeric_limits<double>::lowest()};
+  // The cache is held by pointer so the class remains movable. It is replaced
+  // by an empty cache when the function changes, which can't happen
+  // concurrently with evaluations.
+  mutable std::unique_ptr<Cache> cache_ = std::make_unique<Cache>();
 };
 
 template <size_t MaxDeriv>
@@ -259,6 +259,7 @@ struct PrepareAndSendMortarData<
         db::get<domain::Tags::Mesh<Dim>>(box),
         db::get<domain::Tags::InverseJacobian<Dim, Frame::Logical,
                                               Frame::Inertial>>(box),
+        db::get<elliptic::dg::Tags::HasConstantJacobian>(box),
         db::get<domain::Tags::Faces<Dim, domain::Tags::FaceNormal<Dim>>>(box),
         db::get<domain::Tags::Faces<
             Dim, domain::Tags::UnnormalizedFaceNormalMagnitude<Dim>>>(box),
@@ -393,6 +394,7 @@ struct ReceiveMortarDataAndApplyOperator<
         db::get<domain::Tags::Mesh<Dim>>(box),
         db::get<domain::Tags::InverseJacobian<Dim, Frame::Logical,
                                               Frame::Inertial>>(box),
+        db::get<elliptic::dg::Tags::HasConstantJacobian>(box),
         db::get<domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>>(
             box),
         db::get<domain::Tags::Faces<
@@ -580,6 +582,7 @@ struct ImposeInhomogeneousBoundaryConditionsOnSource<
         db::get<domain::Tags::Mesh<Dim>>(box),
         db::get<domain::Tags::InverseJacobian<Dim, Frame::Logical,
                                               Frame::Inertial>>(box),
+        db::get<elliptic::dg::Tags::HasConstantJacobian>(box),
         db::get<domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>>(
             box),
         db::get<domain::Tags::Faces<Dim, domain::Tags::FaceNormal<Dim>>>(box),
@@ -44,6 +44,7 @@ namespace elliptic::dg::Actions {
  *   - `domain::Tags::Coordinates<Dim, Frame::Inertial>`
  *   - `domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>`
  *   - `domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>`
+ *   - `elliptic::dg::Tags::HasConstantJacobian`
  *
  * \note This action relies on the `SetupDataBox` aggregated initialization
  * mechanism, so `Actions::SetupDataBox` must be present in the `Initialization`
@@ -21,6 +21,49 @@
 #include "Utilities/TaggedTuple.hpp"
 
 namespace elliptic {
+
+/*!
+ * \brief An `ElementsAllocator` for the `elliptic::DgElementArray` that
+ * places one element per process in turn on the initial refinement levels of
+ * the domain
+ *
+ * A custom `ElementsAllocator` must provide a list of `array_allocation_tags`
+ * that are parsed from options and passed in the `initialization_items`, and
+ * an `apply` function templated on the `ElementArray` that creates the
+ * elements (see e.g. `LinearSolver::multigrid::ElementsAllocator`).
+ */
+template <size_t Dim>
+struct DefaultElementsAllocator {
+  using array_allocation_tags =
+      tmpl::list<domain::Tags::InitialRefinementLevels<Dim>>;
+
+  template <typename ElementArray, typename Metavariables,
+            typename... InitializationTags>
+  static void apply(Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+                    const tuples::TaggedTuple<InitializationTags...>&
+                        initialization_items) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& element_array =
+        Parallel::get_parallel_component<ElementArray>(local_cache);
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(local_cache);
+    const auto& initial_refinement_levels =
+        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items);
+    int which_proc = 0;
+    for (const auto& block : domain.blocks()) {
+      const auto initial_ref_levs = initial_refinement_levels[block.id()];
+      const std::vector<ElementId<Dim>> element_ids =
+          initial_element_ids(block.id(), initial_ref_levs);
+      const int number_of_procs = sys::number_of_procs();
+      for (size_t i = 0; i < element_ids.size(); ++i) {
+        element_array(ElementId<Dim>(element_ids[i]))
+            .insert(global_cache, initialization_items, which_proc);
+        which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+      }
+    }
+    element_array.doneInserting();
+  }
+};
+
 /*!
  * \brief The parallel component responsible for managing the DG elements that
  * compose the computational domain
@@ -28,12 +71,19 @@ namespace elliptic {
  * This parallel component will perform the actions specified by the
  * `PhaseDepActionList`.
  *
+ * The `ElementsAllocator` creates the elements. The default allocator creates
+ * the elements of the domain on its initial refinement levels. Pass
+ * `LinearSolver::multigrid::ElementsAllocator` to create the elements of a
+ * multigrid hierarchy instead.
+ *
  * \note This parallel component is nearly identical to
  * `Evolution/DiscontinuousGalerkin/DgElementArray.hpp` right now, but will
- * likely diverge in the future, for instance to support a multigrid domain.
+ * likely diverge in the future.
  *
  */
-template <class Metavariables, class PhaseDepActionList>
+template <class Metavariables, class PhaseDepActionList,
+          class ElementsAllocator =
+              DefaultElementsAllocator<Metavariables::volume_dim>>
 struct DgElementArray {
   static constexpr size_t volume_dim = Metavariables::volume_dim;
 
@@ -45,7 +95,7 @@ struct DgElementArray {
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
 
   using array_allocation_tags =
-      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>>;
+      typename ElementsAllocator::array_allocation_tags;
 
   using initialization_tags = Parallel::get_initialization_tags<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>,
@@ -54,7 +104,10 @@ struct DgElementArray {
   static void allocate_array(
       Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
       const tuples::tagged_tuple_from_typelist<initialization_tags>&
-          initialization_items) noexcept;
+          initialization_items) noexcept {
+    ElementsAllocator::template apply<DgElementArray>(global_cache,
+                                                      initialization_items);
+  }
 
   static void execute_next_phase(
       const typename Metavariables::Phase next_phase,
@@ -64,32 +117,4 @@ struct DgElementArray {
         .start_phase(next_phase);
   }
 };
-
-template <class Metavariables, class PhaseDepActionList>
-void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
-    Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
-    const tuples::tagged_tuple_from_typelist<initialization_tags>&
-        initialization_items) noexcept {
-  auto& local_cache = *(global_cache.ckLocalBranch());
-  auto& dg_element_array =
-      Parallel::get_parallel_component<DgElementArray>(local_cache);
-  const auto& domain =
-      Parallel::get<domain::Tags::Domain<volume_dim>>(local_cache);
-  const auto& initial_refinement_levels =
-      get<domain::Tags::InitialRefinementLevels<volume_dim>>(
-          initialization_items);
-  int which_proc = 0;
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs = initial_refinement_levels[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    const int number_of_procs = sys::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementId<volume_dim>(element_ids[i]))
-          .insert(global_cache, initialization_items, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
-  }
-  dg_element_array.doneInserting();
-}
 }  // namespace elliptic
@@ -226,6 +226,25 @@ struct MortarData : db::SimpleTag {
 }  // namespace Tags
 
 namespace detail {
+// Elements with a constant inverse Jacobian (e.g. affine maps) contract the
+// fluxes before differentiating, which takes `Dim` times fewer derivatives.
+// Whether the Jacobian is constant is determined once during initialization,
+// see `elliptic::dg::Tags::HasConstantJacobian`.
+template <typename DivVars, typename Fluxes, size_t Dim>
+void flux_divergence(
+    const gsl::not_null<DivVars*> divergence_of_fluxes, const Fluxes& fluxes,
+    const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
+        inv_jacobian,
+    const bool has_constant_jacobian) noexcept {
+  if (has_constant_jacobian) {
+    divergence_with_constant_jacobian(divergence_of_fluxes, fluxes, mesh,
+                                      inv_jacobian);
+  } else {
+    divergence(divergence_of_fluxes, fluxes, mesh, inv_jacobian);
+  }
+}
+
 template <typename System, bool Linearized,
           typename PrimalFields = typename System::primal_fields,
           typename AuxiliaryFields = typename System::auxiliary_fields,
@@ -274,6 +293,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       const Element<Dim>& element, const Mesh<Dim>& mesh,
       const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
           inv_jacobian,
+      const bool has_constant_jacobian,
       const DirectionMap<Dim, tnsr::i<DataVector, Dim>>& face_normals,
       const DirectionMap<Dim, Scalar<DataVector>>& face_normal_magnitudes,
       const ::dg::MortarMap<Dim, Mesh<Dim - 1>>& all_mortar_meshes,
@@ -347,7 +367,8 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
                 expanded_fluxes_args..., get<PrimalVars>(primal_vars)...);
           },
           fluxes_args);
-      divergence(auxiliary_vars, *auxiliary_fluxes, mesh, inv_jacobian);
+      flux_divergence(auxiliary_vars, *auxiliary_fluxes, mesh, inv_jacobian,
+                      has_constant_jacobian);
       // Subtract the sources. Invert signs because the sources computers _add_
       // the sources, i.e. they compute the `+ S_v` term defined above.
       *auxiliary_vars *= -1.;
@@ -605,6 +626,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       const Mesh<Dim>& mesh,
       const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
           inv_jacobian,
+      const bool has_constant_jacobian,
       const Scalar<DataVector>& det_inv_jacobian,
       const DirectionMap<Dim, Scalar<DataVector>>& face_normal_magnitudes,
       const ::dg::MortarMap<Dim, Mesh<Dim - 1>>& all_mortar_meshes,
@@ -737,8 +759,8 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
 
     // Compute the primal equation, i.e. the actual DG operator, by taking the
     // second derivative: -div(F_u(v)) + S_u = f(x)
-    divergence(operator_applied_to_vars, primal_fluxes_corrected, mesh,
-               inv_jacobian);
+    flux_divergence(operator_applied_to_vars, primal_fluxes_corrected, mesh,
+                    inv_jacobian, has_constant_jacobian);
     // This is the sign flip that makes the operator _minus_ the Laplacian for a
     // Poisson system
     *operator_applied_to_vars *= -1.;
@@ -849,6 +871,7 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
       const Element<Dim>& element, const Mesh<Dim>& mesh,
       const InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>&
           inv_jacobian,
+      const bool has_constant_jacobian,
       const Scalar<DataVector>& det_inv_jacobian,
       const DirectionMap<Dim, tnsr::i<DataVector, Dim>>& face_normals,
       const DirectionMap<Dim, Scalar<DataVector>>& face_normal_magnitudes,
@@ -888,16 +911,17 @@ struct DgOperatorImpl<System, Linearized, tmpl::list<PrimalFields...>,
         make_not_null(&unused_aux_vars_buffer),
         make_not_null(&unused_aux_fluxes_buffer),
         make_not_null(&primal_fluxes_buffer), make_not_null(&all_mortar_data),
-        zero_primal_vars, element, mesh, inv_jacobian, face_normals,
-        face_normal_magnitudes, all_mortar_meshes, all_mortar_sizes,
-        temporal_id, apply_boundary_condition, fluxes_args, sources_args,
-        fluxes_args_on_faces);
+        zero_primal_vars, element, mesh, inv_jacobian, has_constant_jacobian,
+        face_normals, face_normal_magnitudes, all_mortar_meshes,
+        all_mortar_sizes, temporal_id, apply_boundary_condition, fluxes_args,
+        sources_args, fluxes_args_on_faces);
     apply_operator<true>(make_not_null(&operator_applied_to_zero_vars),
                          make_not_null(&all_mortar_data), zero_primal_vars,
                          primal_fluxes_buffer, mesh, inv_jacobian,
-                         det_inv_jacobian, face_normal_magnitudes,
-                         all_mortar_meshes, all_mortar_sizes, penalty_parameter,
-                         massive, temporal_id, sources_args);
+                         has_constant_jacobian, det_inv_jacobian,
+                         face_normal_magnitudes, all_mortar_meshes,
+                         all_mortar_sizes, penalty_parameter, massive,
+                         temporal_id, sources_args);
     // Impose the nonlinear (constant) boundary contribution as fixed sources on
     // the RHS of the equations
     *fixed_sources -= operator_applied_to_zero_vars;
@@ -20,6 +20,7 @@
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -40,6 +41,7 @@ void InitializeGeometry<Dim>::operator()(
         InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>*>
         inv_jacobian,
     const gsl::not_null<Scalar<DataVector>*> det_inv_jacobian,
+    const gsl::not_null<bool*> has_constant_jacobian,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
     const std::vector<std::array<size_t, Dim>>& initial_refinement,
     const Domain<Dim>& domain,
@@ -67,6 +69,7 @@ void InitializeGeometry<Dim>::operator()(
   // Jacobian
   *inv_jacobian = element_map->inv_jacobian(*logical_coords);
   *det_inv_jacobian = determinant(*inv_jacobian);
+  *has_constant_jacobian = ::has_constant_jacobian(*inv_jacobian);
 }
 
 template <size_t Dim>
@@ -45,7 +45,8 @@ struct InitializeGeometry {
       domain::Tags::Coordinates<Dim, Frame::Logical>,
       domain::Tags::Coordinates<Dim, Frame::Inertial>,
       domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>,
-      domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>>;
+      domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>,
+      Tags::HasConstantJacobian>;
   using argument_tags = tmpl::list<domain::Tags::InitialExtents<Dim>,
                                    domain::Tags::InitialRefinementLevels<Dim>,
                                    domain::Tags::Domain<Dim>>;
@@ -58,6 +59,7 @@ struct InitializeGeometry {
           InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>*>
           inv_jacobian,
       gsl::not_null<Scalar<DataVector>*> det_inv_jacobian,
+      gsl::not_null<bool*> has_constant_jacobian,
       const std::vector<std::array<size_t, Dim>>& initial_extents,
       const std::vector<std::array<size_t, Dim>>& initial_refinement,
       const Domain<Dim>& domain,
@@ -116,6 +116,7 @@ struct SubdomainOperator
   using prepare_args_tags = tmpl::list<
       domain::Tags::Element<Dim>, domain::Tags::Mesh<Dim>,
       domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>,
+      elliptic::dg::Tags::HasConstantJacobian,
       domain::Tags::Faces<Dim, domain::Tags::FaceNormal<Dim>>,
       domain::Tags::Faces<Dim,
                           domain::Tags::UnnormalizedFaceNormalMagnitude<Dim>>,
@@ -124,6 +125,7 @@ struct SubdomainOperator
   using apply_args_tags = tmpl::list<
       domain::Tags::Mesh<Dim>,
       domain::Tags::InverseJacobian<Dim, Frame::Logical, Frame::Inertial>,
+      elliptic::dg::Tags::HasConstantJacobian,
       domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>,
       domain::Tags::Faces<Dim,
                           domain::Tags::UnnormalizedFaceNormalMagnitude<Dim>>,
@@ -70,5 +70,14 @@ struct Massive : db::SimpleTag {
   static bool create_from_options(const bool value) noexcept { return value; }
 };
 
+/// Whether or not the inverse Jacobian of the element is the same at all grid
+/// points, e.g. because the element map is affine. The DG operator takes a
+/// cheaper divergence on such elements.
+///
+/// \see divergence_with_constant_jacobian
+struct HasConstantJacobian : db::SimpleTag {
+  using type = bool;
+};
+
 }  // namespace Tags
 }  // namespace elliptic::dg
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -377,14 +378,33 @@ ComputeTimeDerivative<Metavariables>::apply(
   // obtained using continuous RK methods, and so we will want to reuse
   // buffers. Thus, the volume_terms function returns by reference rather than
   // by value.
-  Variables<typename compute_volume_time_derivative_terms::temporary_tags>
-      temporaries{mesh.number_of_grid_points()};
-  Variables<db::wrap_tags_in<::Tags::Flux, flux_variables,
-                             tmpl::size_t<volume_dim>, Frame::Inertial>>
-      volume_fluxes{mesh.number_of_grid_points()};
-  Variables<db::wrap_tags_in<::Tags::deriv, partial_derivative_tags,
-                             tmpl::size_t<volume_dim>, Frame::Inertial>>
-      partial_derivs{mesh.number_of_grid_points()};
+  //
+  // The buffers are only needed during this action, so they are taken from the
+  // arena of this thread instead of the heap.
+  using TemporariesVars =
+      Variables<typename compute_volume_time_derivative_terms::temporary_tags>;
+  using FluxesVars =
+      Variables<db::wrap_tags_in<::Tags::Flux, flux_variables,
+                                 tmpl::size_t<volume_dim>, Frame::Inertial>>;
+  using PartialDerivsVars =
+      Variables<db::wrap_tags_in<::Tags::deriv, partial_derivative_tags,
+                                 tmpl::size_t<volume_dim>, Frame::Inertial>>;
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Arena& arena = Arena::local();
+  const ArenaScope arena_scope{make_not_null(&arena)};
+  TemporariesVars temporaries{
+      arena.allocate<double>(number_of_grid_points *
+                             TemporariesVars::number_of_independent_components),
+      number_of_grid_points};
+  FluxesVars volume_fluxes{
+      arena.allocate<double>(number_of_grid_points *
+                             FluxesVars::number_of_independent_components),
+      number_of_grid_points};
+  PartialDerivsVars partial_derivs{
+      arena.allocate<double>(
+          number_of_grid_points *
+          PartialDerivsVars::number_of_independent_components),
+      number_of_grid_points};
 
   const Scalar<DataVector>* det_inverse_jacobian = nullptr;
   if constexpr (tmpl::size<flux_variables>::value != 0) {
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <vector>
 
 #include "Domain/Block.hpp"
@@ -24,6 +25,8 @@
 namespace detail {
 CREATE_HAS_STATIC_MEMBER_VARIABLE(use_z_order_distribution)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_z_order_distribution)
+CREATE_HAS_STATIC_MEMBER_VARIABLE(use_hilbert_curve_distribution)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_hilbert_curve_distribution)
 }  // namespace detail
 
 /*!
@@ -37,7 +40,11 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE_V(use_z_order_distribution)
  * `domain::BlockZCurveProcDistribution` (using a Morton space-filling curve),
  * unless `static constexpr bool use_z_order_distribution = false;` is specified
  * in the `Metavariables`, in which case elements are assigned to processors via
- * round-robin assignment.
+ * round-robin assignment. If instead
+ * `static constexpr bool use_hilbert_curve_distribution = true;` is specified,
+ * elements are assigned by `domain::WeightedHilbertCurveProcDistribution`
+ * (using a Hilbert space-filling curve), weighting each element by its initial
+ * number of grid points.
  */
 template <class Metavariables, class PhaseDepActionList>
 struct DgElementArray {
@@ -51,7 +58,8 @@ struct DgElementArray {
   using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>>;
 
   using array_allocation_tags =
-      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>>;
+      tmpl::list<domain::Tags::InitialRefinementLevels<volume_dim>,
+                 domain::Tags::InitialExtents<volume_dim>>;
 
   using initialization_tags = Parallel::get_initialization_tags<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>,
@@ -88,14 +96,41 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
   if constexpr (detail::has_use_z_order_distribution_v<Metavariables>) {
     use_z_order_distribution = Metavariables::use_z_order_distribution;
   }
+  bool use_hilbert_curve_distribution = false;
+  if constexpr (detail::has_use_hilbert_curve_distribution_v<Metavariables>) {
+    use_hilbert_curve_distribution =
+        Metavariables::use_hilbert_curve_distribution;
+  }
   int which_proc = 0;
   const domain::BlockZCurveProcDistribution<volume_dim> element_distribution{
       static_cast<size_t>(sys::number_of_procs()), initial_refinement_levels};
+  std::optional<domain::WeightedHilbertCurveProcDistribution<volume_dim>>
+      weighted_element_distribution{};
+  if (use_hilbert_curve_distribution) {
+    const auto& initial_extents =
+        get<domain::Tags::InitialExtents<volume_dim>>(initialization_items);
+    weighted_element_distribution.emplace(
+        static_cast<size_t>(sys::number_of_procs()), initial_refinement_levels,
+        [&initial_extents](const ElementId<volume_dim>& element_id) noexcept {
+          double number_of_grid_points = 1.0;
+          for (const size_t extent : initial_extents[element_id.block_id()]) {
+            number_of_grid_points *= static_cast<double>(extent);
+          }
+          return number_of_grid_points;
+        });
+  }
   for (const auto& block : domain.blocks()) {
     const auto initial_ref_levs = initial_refinement_levels[block.id()];
     const std::vector<ElementId<volume_dim>> element_ids =
         initial_element_ids(block.id(), initial_ref_levs);
-    if (use_z_order_distribution) {
+    if (use_hilbert_curve_distribution) {
+      for (const auto& element_id : element_ids) {
+        const size_t target_proc =
+            weighted_element_distribution->get_proc_for_element(element_id);
+        dg_element_array(element_id)
+            .insert(global_cache, initialization_items, target_proc);
+      }
+    } else if (use_z_order_distribution) {
       for (const auto& element_id : element_ids) {
         const size_t target_proc =
             element_distribution.get_proc_for_element(element_id);
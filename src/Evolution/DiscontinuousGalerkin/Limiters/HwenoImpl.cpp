@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <exception>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/IndexIterator.hpp"
@@ -18,10 +19,10 @@
 #include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
-#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/StaticCache.hpp"
 
 namespace {
 
@@ -254,44 +255,18 @@ const Matrix& ConstrainedFitCache<VolumeDim>::retrieve_inverse_a_matrix(
   }
 }
 
-namespace {
-
-template <size_t VolumeDim, size_t DummyIndex>
-const ConstrainedFitCache<VolumeDim>& constrained_fit_cache_impl(
+template <size_t VolumeDim>
+const ConstrainedFitCache<VolumeDim>& constrained_fit_cache(
     const Mesh<VolumeDim>& mesh, const Element<VolumeDim>& element) noexcept {
-  // For the cache to be valid,
-  // - the mesh must always be the same, so we check it below
+  // For a cached entry to be valid for this element,
+  // - the mesh must be the same
   // - the element can be different, as long as it has the same configuration
-  //   of internal/external boundaries. this is handled in the calling code
-  //   because the boundary configuration sets the value of DummyIndex
-  static const Mesh<VolumeDim> mesh_for_cached_matrix = mesh;
-  ASSERT(mesh_for_cached_matrix == mesh,
-         "This call to constrained_fit_cache_impl received a different Mesh\n"
-         "than was previously cached, suggesting that multiple meshes are\n"
-         "used in the computational domain. This is not (yet) supported.\n"
-         "Cached mesh: "
-             << mesh_for_cached_matrix
-             << "\n"
-                "Argument mesh: "
-             << mesh);
-  static const ConstrainedFitCache<VolumeDim> result(mesh, element);
-  return result;
-}
-
-template <size_t VolumeDim, size_t... Is>
-const ConstrainedFitCache<VolumeDim>& constrained_fit_cache(
-    const Mesh<VolumeDim>& mesh, const Element<VolumeDim>& element,
-    std::index_sequence<Is...> /*dummy_indices*/) noexcept {
-  static const std::array<
-      const ConstrainedFitCache<VolumeDim>& (*)(const Mesh<VolumeDim>&,
-                                                const Element<VolumeDim>&),
-      sizeof...(Is)>
-      cache{{&constrained_fit_cache_impl<VolumeDim, Is>...}};
-
+  //   of internal/external boundaries
+  // so the cache is keyed on the mesh and on this configuration.
+  //
   // Use std::bitset to compute an integer based on the configuration of
-  // internal/external boundaries to the element. This is sort of like a hash
-  // for indexing into the std::array of ConstrainedFitCache's.
-  const size_t index_from_boundary_types = [&element]() noexcept {
+  // internal/external boundaries to the element.
+  const size_t boundary_configuration = [&element]() noexcept {
     std::bitset<2 * VolumeDim> bits;
     for (size_t d = 0; d < VolumeDim; ++d) {
       for (const Side& side : {Side::Lower, Side::Upper}) {
@@ -306,21 +281,15 @@ const ConstrainedFitCache<VolumeDim>& constrained_fit_cache(
     }
     return static_cast<size_t>(bits.to_ulong());
   }();
-  ASSERT(index_from_boundary_types >= 0 and
-             index_from_boundary_types < sizeof...(Is),
-         "Got index_from_boundary_types = "
-             << index_from_boundary_types << ", but expect only "
-             << sizeof...(Is) << " configurations");
-  return gsl::at(cache, index_from_boundary_types)(mesh, element);
-}
-
-}  // namespace
 
-template <size_t VolumeDim>
-const ConstrainedFitCache<VolumeDim>& constrained_fit_cache(
-    const Mesh<VolumeDim>& mesh, const Element<VolumeDim>& element) noexcept {
-  return constrained_fit_cache<VolumeDim>(
-      mesh, element, std::make_index_sequence<two_to_the(2 * VolumeDim)>{});
+  // There are at most 2^(2*VolumeDim) boundary configurations per mesh
+  static const KeyedStaticCache<std::pair<Mesh<VolumeDim>, size_t>,
+                                ConstrainedFitCache<VolumeDim>>
+      cache{};
+  return cache(std::make_pair(mesh, boundary_configuration),
+               [&mesh, &element]() noexcept {
+                 return ConstrainedFitCache<VolumeDim>(mesh, element);
+               });
 }
 
 // Explicit instantiations
@@ -112,6 +112,11 @@ class ConstrainedFitCache {
 };
 
 // Return the appropriate cache for the given mesh and element.
+//
+// The caches are computed on first use and shared by all elements and threads
+// of the process; the returned reference remains valid for the lifetime of the
+// process. Meshes may differ between elements. Retrieving a cache does not
+// lock, but it searches all cached configurations.
 template <size_t VolumeDim>
 const ConstrainedFitCache<VolumeDim>& constrained_fit_cache(
     const Mesh<VolumeDim>& mesh, const Element<VolumeDim>& element) noexcept;
@@ -280,11 +285,14 @@ DataVector b_vector(
 // Solve the constrained fit problem that gives the HWENO modified solution,
 // for one particular tensor component. For details, see documentation of
 // `hweno_modified_neighbor_solution` below.
+//
+// The `fit_cache` must be the `constrained_fit_cache` of the mesh and element.
 template <typename Tag, size_t VolumeDim, typename Package>
 void solve_constrained_fit(
     const gsl::not_null<DataVector*> constrained_fit_result,
     const DataVector& u, const size_t tensor_index, const Mesh<VolumeDim>& mesh,
     const Element<VolumeDim>& element,
+    const ConstrainedFitCache<VolumeDim>& fit_cache,
     const std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, Package,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>&
@@ -300,10 +308,6 @@ void solve_constrained_fit(
          "to exclude from the fit (unless if the element has a single \n"
          "neighbor, which would automatically be the primary neighbor).");
 
-  // Get the cache of linear algebra quantities for this element
-  const ConstrainedFitCache<VolumeDim>& cache =
-      constrained_fit_cache(mesh, element);
-
   // Because we don't support h-refinement, the direction is the only piece
   // of the neighbor information that we actually need.
   const Direction<VolumeDim> primary_direction = primary_neighbor.first;
@@ -316,17 +320,17 @@ void solve_constrained_fit(
         return result;
       }();
 
-  const DataVector& w = cache.quadrature_weights;
+  const DataVector& w = fit_cache.quadrature_weights;
   const DirectionMap<VolumeDim, Matrix>& interp_matrices =
-      cache.interpolation_matrices;
+      fit_cache.interpolation_matrices;
   const DirectionMap<VolumeDim, DataVector>& w_dot_interp_matrices =
-      cache.quadrature_weights_dot_interpolation_matrices;
+      fit_cache.quadrature_weights_dot_interpolation_matrices;
 
   // Use cache if possible, or compute matrix if we are in edge case
   const Matrix& inverse_a =
       LIKELY(directions_to_exclude.size() < 2)
-          ? cache.retrieve_inverse_a_matrix(primary_direction,
-                                            directions_to_exclude)
+          ? fit_cache.retrieve_inverse_a_matrix(primary_direction,
+                                                directions_to_exclude)
           : inverse_a_matrix(mesh, element, w, interp_matrices,
                              w_dot_interp_matrices, primary_direction,
                              directions_to_exclude);
@@ -521,7 +525,9 @@ void solve_constrained_fit(
  *
  * When calling `hweno_impl`, `modified_neighbor_solution_buffer` should contain
  * one DataVector for each neighboring element (i.e. for each entry in
- * `neighbor_data`).
+ * `neighbor_data`), and `fit_cache` should be the `constrained_fit_cache` of
+ * the mesh and element. Retrieve the cache once per limiter call and pass it
+ * to the `hweno_impl` call of each tensor.
  */
 template <typename Tag, size_t VolumeDim, typename PackagedData>
 void hweno_impl(
@@ -532,6 +538,7 @@ void hweno_impl(
     const gsl::not_null<typename Tag::type*> tensor,
     const double neighbor_linear_weight, const Mesh<VolumeDim>& mesh,
     const Element<VolumeDim>& element,
+    const ConstrainedFitCache<VolumeDim>& fit_cache,
     const std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, PackagedData,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>&
@@ -577,8 +584,9 @@ void hweno_impl(
       DataVector& buffer =
           modified_neighbor_solution_buffer->at(primary_neighbor);
       solve_constrained_fit<Tag>(make_not_null(&buffer), tensor_component,
-                                 tensor_index, mesh, element, neighbor_data,
-                                 primary_neighbor, neighbors_to_exclude);
+                                 tensor_index, mesh, element, fit_cache,
+                                 neighbor_data, primary_neighbor,
+                                 neighbors_to_exclude);
     }
 
     // Sum local and modified neighbor polynomials for the WENO reconstruction
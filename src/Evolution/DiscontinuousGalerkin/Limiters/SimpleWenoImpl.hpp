@@ -34,16 +34,16 @@ namespace Limiters::Weno_detail {
 // need to limit only a subset of the tensor components.
 //
 // When calling `simple_weno_impl`,
-// - `interpolator_buffer` may be empty
+// - `interpolant_buffer` may be empty
 // - `modified_neighbor_solution_buffer` should contain one DataVector for each
 //   neighboring element (i.e. for each entry in `neighbor_data`)
 template <typename Tag, size_t VolumeDim, typename PackagedData>
 void simple_weno_impl(
     const gsl::not_null<std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-        intrp::RegularGrid<VolumeDim>,
+        const intrp::RegularGrid<VolumeDim>*,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>*>
-        interpolator_buffer,
+        interpolant_buffer,
     const gsl::not_null<std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>*>
@@ -84,24 +84,25 @@ void simple_weno_impl(
     const auto& neighbor = neighbor_and_data.first;
     const auto& data = neighbor_and_data.second;
 
-    if (interpolator_buffer->find(neighbor) == interpolator_buffer->end()) {
-      // No interpolator found => create one
-      const auto& direction = neighbor.first;
-      const auto& source_mesh = data.mesh;
-      const auto target_1d_logical_coords =
-          Weno_detail::local_grid_points_in_neighbor_logical_coords(
-              mesh, source_mesh, element, direction);
-      interpolator_buffer->insert(std::make_pair(
-          neighbor, intrp::RegularGrid<VolumeDim>(source_mesh, mesh,
-                                                  target_1d_logical_coords)));
+    // The interpolant is shared with all other elements that have the same
+    // meshes and direction to the neighbor. Retrieve it only for the first
+    // limited component and reuse it for the others.
+    auto interpolant_it = interpolant_buffer->find(neighbor);
+    if (interpolant_it == interpolant_buffer->end()) {
+      interpolant_it =
+          interpolant_buffer
+              ->insert(std::make_pair(
+                  neighbor, &Weno_detail::neighbor_to_local_interpolant(
+                                mesh, data.mesh, element, neighbor.first)))
+              .first;
     }
+    const auto& interpolant = *(interpolant_it->second);
 
     // Avoid allocations by working directly in the preallocated buffer
     DataVector& buffer = modified_neighbor_solution_buffer->at(neighbor);
 
-    interpolator_buffer->at(neighbor).interpolate(
-        make_not_null(&buffer),
-        get<Tag>(data.volume_data)[tensor_storage_index]);
+    interpolant.interpolate(make_not_null(&buffer),
+                            get<Tag>(data.volume_data)[tensor_storage_index]);
     const double neighbor_mean = mean_value(buffer, mesh);
     buffer += (local_mean - neighbor_mean);
   }
@@ -119,16 +120,16 @@ void simple_weno_impl(
 // indicator for the whole cell, and apply the limiter to all fields.
 //
 // When calling `simple_weno_impl`,
-// - `interpolator_buffer` may be empty
+// - `interpolant_buffer` may be empty
 // - `modified_neighbor_solution_buffer` should contain one DataVector for each
 //   neighboring element (i.e. for each entry in `neighbor_data`)
 template <typename Tag, size_t VolumeDim, typename PackagedData>
 void simple_weno_impl(
     const gsl::not_null<std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-        intrp::RegularGrid<VolumeDim>,
+        const intrp::RegularGrid<VolumeDim>*,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>*>
-        interpolator_buffer,
+        interpolant_buffer,
     const gsl::not_null<std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>*>
@@ -142,7 +143,7 @@ void simple_weno_impl(
         neighbor_data) noexcept {
   for (size_t tensor_storage_index = 0; tensor_storage_index < tensor->size();
        ++tensor_storage_index) {
-    simple_weno_impl<Tag>(interpolator_buffer,
+    simple_weno_impl<Tag>(interpolant_buffer,
                           modified_neighbor_solution_buffer, tensor,
                           neighbor_linear_weight, tensor_storage_index, mesh,
                           element, neighbor_data);
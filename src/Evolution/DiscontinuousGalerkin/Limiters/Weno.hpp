@@ -403,9 +403,10 @@ bool Weno<VolumeDim, tmpl::list<Tags...>>::operator()(
           make_pair(neighbor, DataVector(mesh.number_of_grid_points())));
     }
 
+    const auto& fit_cache = Weno_detail::constrained_fit_cache(mesh, element);
     EXPAND_PACK_LEFT_TO_RIGHT(Weno_detail::hweno_impl<Tags>(
         make_not_null(&modified_neighbor_solution_buffer), tensors,
-        neighbor_linear_weight_, mesh, element, neighbor_data));
+        neighbor_linear_weight_, mesh, element, fit_cache, neighbor_data));
     return true;  // cell_is_troubled
 
   } else if (weno_type_ == WenoType::SimpleWeno) {
@@ -417,9 +418,9 @@ bool Weno<VolumeDim, tmpl::list<Tags...>>::operator()(
     // Buffers for simple WENO implementation
     std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-        intrp::RegularGrid<VolumeDim>,
+        const intrp::RegularGrid<VolumeDim>*,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
-        interpolator_buffer{};
+        interpolant_buffer{};
     std::unordered_map<
         std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
         boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
@@ -428,7 +429,7 @@ bool Weno<VolumeDim, tmpl::list<Tags...>>::operator()(
     bool some_component_was_limited = false;
 
     const auto wrap_minmod_tci_and_simple_weno_impl =
-        [this, &some_component_was_limited, &tci_buffer, &interpolator_buffer,
+        [this, &some_component_was_limited, &tci_buffer, &interpolant_buffer,
          &modified_neighbor_solution_buffer, &mesh, &element, &element_size,
          &neighbor_data,
          &effective_neighbor_sizes](auto tag, const auto tensor) noexcept {
@@ -454,7 +455,7 @@ bool Weno<VolumeDim, tmpl::list<Tags...>>::operator()(
                 }
               }
               Weno_detail::simple_weno_impl<decltype(tag)>(
-                  make_not_null(&interpolator_buffer),
+                  make_not_null(&interpolant_buffer),
                   make_not_null(&modified_neighbor_solution_buffer), tensor,
                   neighbor_linear_weight_, tensor_storage_index, mesh, element,
                   neighbor_data);
@@ -3,15 +3,19 @@
 
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoGridHelpers.hpp"
 
+#include <tuple>
+
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Structure/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/Element.hpp"    // IWYU pragma: keep
 #include "Domain/Structure/Side.hpp"
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"  // IWYU pragma: keep
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/StaticCache.hpp"
 
 namespace Limiters::Weno_detail {
 
@@ -98,6 +102,30 @@ std::array<DataVector, VolumeDim> local_grid_points_in_neighbor_logical_coords(
   return result;
 }
 
+template <size_t VolumeDim>
+const intrp::RegularGrid<VolumeDim>& neighbor_to_local_interpolant(
+    const Mesh<VolumeDim>& local_mesh, const Mesh<VolumeDim>& neighbor_mesh,
+    const Element<VolumeDim>& element,
+    const Direction<VolumeDim>& direction_to_neighbor) noexcept {
+  ASSERT(check_element_has_one_similar_neighbor_in_direction(
+             element, direction_to_neighbor),
+         "Found some amount of h-refinement; this is not supported");
+  // Only a handful of mesh and direction combinations occur in a domain
+  static const KeyedStaticCache<
+      std::tuple<Mesh<VolumeDim>, Mesh<VolumeDim>, Direction<VolumeDim>>,
+      intrp::RegularGrid<VolumeDim>>
+      cache{};
+  return cache(
+      std::make_tuple(local_mesh, neighbor_mesh, direction_to_neighbor),
+      [&local_mesh, &neighbor_mesh, &element,
+       &direction_to_neighbor]() noexcept {
+        return intrp::RegularGrid<VolumeDim>(
+            neighbor_mesh, local_mesh,
+            local_grid_points_in_neighbor_logical_coords(
+                local_mesh, neighbor_mesh, element, direction_to_neighbor));
+      });
+}
+
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
@@ -110,6 +138,10 @@ std::array<DataVector, VolumeDim> local_grid_points_in_neighbor_logical_coords(
       const Element<DIM(data)>&, const Direction<DIM(data)>&) noexcept; \
   template std::array<DataVector, DIM(data)>                            \
   local_grid_points_in_neighbor_logical_coords(                         \
+      const Mesh<DIM(data)>&, const Mesh<DIM(data)>&,                   \
+      const Element<DIM(data)>&, const Direction<DIM(data)>&) noexcept; \
+  template const intrp::RegularGrid<DIM(data)>&                         \
+  neighbor_to_local_interpolant(                                        \
       const Mesh<DIM(data)>&, const Mesh<DIM(data)>&,                   \
       const Element<DIM(data)>&, const Direction<DIM(data)>&) noexcept;
 
@@ -14,6 +14,10 @@ template <size_t>
 class Element;
 template <size_t>
 class Mesh;
+namespace intrp {
+template <size_t>
+class RegularGrid;
+}  // namespace intrp
 /// \endcond
 
 namespace Limiters::Weno_detail {
@@ -60,4 +64,21 @@ std::array<DataVector, VolumeDim> local_grid_points_in_neighbor_logical_coords(
     const Element<VolumeDim>& element,
     const Direction<VolumeDim>& direction_to_neighbor) noexcept;
 
+// Return the interpolant from a neighbor element's grid points to the local
+// element's grid points, i.e., the RegularGrid interpolant to the points given
+// by `local_grid_points_in_neighbor_logical_coords`.
+//
+// Within the limitations listed above, the interpolant depends only on the two
+// meshes and on the direction to the neighbor, so it is the same for most of
+// the elements in the domain. It is computed once per process and shared by
+// all elements and threads; the returned reference remains valid for the
+// lifetime of the process. Retrieving a cached interpolant does not lock, but
+// it searches the cache, so limiters retrieve it once per neighbor and reuse
+// it for all tensor components.
+template <size_t VolumeDim>
+const intrp::RegularGrid<VolumeDim>& neighbor_to_local_interpolant(
+    const Mesh<VolumeDim>& local_mesh, const Mesh<VolumeDim>& neighbor_mesh,
+    const Element<VolumeDim>& element,
+    const Direction<VolumeDim>& direction_to_neighbor) noexcept;
+
 }  // namespace Limiters::Weno_detail
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <limits>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -103,8 +104,9 @@ void damped_harmonic_impl(
            "dgauge_h_init not being nullptr");
   }
 
-  // Use a TempBuffer to reduce total number of allocations. This is especially
-  // important in a multithreaded environment.
+  // Use a TempBuffer in the local arena to avoid allocating from the heap.
+  // This is especially important in a multithreaded environment.
+  const ArenaScope arena_scope{make_not_null(&Arena::local())};
   TempBuffer<tmpl::list<
       ::Tags::TempA<0, SpatialDim, Frame>, ::Tags::Tempii<1, SpatialDim, Frame>,
       ::Tags::TempAA<2, SpatialDim, Frame>,
@@ -134,7 +136,7 @@ void damped_harmonic_impl(
       ::Tags::Tempab<35, SpatialDim, Frame>,
       ::Tags::Tempab<36, SpatialDim, Frame>,
       ::Tags::Tempab<37, SpatialDim, Frame>>>
-      buffer(get_size(get(lapse)));
+      buffer(get_size(get(lapse)), make_not_null(&Arena::local()));
   auto& spacetime_unit_normal =
       get<::Tags::TempA<0, SpatialDim, Frame>>(buffer);
   auto& spatial_metric = get<::Tags::Tempii<1, SpatialDim, Frame>>(buffer);
@@ -6,8 +6,12 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <limits>
+#include <utility>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -17,6 +21,136 @@
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
+namespace {
+// constant in cubic equation  f(eps) = eps^3 - a eps^2 + d
+// whose root is being found at each point in the iteration below.
+// Negative if the recovery fails.
+double compute_d_in_cubic(
+    const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared) noexcept {
+  const double d_in_cubic =
+      0.5 * (momentum_density_squared * magnetic_field_squared -
+             square(momentum_density_dot_magnetic_field));
+  if (UNLIKELY(-1e-12 * square(momentum_density_dot_magnetic_field) >
+               d_in_cubic)) {
+    return d_in_cubic;  // will fail
+  }
+  return std::max(0.0, d_in_cubic);
+}
+
+// bound needed so cubic equation has a positive root
+double compute_minimum_pressure(const double d_in_cubic,
+                                const double total_energy_density,
+                                const double magnetic_field_squared) noexcept {
+  return std::max(0.0, cbrt(6.75 * d_in_cubic) - total_energy_density -
+                           0.5 * magnetic_field_squared);
+}
+
+struct Primitives {
+  double rest_mass_density;
+  double lorentz_factor;
+  double rho_h_w_squared;
+};
+
+// The primitives at the given pressure, or std::nullopt if there are none
+std::optional<Primitives> primitives_at_pressure(
+    const double pressure, const double total_energy_density,
+    const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared, const double d_in_cubic,
+    const double rest_mass_density_times_lorentz_factor) noexcept {
+  const double a_in_cubic =
+      total_energy_density + pressure + 0.5 * magnetic_field_squared;
+
+  if (UNLIKELY(a_in_cubic < 0.0)) {
+    return std::nullopt;
+  }
+
+  // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
+  const double phi = acos(sqrt(6.75 * d_in_cubic / cube(a_in_cubic)));
+  // NH Eq. (5.11) with l=1 is desired positive root
+  const double root_of_cubic =
+      (a_in_cubic / 3.0) * (1.0 - 2.0 * cos((2.0 / 3.0) * (M_PI + phi)));
+  // NH Eq. (5.5) with their script L being rho_h_w_squared
+  // where rho is rest_mass_density, h is specific_enthalpy,
+  // and w is the lorentz factor
+  const double rho_h_w_squared = root_of_cubic - magnetic_field_squared;
+
+  if (UNLIKELY(rho_h_w_squared <= 0.0)) {
+    return std::nullopt;
+  }
+
+  // NH Eq. (5.2) with (5.5) substituted in denominator
+  const double v_squared =
+      (momentum_density_squared * square(rho_h_w_squared) +
+       square(momentum_density_dot_magnetic_field) *
+           (magnetic_field_squared + 2.0 * rho_h_w_squared)) /
+      square(rho_h_w_squared * root_of_cubic);
+
+  // If this fails, there was code in the Bitbucket version that adjusted
+  // the pressure to get the maximum allowed velocity in atmosphere.
+  // Instead, we could return std::nullopt and try the next inversion method.
+  if (UNLIKELY(v_squared < 0.0 or v_squared >= 1.0)) {
+    return std::nullopt;
+  }
+
+  const double lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
+  return Primitives{rest_mass_density_times_lorentz_factor / lorentz_factor,
+                    lorentz_factor, rho_h_w_squared};
+}
+
+// Less than one if the recovery fails
+double compute_specific_enthalpy(const Primitives& primitives) noexcept {
+  const double specific_enthalpy =
+      primitives.rho_h_w_squared /
+      (primitives.rest_mass_density * square(primitives.lorentz_factor));
+  if (UNLIKELY(1.0 - 1.0e-12 > specific_enthalpy)) {
+    return specific_enthalpy;  // will fail
+  }
+  return std::max(1.0, specific_enthalpy);
+}
+
+// Aitken extrapolation of the sequence of pressures
+class AitkenAcceleration {
+ public:
+  explicit AitkenAcceleration(const double initial_pressure) noexcept
+      : pressures_{{initial_pressure,
+                    std::numeric_limits<double>::signaling_NaN(),
+                    std::numeric_limits<double>::signaling_NaN()}} {}
+
+  // Adds the newest pressure `*current_pressure` to the sequence. If the
+  // extrapolation succeeds, `*current_pressure` is replaced by the
+  // extrapolated pressure and `*previous_pressure` by the newest pressure.
+  void update(const gsl::not_null<double*> current_pressure,
+              const gsl::not_null<double*> previous_pressure) noexcept {
+    gsl::at(pressures_, valid_entries_++) = *current_pressure;
+    if (3 == valid_entries_) {
+      const double aitken_residual = (pressures_[2] - pressures_[1]) /
+                                     (pressures_[1] - pressures_[0]);
+      if (0.0 <= aitken_residual and aitken_residual < 1.0) {
+        *previous_pressure = *current_pressure;
+        *current_pressure =
+            pressures_[1] +
+            (pressures_[2] - pressures_[1]) / (1.0 - aitken_residual);
+        pressures_ = {{*current_pressure,
+                       std::numeric_limits<double>::signaling_NaN(),
+                       std::numeric_limits<double>::signaling_NaN()}};
+        valid_entries_ = 1;
+      } else {
+        // Aitken extrapolation failed, retain latest 2 values for next attempt
+        pressures_[0] = pressures_[1];
+        pressures_[1] = pressures_[2];
+        valid_entries_ = 2;
+      }
+    }
+  }
+
+ private:
+  std::array<double, 3> pressures_;
+  size_t valid_entries_ = 1;
+};
+}  // namespace
 
 template <size_t ThermodynamicDim>
 std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
@@ -27,38 +161,21 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
     const double rest_mass_density_times_lorentz_factor,
     const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
         equation_of_state) noexcept {
-  // constant in cubic equation  f(eps) = eps^3 - a eps^2 + d
-  // whose root is being found at each point in the iteration below
-  const double d_in_cubic = [
-    momentum_density_squared, magnetic_field_squared,
-    momentum_density_dot_magnetic_field
-  ]() noexcept {
-    const double local_d_in_cubic =
-        0.5 * (momentum_density_squared * magnetic_field_squared -
-               square(momentum_density_dot_magnetic_field));
-    if (UNLIKELY(-1e-12 * square(momentum_density_dot_magnetic_field) >
-                 local_d_in_cubic)) {
-      return local_d_in_cubic;  // will fail returning std::nullopt
-    }
-    return std::max(0.0, local_d_in_cubic);
-  }
-  ();
+  const double d_in_cubic =
+      compute_d_in_cubic(momentum_density_squared,
+                         momentum_density_dot_magnetic_field,
+                         magnetic_field_squared);
   if (UNLIKELY(0.0 > d_in_cubic)) {
     return std::nullopt;
   }
 
-  // bound needed so cubic equation has a positive root
-  const double minimum_pressure =
-      std::max(0.0, cbrt(6.75 * d_in_cubic) - total_energy_density -
-                        0.5 * magnetic_field_squared);
+  const double minimum_pressure = compute_minimum_pressure(
+      d_in_cubic, total_energy_density, magnetic_field_squared);
   double current_pressure =
       std::max(minimum_pressure, initial_guess_for_pressure);
   double previous_pressure{std::numeric_limits<double>::signaling_NaN()};
   size_t iteration_step{0};
-  std::array<double, 3> aitken_pressure{
-      {current_pressure, std::numeric_limits<double>::signaling_NaN(),
-       std::numeric_limits<double>::signaling_NaN()}};
-  size_t valid_entries_in_aitken_pressure = 1;
+  AitkenAcceleration aitken_acceleration{current_pressure};
   bool converged = false;
 
   while (true) {  // will break when relative pressure change is <
@@ -71,103 +188,178 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
     previous_pressure = current_pressure;
     // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
     current_pressure = std::max(current_pressure, minimum_pressure);
-    const double a_in_cubic =
-        total_energy_density + current_pressure + 0.5 * magnetic_field_squared;
-
-    if (UNLIKELY(a_in_cubic < 0.0)) {
+    const std::optional<Primitives> primitives = primitives_at_pressure(
+        current_pressure, total_energy_density, momentum_density_squared,
+        momentum_density_dot_magnetic_field, magnetic_field_squared,
+        d_in_cubic, rest_mass_density_times_lorentz_factor);
+    if (UNLIKELY(not primitives.has_value())) {
       return std::nullopt;
     }
 
-    // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
-    const double phi = acos(sqrt(6.75 * d_in_cubic / cube(a_in_cubic)));
-    // NH Eq. (5.11) with l=1 is desired positive root
-    const double root_of_cubic =
-        (a_in_cubic / 3.0) * (1.0 - 2.0 * cos((2.0 / 3.0) * (M_PI + phi)));
-    // NH Eq. (5.5) with their script L being rho_h_w_squared
-    // where rho is rest_mass_density, h is specific_enthalpy,
-    // and w is the lorentz factor
-    const double rho_h_w_squared = root_of_cubic - magnetic_field_squared;
-
-    if (UNLIKELY(rho_h_w_squared <= 0.0)) {
-      return std::nullopt;
-    }
-
-    // NH Eq. (5.2) with (5.5) substituted in denominator
-    const double v_squared =
-        (momentum_density_squared * square(rho_h_w_squared) +
-         square(momentum_density_dot_magnetic_field) *
-             (magnetic_field_squared + 2.0 * rho_h_w_squared)) /
-        square(rho_h_w_squared * root_of_cubic);
-
-    // If this fails, there was code in the Bitbucket version that adjusted
-    // the pressure to get the maximum allowed velocity in atmosphere.
-    // Instead, we could return std::nullopt and try the next inversion method.
-    if (UNLIKELY(v_squared < 0.0 or v_squared >= 1.0)) {
-      return std::nullopt;
-    }
-
-    const double current_lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
-    const double current_rest_mass_density =
-        rest_mass_density_times_lorentz_factor / current_lorentz_factor;
-
     if (converged) {
-      return PrimitiveRecoveryData{current_rest_mass_density,
-                                   current_lorentz_factor, current_pressure,
-                                   rho_h_w_squared};
+      return PrimitiveRecoveryData{primitives->rest_mass_density,
+                                   primitives->lorentz_factor,
+                                   current_pressure,
+                                   primitives->rho_h_w_squared};
     }
 
-    const double current_specific_enthalpy = [
-      rho_h_w_squared, current_rest_mass_density, current_lorentz_factor
-    ]() noexcept {
-      const double specific_enthalpy =
-          rho_h_w_squared /
-          (current_rest_mass_density * square(current_lorentz_factor));
-      if (UNLIKELY(1.0 - 1.0e-12 > specific_enthalpy)) {
-        return specific_enthalpy;  // will fail returning std::nullopt
-      }
-      return std::max(1.0, specific_enthalpy);
-    }
-    ();
+    const double current_specific_enthalpy =
+        compute_specific_enthalpy(*primitives);
     if (UNLIKELY(1.0 > current_specific_enthalpy)) {
       return std::nullopt;
     }
 
     if constexpr (ThermodynamicDim == 1) {
       current_pressure = get(equation_of_state.pressure_from_density(
-          Scalar<double>(current_rest_mass_density)));
+          Scalar<double>(primitives->rest_mass_density)));
     } else if constexpr (ThermodynamicDim == 2) {
       current_pressure =
           get(equation_of_state.pressure_from_density_and_enthalpy(
-              Scalar<double>(current_rest_mass_density),
+              Scalar<double>(primitives->rest_mass_density),
               Scalar<double>(current_specific_enthalpy)));
     }
 
-    gsl::at(aitken_pressure, valid_entries_in_aitken_pressure++) =
-        current_pressure;
-    if (3 == valid_entries_in_aitken_pressure) {
-      const double aitken_residual = (aitken_pressure[2] - aitken_pressure[1]) /
-                                     (aitken_pressure[1] - aitken_pressure[0]);
-      if (0.0 <= aitken_residual and aitken_residual < 1.0) {
-        previous_pressure = current_pressure;
-        current_pressure =
-            aitken_pressure[1] +
-            (aitken_pressure[2] - aitken_pressure[1]) / (1.0 - aitken_residual);
-        aitken_pressure = {{current_pressure,
-                            std::numeric_limits<double>::signaling_NaN(),
-                            std::numeric_limits<double>::signaling_NaN()}};
-        valid_entries_in_aitken_pressure = 1;
-      } else {
-        // Aitken extrapolation failed, retain latest 2 values for next attempt
-        aitken_pressure[0] = aitken_pressure[1];
-        aitken_pressure[1] = aitken_pressure[2];
-        valid_entries_in_aitken_pressure = 2;
-      }
-    }
+    aitken_acceleration.update(make_not_null(&current_pressure),
+                               make_not_null(&previous_pressure));
     // note primitives are recomputed above before being returned
     converged = fabs(current_pressure - previous_pressure) <=
                 relative_tolerance_ * (current_pressure + previous_pressure);
   }  // while loop
 }
+
+template <size_t ThermodynamicDim>
+void NewmanHamlin::apply(
+    const gsl::not_null<DataVector*> rest_mass_density,
+    const gsl::not_null<DataVector*> lorentz_factor,
+    const gsl::not_null<DataVector*> pressure,
+    const gsl::not_null<DataVector*> rho_h_w_squared,
+    const gsl::not_null<std::vector<size_t>*> points,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  // The state of the iteration at a point that has neither converged nor
+  // failed yet. The iteration is the same as in the pointwise `apply`.
+  struct Iteration {
+    size_t point;
+    double d_in_cubic;
+    double minimum_pressure;
+    double current_pressure;
+    double previous_pressure;
+    AitkenAcceleration aitken_acceleration;
+    bool converged;
+  };
+  std::vector<size_t> failed_points{};
+  std::vector<Iteration> iterations{};
+  iterations.reserve(points->size());
+  for (const size_t s : *points) {
+    const double d_in_cubic = compute_d_in_cubic(
+        momentum_density_squared[s], momentum_density_dot_magnetic_field[s],
+        magnetic_field_squared[s]);
+    if (UNLIKELY(0.0 > d_in_cubic)) {
+      failed_points.push_back(s);
+      continue;
+    }
+    const double minimum_pressure = compute_minimum_pressure(
+        d_in_cubic, total_energy_density[s], magnetic_field_squared[s]);
+    const double initial_pressure = std::max(minimum_pressure, (*pressure)[s]);
+    iterations.push_back(
+        Iteration{s, d_in_cubic, minimum_pressure, initial_pressure,
+                  std::numeric_limits<double>::signaling_NaN(),
+                  AitkenAcceleration{initial_pressure}, false});
+  }
+
+  // The arguments of the equation of state at the points that are still
+  // iterating, which are the first entries of the buffers
+  DataVector rest_mass_density_buffer{iterations.size()};
+  DataVector specific_enthalpy_buffer{iterations.size()};
+  size_t iteration_step = 0;
+  while (not iterations.empty()) {
+    const bool last_iteration = max_iterations_ == iteration_step;
+    ++iteration_step;
+    // Advance each point to the evaluation of the equation of state, removing
+    // the points that converged or failed
+    size_t number_iterating = 0;
+    for (Iteration& iteration : iterations) {
+      const size_t s = iteration.point;
+      if (UNLIKELY(last_iteration and not iteration.converged)) {
+        failed_points.push_back(s);
+        continue;
+      }
+      iteration.previous_pressure = iteration.current_pressure;
+      // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
+      iteration.current_pressure =
+          std::max(iteration.current_pressure, iteration.minimum_pressure);
+      const std::optional<Primitives> primitives = primitives_at_pressure(
+          iteration.current_pressure, total_energy_density[s],
+          momentum_density_squared[s], momentum_density_dot_magnetic_field[s],
+          magnetic_field_squared[s], iteration.d_in_cubic,
+          rest_mass_density_times_lorentz_factor[s]);
+      if (UNLIKELY(not primitives.has_value())) {
+        failed_points.push_back(s);
+        continue;
+      }
+
+      if (iteration.converged) {
+        (*rest_mass_density)[s] = primitives->rest_mass_density;
+        (*lorentz_factor)[s] = primitives->lorentz_factor;
+        (*pressure)[s] = iteration.current_pressure;
+        (*rho_h_w_squared)[s] = primitives->rho_h_w_squared;
+        continue;
+      }
+
+      const double current_specific_enthalpy =
+          compute_specific_enthalpy(*primitives);
+      if (UNLIKELY(1.0 > current_specific_enthalpy)) {
+        failed_points.push_back(s);
+        continue;
+      }
+      rest_mass_density_buffer[number_iterating] =
+          primitives->rest_mass_density;
+      specific_enthalpy_buffer[number_iterating] = current_specific_enthalpy;
+      iterations[number_iterating] = iteration;
+      ++number_iterating;
+    }
+    iterations.erase(
+        iterations.begin() + static_cast<std::ptrdiff_t>(number_iterating),
+        iterations.end());
+    if (iterations.empty()) {
+      break;
+    }
+
+    // Evaluate the equation of state at all points that are still iterating
+    const Scalar<DataVector> iterating_rest_mass_density(
+        rest_mass_density_buffer.data(), number_iterating);
+    Scalar<DataVector> iterating_pressure{};
+    if constexpr (ThermodynamicDim == 1) {
+      iterating_pressure =
+          equation_of_state.pressure_from_density(iterating_rest_mass_density);
+    } else if constexpr (ThermodynamicDim == 2) {
+      const Scalar<DataVector> iterating_specific_enthalpy(
+          specific_enthalpy_buffer.data(), number_iterating);
+      iterating_pressure = equation_of_state.pressure_from_density_and_enthalpy(
+          iterating_rest_mass_density, iterating_specific_enthalpy);
+    }
+
+    for (size_t i = 0; i < number_iterating; ++i) {
+      Iteration& iteration = iterations[i];
+      iteration.current_pressure = get(iterating_pressure)[i];
+      iteration.aitken_acceleration.update(
+          make_not_null(&iteration.current_pressure),
+          make_not_null(&iteration.previous_pressure));
+      // note primitives are recomputed above before being returned
+      iteration.converged =
+          fabs(iteration.current_pressure - iteration.previous_pressure) <=
+          relative_tolerance_ *
+              (iteration.current_pressure + iteration.previous_pressure);
+    }
+  }
+  std::sort(failed_points.begin(), failed_points.end());
+  *points = std::move(failed_points);
+}
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
 
 #define THERMODIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -181,6 +373,21 @@ std::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
       const double momentum_density_dot_magnetic_field,                       \
       const double magnetic_field_squared,                                    \
       const double rest_mass_density_times_lorentz_factor,                    \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&         \
+          equation_of_state) noexcept;                                        \
+  template void                                                               \
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin::apply<     \
+      THERMODIM(data)>(                                                       \
+      const gsl::not_null<DataVector*> rest_mass_density,                     \
+      const gsl::not_null<DataVector*> lorentz_factor,                        \
+      const gsl::not_null<DataVector*> pressure,                              \
+      const gsl::not_null<DataVector*> rho_h_w_squared,                       \
+      const gsl::not_null<std::vector<size_t>*> points,                       \
+      const DataVector& total_energy_density,                                 \
+      const DataVector& momentum_density_squared,                             \
+      const DataVector& momentum_density_dot_magnetic_field,                  \
+      const DataVector& magnetic_field_squared,                               \
+      const DataVector& rest_mass_density_times_lorentz_factor,               \
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&         \
           equation_of_state) noexcept;
 
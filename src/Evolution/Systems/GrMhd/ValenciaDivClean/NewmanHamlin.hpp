@@ -6,8 +6,10 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
@@ -16,6 +18,7 @@ namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
 
 /// \cond
+class DataVector;
 struct PrimitiveRecoveryData;
 /// \endcond
 
@@ -46,6 +49,18 @@ struct PrimitiveRecoveryData;
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * The second overload of `apply` recovers the primitives at all `points` of
+ * `DataVector`s at once. The fixed-point iterations at all points proceed in
+ * lockstep, so the equation of state is evaluated once per iteration on all
+ * points that are still iterating rather than once per iteration and point.
+ * Points drop out of the iteration as soon as they converge or fail, and the
+ * input `pressure` at each point is used as the initial guess, so in an
+ * evolution the iteration is warm-started from the pressure at the previous
+ * time. The recovered `rest_mass_density`, `lorentz_factor`, `pressure`, and
+ * `rho_h_w_squared` are written only at the points where the recovery
+ * succeeded, and on return `points` holds the (sorted) points where it failed.
+ * The result at each point is the same as that of the first overload.
  */
 class NewmanHamlin {
  public:
@@ -58,6 +73,21 @@ class NewmanHamlin {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<DataVector*> rest_mass_density,
+      gsl::not_null<DataVector*> lorentz_factor,
+      gsl::not_null<DataVector*> pressure,
+      gsl::not_null<DataVector*> rho_h_w_squared,
+      gsl::not_null<std::vector<size_t>*> points,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
   static const std::string name() noexcept { return "Newman Hamlin"; }
 
  private:
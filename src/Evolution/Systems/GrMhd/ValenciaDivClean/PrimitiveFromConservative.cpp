@@ -3,10 +3,13 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <cstddef>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <optional>
 #include <ostream>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
@@ -26,7 +29,9 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
 
 // IWYU pragma: no_include <array>
 
@@ -34,6 +39,12 @@
 // IWYU pragma: no_forward_declare Tensor
 
 namespace grmhd::ValenciaDivClean {
+namespace {
+// Schemes can provide an overload of `apply` that recovers the primitives at
+// many points at once
+CREATE_IS_CALLABLE(apply)
+CREATE_IS_CALLABLE_V(apply)
+}  // namespace
 
 template <typename OrderedListOfPrimitiveRecoverySchemes, bool ErrorOnFailure>
 template <size_t ThermodynamicDim>
@@ -68,7 +79,8 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   Variables<
       tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
                  ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                 ::Tags::TempScalar<4>, ::Tags::TempI<5, 3, Frame::Inertial>>>
+                 ::Tags::TempScalar<4>, ::Tags::TempI<5, 3, Frame::Inertial>,
+                 ::Tags::TempScalar<6>>>
       temp_buffer(size);
 
   DataVector& total_energy_density =
@@ -102,69 +114,105 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   rest_mass_density_times_lorentz_factor =
       get(tilde_d) / get(sqrt_det_spatial_metric);
 
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
-    std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
-        primitive_data = std::nullopt;
-    tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>([
-      &pressure, &primitive_data, &total_energy_density,
-      &momentum_density_squared, &momentum_density_dot_magnetic_field,
-      &magnetic_field_squared, &rest_mass_density_times_lorentz_factor,
-      &equation_of_state, &s
-    ](auto scheme) noexcept {
-      using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
-      if (not primitive_data.has_value()) {
-        primitive_data =
-            primitive_recovery_scheme::template apply<ThermodynamicDim>(
-                get(*pressure)[s], total_energy_density[s],
-                get(momentum_density_squared)[s],
-                get(momentum_density_dot_magnetic_field)[s],
-                get(magnetic_field_squared)[s],
-                rest_mass_density_times_lorentz_factor[s], equation_of_state);
-      }
-    });
-
-    if (primitive_data.has_value()) {
-      get(*rest_mass_density)[s] = primitive_data.value().rest_mass_density;
-      const double coefficient_of_b =
-          get(momentum_density_dot_magnetic_field)[s] /
-          (primitive_data.value().rho_h_w_squared *
-           (primitive_data.value().rho_h_w_squared +
-            get(magnetic_field_squared)[s]));
-      const double coefficient_of_s =
-          1.0 / (get(sqrt_det_spatial_metric)[s] *
-                 (primitive_data.value().rho_h_w_squared +
-                  get(magnetic_field_squared)[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
-      }
-      get(*lorentz_factor)[s] = primitive_data.value().lorentz_factor;
-      get(*pressure)[s] = primitive_data.value().pressure;
+  DataVector& rho_h_w_squared = get(get<::Tags::TempScalar<6>>(temp_buffer));
+
+  // The points at which none of the schemes tried so far succeeded
+  std::vector<size_t> unrecovered_points(size);
+  std::iota(unrecovered_points.begin(), unrecovered_points.end(), 0_st);
+  tmpl::for_each<OrderedListOfPrimitiveRecoverySchemes>([
+    &rest_mass_density, &lorentz_factor, &pressure, &rho_h_w_squared,
+    &unrecovered_points, &total_energy_density, &momentum_density_squared,
+    &momentum_density_dot_magnetic_field, &magnetic_field_squared,
+    &rest_mass_density_times_lorentz_factor, &equation_of_state
+  ](auto scheme) noexcept {
+    using primitive_recovery_scheme = tmpl::type_from<decltype(scheme)>;
+    if (unrecovered_points.empty()) {
+      return;
+    }
+    if constexpr (is_apply_callable_v<
+                      primitive_recovery_scheme, gsl::not_null<DataVector*>,
+                      gsl::not_null<DataVector*>, gsl::not_null<DataVector*>,
+                      gsl::not_null<DataVector*>,
+                      gsl::not_null<std::vector<size_t>*>, const DataVector&,
+                      const DataVector&, const DataVector&, const DataVector&,
+                      const DataVector&,
+                      const EquationsOfState::EquationOfState<
+                          true, ThermodynamicDim>&>) {
+      primitive_recovery_scheme::apply(
+          make_not_null(&get(*rest_mass_density)),
+          make_not_null(&get(*lorentz_factor)), make_not_null(&get(*pressure)),
+          make_not_null(&rho_h_w_squared), make_not_null(&unrecovered_points),
+          total_energy_density, get(momentum_density_squared),
+          get(momentum_density_dot_magnetic_field),
+          get(magnetic_field_squared), rest_mass_density_times_lorentz_factor,
+          equation_of_state);
     } else {
-      if constexpr (ErrorOnFailure) {
-        ERROR("All primitive inversion schemes failed at s = "
-              << s << ".\n"
-              << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-              << "total_energy_density = " << total_energy_density[s] << "\n"
-              << "momentum_density_squared = "
-              << get(momentum_density_squared)[s] << "\n"
-              << "momentum_density_dot_magnetic_field = "
-              << get(momentum_density_dot_magnetic_field)[s] << "\n"
-              << "magnetic_field_squared = " << get(magnetic_field_squared)[s]
-              << "\n"
-              << "rest_mass_density_times_lorentz_factor = "
-              << rest_mass_density_times_lorentz_factor[s] << "\n"
-              << "previous_rest_mass_density = " << get(*rest_mass_density)[s]
-              << "\n"
-              << "previous_pressure = " << get(*pressure)[s] << "\n"
-              << "previous_lorentz_factor = " << get(*lorentz_factor)[s]
-              << "\n");
-      } else {
-        return false;
+      size_t number_unrecovered = 0;
+      for (const size_t s : unrecovered_points) {
+        const std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
+            primitive_data =
+                primitive_recovery_scheme::template apply<ThermodynamicDim>(
+                    get(*pressure)[s], total_energy_density[s],
+                    get(momentum_density_squared)[s],
+                    get(momentum_density_dot_magnetic_field)[s],
+                    get(magnetic_field_squared)[s],
+                    rest_mass_density_times_lorentz_factor[s],
+                    equation_of_state);
+        if (primitive_data.has_value()) {
+          get(*rest_mass_density)[s] = primitive_data->rest_mass_density;
+          get(*lorentz_factor)[s] = primitive_data->lorentz_factor;
+          get(*pressure)[s] = primitive_data->pressure;
+          rho_h_w_squared[s] = primitive_data->rho_h_w_squared;
+        } else {
+          unrecovered_points[number_unrecovered] = s;
+          ++number_unrecovered;
+        }
       }
+      unrecovered_points.erase(
+          unrecovered_points.begin() +
+              static_cast<std::ptrdiff_t>(number_unrecovered),
+          unrecovered_points.end());
+    }
+  });
+
+  if (not unrecovered_points.empty()) {
+    if constexpr (ErrorOnFailure) {
+      const size_t s = unrecovered_points.front();
+      ERROR("All primitive inversion schemes failed at s = "
+            << s << ".\n"
+            << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+            << "total_energy_density = " << total_energy_density[s] << "\n"
+            << "momentum_density_squared = "
+            << get(momentum_density_squared)[s] << "\n"
+            << "momentum_density_dot_magnetic_field = "
+            << get(momentum_density_dot_magnetic_field)[s] << "\n"
+            << "magnetic_field_squared = " << get(magnetic_field_squared)[s]
+            << "\n"
+            << "rest_mass_density_times_lorentz_factor = "
+            << rest_mass_density_times_lorentz_factor[s] << "\n"
+            << "previous_rest_mass_density = " << get(*rest_mass_density)[s]
+            << "\n"
+            << "previous_pressure = " << get(*pressure)[s] << "\n"
+            << "previous_lorentz_factor = " << get(*lorentz_factor)[s]
+            << "\n");
+    } else {
+      return false;
     }
   }
+
+  // Reuse the buffers of quantities that are no longer needed for the
+  // coefficients of the velocity
+  DataVector& coefficient_of_b = get(momentum_density_squared);
+  coefficient_of_b = get(momentum_density_dot_magnetic_field) /
+                     (rho_h_w_squared *
+                      (rho_h_w_squared + get(magnetic_field_squared)));
+  DataVector& coefficient_of_s = total_energy_density;
+  coefficient_of_s = 1.0 / (get(sqrt_det_spatial_metric) *
+                            (rho_h_w_squared + get(magnetic_field_squared)));
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_velocity->get(i) = coefficient_of_b * magnetic_field->get(i) +
+                               coefficient_of_s * tilde_s_upper.get(i);
+  }
   if constexpr (ThermodynamicDim == 1) {
     *specific_internal_energy =
         equation_of_state.specific_internal_energy_from_density(
@@ -41,6 +41,13 @@ namespace ValenciaDivClean {
  * (http://iopscience.iop.org/article/10.3847/1538-4357/aabcc5/meta)
  * compares several inversion methods.
  *
+ * The schemes in `OrderedListOfPrimitiveRecoverySchemes` are tried in order,
+ * each at the points where all previous schemes failed. The pressure passed in
+ * is used as the initial guess of the schemes that take one. Schemes that
+ * provide an overload of `apply` taking `DataVector`s (see
+ * `PrimitiveRecoverySchemes::NewmanHamlin`) recover the primitives at all
+ * remaining points in one call, the others are called point by point.
+ *
  * If `ErrorOnFailure` is `false` then the returned `bool` will be `false` if
  * recovery failed and `true` if it succeeded.
  */
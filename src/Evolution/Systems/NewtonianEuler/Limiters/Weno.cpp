@@ -83,9 +83,9 @@ bool characteristic_simple_weno_impl(
   // Buffers for SimpleWeno extrapolated poly
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-      intrp::RegularGrid<VolumeDim>,
+      const intrp::RegularGrid<VolumeDim>*,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
-      interpolator_buffer{};
+      interpolant_buffer{};
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
@@ -94,7 +94,7 @@ bool characteristic_simple_weno_impl(
   // Outer lambda: wraps applying SimpleWeno to the NewtonianEuler
   // characteristics for one particular choice of characteristic decomposition
   const auto simple_weno_convert_neighbor_data_then_limit =
-      [&tci_buffer, &interpolator_buffer, &modified_neighbor_solution_buffer,
+      [&tci_buffer, &interpolant_buffer, &modified_neighbor_solution_buffer,
        &tvb_constant, &neighbor_linear_weight, &mesh, &element, &element_size,
        &neighbor_data, &neighbor_char_data, &effective_neighbor_sizes](
           const gsl::not_null<Scalar<DataVector>*> char_v_minus,
@@ -116,7 +116,7 @@ bool characteristic_simple_weno_impl(
     // Inner lambda: apply SimpleWeno to one particular tensor
     const auto wrap_minmod_tci_and_simple_weno =
         [&some_component_was_limited_with_this_normal, &tci_buffer,
-         &interpolator_buffer, &modified_neighbor_solution_buffer,
+         &interpolant_buffer, &modified_neighbor_solution_buffer,
          &tvb_constant, &neighbor_linear_weight, &mesh, &element, &element_size,
          &neighbor_char_data,
          &effective_neighbor_sizes](auto tag, const auto tensor) noexcept {
@@ -145,7 +145,7 @@ bool characteristic_simple_weno_impl(
                 }
               }
               Limiters::Weno_detail::simple_weno_impl<decltype(tag)>(
-                  make_not_null(&interpolator_buffer),
+                  make_not_null(&interpolant_buffer),
                   make_not_null(&modified_neighbor_solution_buffer), tensor,
                   neighbor_linear_weight, tensor_storage_index, mesh, element,
                   neighbor_char_data);
@@ -224,11 +224,15 @@ bool characteristic_hweno_impl(
         std::make_pair(neighbor, DataVector(mesh.number_of_grid_points())));
   }
 
+  // The fit cache does not depend on the characteristic decomposition
+  const auto& fit_cache =
+      ::Limiters::Weno_detail::constrained_fit_cache(mesh, element);
+
   // Lambda wraps applying Hweno to the NewtonianEuler characteristics for one
   // particular choice of characteristic decomposition
   const auto hweno_convert_neighbor_data_then_limit =
       [&modified_neighbor_solution_buffer, &neighbor_linear_weight, &mesh,
-       &element, &neighbor_data, &neighbor_char_data](
+       &element, &fit_cache, &neighbor_data, &neighbor_char_data](
           const gsl::not_null<Scalar<DataVector>*> char_v_minus,
           const gsl::not_null<tnsr::I<DataVector, VolumeDim>*> char_v_momentum,
           const gsl::not_null<Scalar<DataVector>*> char_v_plus,
@@ -245,14 +249,14 @@ bool characteristic_hweno_impl(
 
     ::Limiters::Weno_detail::hweno_impl<NewtonianEuler::Tags::VMinus>(
         make_not_null(&modified_neighbor_solution_buffer), char_v_minus,
-        neighbor_linear_weight, mesh, element, neighbor_char_data);
+        neighbor_linear_weight, mesh, element, fit_cache, neighbor_char_data);
     ::Limiters::Weno_detail::hweno_impl<
         NewtonianEuler::Tags::VMomentum<VolumeDim>>(
         make_not_null(&modified_neighbor_solution_buffer), char_v_momentum,
-        neighbor_linear_weight, mesh, element, neighbor_char_data);
+        neighbor_linear_weight, mesh, element, fit_cache, neighbor_char_data);
     ::Limiters::Weno_detail::hweno_impl<NewtonianEuler::Tags::VPlus>(
         make_not_null(&modified_neighbor_solution_buffer), char_v_plus,
-        neighbor_linear_weight, mesh, element, neighbor_char_data);
+        neighbor_linear_weight, mesh, element, fit_cache, neighbor_char_data);
     return true;  // all components were limited
   };
 
@@ -300,16 +304,18 @@ bool conservative_hweno_impl(
         std::make_pair(neighbor, DataVector(mesh.number_of_grid_points())));
   }
 
+  const auto& fit_cache =
+      ::Limiters::Weno_detail::constrained_fit_cache(mesh, element);
   ::Limiters::Weno_detail::hweno_impl<NewtonianEuler::Tags::MassDensityCons>(
       make_not_null(&modified_neighbor_solution_buffer), mass_density_cons,
-      neighbor_linear_weight, mesh, element, neighbor_data);
+      neighbor_linear_weight, mesh, element, fit_cache, neighbor_data);
   ::Limiters::Weno_detail::hweno_impl<
       NewtonianEuler::Tags::MomentumDensity<VolumeDim>>(
       make_not_null(&modified_neighbor_solution_buffer), momentum_density,
-      neighbor_linear_weight, mesh, element, neighbor_data);
+      neighbor_linear_weight, mesh, element, fit_cache, neighbor_data);
   ::Limiters::Weno_detail::hweno_impl<NewtonianEuler::Tags::EnergyDensity>(
       make_not_null(&modified_neighbor_solution_buffer), energy_density,
-      neighbor_linear_weight, mesh, element, neighbor_data);
+      neighbor_linear_weight, mesh, element, fit_cache, neighbor_data);
   return true;  // all components were limited
 }
 
@@ -0,0 +1,117 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/CoordinateMaps/Wedge.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Executables/Benchmark/Helpers.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+namespace {
+using Affine = domain::CoordinateMaps::Affine;
+using Affine3D = domain::CoordinateMaps::ProductOf3Maps<Affine, Affine, Affine>;
+using Wedge3D = domain::CoordinateMaps::Wedge<3>;
+
+// The maps are called through `CoordinateMapBase`, i.e. with a virtual call,
+// in the same way as the maps stored in the DataBox of an element.
+enum class MapType { Affine, Wedge };
+
+std::unique_ptr<domain::CoordinateMapBase<Frame::Logical, Frame::Inertial, 3>>
+make_map(const MapType map_type) noexcept {
+  if (map_type == MapType::Affine) {
+    return domain::make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+        Affine3D{Affine{-1.0, 1.0, 2.0, 3.0}, Affine{-1.0, 1.0, -1.0, 1.0},
+                 Affine{-1.0, 1.0, 0.0, 4.0}});
+  }
+  return domain::make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+      Wedge3D{2.0, 5.0, 0.0, 1.0, OrientationMap<3>{}, true});
+}
+
+// Arguments are the map type and the number of grid points per dimension
+void map_arguments(benchmark::internal::Benchmark* benchmark) noexcept {
+  for (const auto map_type : {MapType::Affine, MapType::Wedge}) {
+    for (const int points : {4, 8, 12}) {
+      benchmark->Args({static_cast<int64_t>(map_type), points});
+    }
+  }
+}
+
+tnsr::I<DataVector, 3, Frame::Logical> logical_coords(
+    const benchmark::State& state) noexcept {
+  return logical_coordinates(Mesh<3>{static_cast<size_t>(state.range(1)),
+                                     Spectral::Basis::Legendre,
+                                     Spectral::Quadrature::GaussLobatto});
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_map_evaluation(benchmark::State& state) {  // NOLINT
+  const auto map = make_map(static_cast<MapType>(state.range(0)));
+  const auto source_coords = logical_coords(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize((*map)(source_coords));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(get<0>(source_coords).size()));
+}
+BENCHMARK(bench_map_evaluation)->Apply(map_arguments);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_map_jacobian(benchmark::State& state) {  // NOLINT
+  const auto map = make_map(static_cast<MapType>(state.range(0)));
+  const auto source_coords = logical_coords(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map->jacobian(source_coords));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(get<0>(source_coords).size()));
+}
+BENCHMARK(bench_map_jacobian)->Apply(map_arguments);  // NOLINT
+
+// clang-tidy: don't pass be non-const reference
+void bench_map_inv_jacobian(benchmark::State& state) {  // NOLINT
+  const auto map = make_map(static_cast<MapType>(state.range(0)));
+  const auto source_coords = logical_coords(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map->inv_jacobian(source_coords));
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(get<0>(source_coords).size()));
+}
+BENCHMARK(bench_map_inv_jacobian)->Apply(map_arguments);  // NOLINT
+
+// Inverts the map at every grid point one point at a time, which is how
+// points are located in the domain, e.g. for interpolation
+// clang-tidy: don't pass be non-const reference
+void bench_map_inverse(benchmark::State& state) {  // NOLINT
+  const auto map = make_map(static_cast<MapType>(state.range(0)));
+  const auto target_coords = (*map)(logical_coords(state));
+  const size_t number_of_points = get<0>(target_coords).size();
+  while (state.KeepRunning()) {
+    for (size_t s = 0; s < number_of_points; ++s) {
+      const tnsr::I<double, 3, Frame::Inertial> point{
+          {{get<0>(target_coords)[s], get<1>(target_coords)[s],
+            get<2>(target_coords)[s]}}};
+      benchmark::DoNotOptimize(map->inverse(point));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_points));
+}
+BENCHMARK(bench_map_inverse)->Apply(map_arguments);  // NOLINT
+}  // namespace
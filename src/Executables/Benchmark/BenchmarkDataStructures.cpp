@@ -0,0 +1,97 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/FixedHashMap.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/MaxNumberOfNeighbors.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Executables/Benchmark/Helpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct SpacetimeMetricVar : db::SimpleTag {
+  using type = tnsr::aa<DataVector, 3, Frame::Inertial>;
+};
+struct PiVar : db::SimpleTag {
+  using type = tnsr::aa<DataVector, 3, Frame::Inertial>;
+};
+struct PhiVar : db::SimpleTag {
+  using type = tnsr::iaa<DataVector, 3, Frame::Inertial>;
+};
+using gh_vars = tmpl::list<SpacetimeMetricVar, PiVar, PhiVar>;
+
+// An update like that of a Runge-Kutta substep, `u = u0 + dt * du`, on the
+// evolved variables of the GH system
+// clang-tidy: don't pass be non-const reference
+void bench_variables_arithmetic(benchmark::State& state) {  // NOLINT
+  const auto points = static_cast<size_t>(state.range(0));
+  const size_t number_of_grid_points = points * points * points;
+  Variables<gh_vars> u0{number_of_grid_points};
+  Variables<gh_vars> du{number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(u0.data(), u0.size());
+  benchmark_helpers::fill_with_random_values(du.data(), du.size());
+  Variables<gh_vars> u{number_of_grid_points};
+  const double dt = 0.1;
+  while (state.KeepRunning()) {
+    u = u0 + dt * du;
+    benchmark::DoNotOptimize(u.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(u.size()));
+}
+BENCHMARK(bench_variables_arithmetic)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+
+// Lookups in a map of all neighbors of an element, as done when receiving and
+// applying boundary data. The argument is the number of neighbors stored.
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_fixed_hash_map_lookup(benchmark::State& state) {  // NOLINT
+  using key_type = std::pair<Direction<Dim>, ElementId<Dim>>;
+  FixedHashMap<maximum_number_of_neighbors(Dim), key_type, double,
+               boost::hash<key_type>>
+      map{};
+  std::vector<key_type> keys{};
+  const auto number_of_neighbors = static_cast<size_t>(state.range(0));
+  for (size_t i = 0; i < number_of_neighbors; ++i) {
+    const auto direction =
+        gsl::at(Direction<Dim>::all_directions(), i % (2 * Dim));
+    const ElementId<Dim> neighbor_id{i, make_array<Dim>(SegmentId{1, i % 2})};
+    keys.emplace_back(direction, neighbor_id);
+    map.emplace(keys.back(), static_cast<double>(i));
+  }
+  while (state.KeepRunning()) {
+    for (const auto& key : keys) {
+      benchmark::DoNotOptimize(map.at(key));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(keys.size()));
+}
+BENCHMARK_TEMPLATE(bench_fixed_hash_map_lookup, 1)  // NOLINT
+    ->Arg(1)
+    ->Arg(maximum_number_of_neighbors(1));
+BENCHMARK_TEMPLATE(bench_fixed_hash_map_lookup, 2)  // NOLINT
+    ->Arg(4)
+    ->Arg(maximum_number_of_neighbors(2));
+BENCHMARK_TEMPLATE(bench_fixed_hash_map_lookup, 3)  // NOLINT
+    ->Arg(6)
+    ->Arg(maximum_number_of_neighbors(3));
+}  // namespace
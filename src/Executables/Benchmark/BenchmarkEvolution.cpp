@@ -0,0 +1,215 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Executables/Benchmark/Helpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Calls `GeneralizedHarmonic::TimeDerivative` with its time derivatives and
+// temporaries stored in Variables, like `evolution::dg::Actions` does.
+template <typename DtTagsList, typename TemporaryTagsList>
+struct GhTimeDerivative;
+
+template <typename... DtTags, typename... TemporaryTags>
+struct GhTimeDerivative<tmpl::list<DtTags...>, tmpl::list<TemporaryTags...>> {
+  template <typename... Args>
+  static void apply(
+      const gsl::not_null<Variables<tmpl::list<DtTags...>>*> dt_vars,
+      const gsl::not_null<Variables<tmpl::list<TemporaryTags...>>*> temporaries,
+      const Args&... args) noexcept {
+    GeneralizedHarmonic::TimeDerivative<3>::apply(
+        make_not_null(&get<DtTags>(*dt_vars))...,
+        make_not_null(&get<TemporaryTags>(*temporaries))..., args...);
+  }
+};
+
+// The argument is the number of grid points per dimension
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  using system = GeneralizedHarmonic::System<Dim>;
+  using evolved_tags = typename system::variables_tag::tags_list;
+  using argument_tags = tmpl::append<
+      db::wrap_tags_in<Tags::deriv, evolved_tags, tmpl::size_t<Dim>,
+                       Frame::Inertial>,
+      typename GeneralizedHarmonic::TimeDerivative<Dim>::argument_tags>;
+  using dt_tags = db::wrap_tags_in<Tags::dt, evolved_tags>;
+  using temporary_tags =
+      typename GeneralizedHarmonic::TimeDerivative<Dim>::temporary_tags;
+
+  const auto points = static_cast<size_t>(state.range(0));
+  const size_t number_of_grid_points = points * points * points;
+
+  // A small perturbation of Minkowski space with unit constraint damping
+  Variables<argument_tags> arguments{number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(arguments.data(),
+                                             arguments.size(), -0.01, 0.01);
+  auto& spacetime_metric =
+      get<gr::Tags::SpacetimeMetric<Dim, Frame::Inertial, DataVector>>(
+          arguments);
+  get<0, 0>(spacetime_metric) -= 1.0;
+  for (size_t i = 1; i < Dim + 1; ++i) {
+    spacetime_metric.get(i, i) += 1.0;
+  }
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma0>(
+      arguments)) = 1.0;
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma1>(
+      arguments)) = -1.0;
+  get(get<GeneralizedHarmonic::ConstraintDamping::Tags::ConstraintGamma2>(
+      arguments)) = 1.0;
+
+  Variables<dt_tags> dt_vars{number_of_grid_points};
+  Variables<temporary_tags> temporaries{number_of_grid_points};
+
+  while (state.KeepRunning()) {
+    tmpl::as_pack<argument_tags>([&arguments, &dt_vars,
+                                  &temporaries](auto... argument_tags_v) {
+      GhTimeDerivative<dt_tags, temporary_tags>::apply(
+          make_not_null(&dt_vars), make_not_null(&temporaries),
+          get<tmpl::type_from<decltype(argument_tags_v)>>(arguments)...);
+    });
+    benchmark::DoNotOptimize(dt_vars.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_grid_points));
+}
+BENCHMARK(bench_gh_time_derivative)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+
+// Recovery of the primitive variables of a magnetized fluid with an ideal
+// fluid equation of state. The argument is the number of grid points per
+// dimension.
+// clang-tidy: don't pass be non-const reference
+template <typename RecoverySchemes>
+void bench_valencia_primitive_recovery(benchmark::State& state) {  // NOLINT
+  const auto points = static_cast<size_t>(state.range(0));
+  const size_t number_of_grid_points = points * points * points;
+  const EquationsOfState::IdealFluid<true> equation_of_state{4.0 / 3.0};
+
+  // Flat space
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric{
+      number_of_grid_points, 0.0};
+  tnsr::II<DataVector, 3, Frame::Inertial> inv_spatial_metric{
+      number_of_grid_points, 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+    inv_spatial_metric.get(i, i) = 1.0;
+  }
+  const Scalar<DataVector> sqrt_det_spatial_metric{number_of_grid_points, 1.0};
+
+  Scalar<DataVector> rest_mass_density{number_of_grid_points};
+  Scalar<DataVector> specific_internal_energy{number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> spatial_velocity{
+      number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> magnetic_field{
+      number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(
+      get(rest_mass_density).data(), number_of_grid_points, 0.5, 1.0);
+  benchmark_helpers::fill_with_random_values(
+      get(specific_internal_energy).data(), number_of_grid_points, 0.1, 1.0);
+  for (size_t i = 0; i < 3; ++i) {
+    benchmark_helpers::fill_with_random_values(
+        spatial_velocity.get(i).data(), number_of_grid_points, -0.3, 0.3);
+    benchmark_helpers::fill_with_random_values(
+        magnetic_field.get(i).data(), number_of_grid_points, -0.1, 0.1);
+  }
+  const Scalar<DataVector> divergence_cleaning_field{number_of_grid_points,
+                                                     0.0};
+  const Scalar<DataVector> pressure =
+      equation_of_state.pressure_from_density_and_energy(
+          rest_mass_density, specific_internal_energy);
+  const Scalar<DataVector> specific_enthalpy{
+      1.0 + get(specific_internal_energy) +
+      get(pressure) / get(rest_mass_density)};
+  const Scalar<DataVector> lorentz_factor{
+      1.0 / sqrt(1.0 - square(get<0>(spatial_velocity)) -
+                 square(get<1>(spatial_velocity)) -
+                 square(get<2>(spatial_velocity)))};
+
+  Scalar<DataVector> tilde_d{number_of_grid_points};
+  Scalar<DataVector> tilde_tau{number_of_grid_points};
+  tnsr::i<DataVector, 3, Frame::Inertial> tilde_s{number_of_grid_points};
+  tnsr::I<DataVector, 3, Frame::Inertial> tilde_b{number_of_grid_points};
+  Scalar<DataVector> tilde_phi{number_of_grid_points};
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), make_not_null(&tilde_b),
+      make_not_null(&tilde_phi), rest_mass_density, specific_internal_energy,
+      specific_enthalpy, pressure, spatial_velocity, lorentz_factor,
+      magnetic_field, sqrt_det_spatial_metric, spatial_metric,
+      divergence_cleaning_field);
+
+  // The recovered primitives, which also hold the initial guess for the
+  // pressure.
+  auto recovered_rest_mass_density = rest_mass_density;
+  auto recovered_specific_internal_energy = specific_internal_energy;
+  auto recovered_spatial_velocity = spatial_velocity;
+  auto recovered_magnetic_field = magnetic_field;
+  auto recovered_divergence_cleaning_field = divergence_cleaning_field;
+  auto recovered_lorentz_factor = lorentz_factor;
+  auto recovered_pressure = pressure;
+  auto recovered_specific_enthalpy = specific_enthalpy;
+
+  while (state.KeepRunning()) {
+    // Start every recovery from the same guess
+    state.PauseTiming();
+    recovered_pressure = pressure;
+    state.ResumeTiming();
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<RecoverySchemes>::apply(
+        make_not_null(&recovered_rest_mass_density),
+        make_not_null(&recovered_specific_internal_energy),
+        make_not_null(&recovered_spatial_velocity),
+        make_not_null(&recovered_magnetic_field),
+        make_not_null(&recovered_divergence_cleaning_field),
+        make_not_null(&recovered_lorentz_factor),
+        make_not_null(&recovered_pressure),
+        make_not_null(&recovered_specific_enthalpy), tilde_d, tilde_tau,
+        tilde_s, tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+        sqrt_det_spatial_metric, equation_of_state);
+    benchmark::DoNotOptimize(get(recovered_pressure).data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_grid_points));
+}
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_valencia_primitive_recovery,
+    tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>)
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_valencia_primitive_recovery,
+    tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin>)
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_valencia_primitive_recovery,
+    tmpl::list<
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>)
+    ->Apply(benchmark_helpers::grid_points_arguments);
+}  // namespace
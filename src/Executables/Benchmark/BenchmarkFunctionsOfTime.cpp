@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+using PiecewisePolynomial = domain::FunctionsOfTime::PiecewisePolynomial<3>;
+
+// The function is shared by all benchmark threads, in the same way as the
+// functions of time in the global cache are shared by all elements on a node
+const PiecewisePolynomial& shared_function() noexcept {
+  static const PiecewisePolynomial function{
+      0.0,
+      {{{1.0, 2.0, 3.0}, {0.1, 0.2, 0.3}, {0.01, 0.02, 0.03}, {1.0, 1.0, 1.0}}},
+      std::numeric_limits<double>::max()};
+  return function;
+}
+
+// The argument is the number of derivatives that are evaluated
+void evaluate(const PiecewisePolynomial& function, const double time,
+              const int64_t number_of_derivs) noexcept {
+  switch (number_of_derivs) {
+    case 0:
+      benchmark::DoNotOptimize(function.func(time));
+      break;
+    case 1:
+      benchmark::DoNotOptimize(function.func_and_deriv(time));
+      break;
+    case 2:
+      benchmark::DoNotOptimize(function.func_and_2_derivs(time));
+      break;
+    default:
+      ERROR("Only up to two derivatives can be evaluated, not "
+            << number_of_derivs);
+  }
+}
+
+// Evaluates the function at the same few substep times over and over, so all
+// but the first evaluations at each time are cache hits
+// clang-tidy: don't pass be non-const reference
+void bench_evaluate_at_substep_times(benchmark::State& state) {  // NOLINT
+  const auto& function = shared_function();
+  const std::array<double, 3> substep_times{{1.0, 1.5, 2.0}};
+  size_t substep = 0;
+  while (state.KeepRunning()) {
+    evaluate(function, gsl::at(substep_times, substep), state.range(0));
+    substep = (substep + 1) % substep_times.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bench_evaluate_at_substep_times)  // NOLINT
+    ->DenseRange(0, 2)
+    ->ThreadRange(1, 8);
+
+// Evaluates the function at a new time every time, so every evaluation misses
+// the cache and replaces one of its entries
+// clang-tidy: don't pass be non-const reference
+void bench_evaluate_at_new_times(benchmark::State& state) {  // NOLINT
+  const auto& function = shared_function();
+  double time = 1.0;
+  while (state.KeepRunning()) {
+    evaluate(function, time, state.range(0));
+    time += 1.0e-3;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(bench_evaluate_at_new_times)  // NOLINT
+    ->DenseRange(0, 2)
+    ->ThreadRange(1, 8);
+}  // namespace
@@ -0,0 +1,203 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Executables/Benchmark/Helpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <size_t Dim>
+struct ScalarVar : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+template <size_t Dim>
+struct SpacetimeMetricVar : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Inertial>;
+};
+template <size_t Dim>
+struct PiVar : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Inertial>;
+};
+template <size_t Dim>
+struct PhiVar : db::SimpleTag {
+  using type = tnsr::iaa<DataVector, Dim, Frame::Inertial>;
+};
+
+// A single scalar, and the evolved variables of the GH system
+template <size_t Dim>
+using scalar_vars = tmpl::list<ScalarVar<Dim>>;
+template <size_t Dim>
+using gh_vars = tmpl::list<SpacetimeMetricVar<Dim>, PiVar<Dim>, PhiVar<Dim>>;
+
+template <size_t Dim>
+Mesh<Dim> make_mesh(const benchmark::State& state) noexcept {
+  return {static_cast<size_t>(state.range(0)), Spectral::Basis::Legendre,
+          Spectral::Quadrature::GaussLobatto};
+}
+
+template <size_t Dim>
+InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>
+make_inverse_jacobian(const size_t number_of_grid_points) noexcept {
+  InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial> result{
+      number_of_grid_points};
+  for (auto& component : result) {
+    benchmark_helpers::fill_with_random_values(component.data(),
+                                               component.size());
+  }
+  return result;
+}
+
+// A square matrix in every dimension, i.e. the same amount of work as an
+// interpolation, projection or filter matrix. The matrices are random rather
+// than spectral so the extents can exceed the largest spectral mesh and
+// exercise the BLAS fallback.
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const Mesh<Dim> mesh = make_mesh<Dim>(state);
+  const size_t number_of_components = static_cast<size_t>(state.range(1));
+  std::array<Matrix, Dim> matrices{};
+  for (size_t d = 0; d < Dim; ++d) {
+    auto& matrix = gsl::at(matrices, d);
+    matrix = Matrix(mesh.extents(d), mesh.extents(d));
+    // Fill column by column to leave the padding of the matrix untouched
+    for (size_t j = 0; j < matrix.columns(); ++j) {
+      benchmark_helpers::fill_with_random_values(&matrix(0, j), matrix.rows());
+    }
+  }
+  DataVector u{number_of_components * mesh.number_of_grid_points()};
+  benchmark_helpers::fill_with_random_values(u.data(), u.size());
+  DataVector result{u.size()};
+
+  while (state.KeepRunning()) {
+    apply_matrices(make_not_null(&result), matrices, u, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(u.size()));
+}
+BENCHMARK_TEMPLATE(bench_apply_matrices, 1)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_and_components_arguments);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 2)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_and_components_arguments);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 3)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_and_components_arguments);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim, typename VarsTags>
+void bench_partial_derivatives(benchmark::State& state) {  // NOLINT
+  const Mesh<Dim> mesh = make_mesh<Dim>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Variables<VarsTags> u{number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(u.data(), u.size());
+  const auto inverse_jacobian =
+      make_inverse_jacobian<Dim>(number_of_grid_points);
+  Variables<db::wrap_tags_in<Tags::deriv, VarsTags, tmpl::size_t<Dim>,
+                             Frame::Inertial>>
+      du{number_of_grid_points};
+
+  while (state.KeepRunning()) {
+    partial_derivatives<VarsTags>(make_not_null(&du), u, mesh,
+                                  inverse_jacobian);
+    benchmark::DoNotOptimize(du.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(u.size()));
+}
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 1, scalar_vars<1>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 2, scalar_vars<2>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 3, scalar_vars<3>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 3, gh_vars<3>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim, typename VarsTags>
+void bench_divergence(benchmark::State& state) {  // NOLINT
+  using flux_tags = db::wrap_tags_in<Tags::Flux, VarsTags, tmpl::size_t<Dim>,
+                                     Frame::Inertial>;
+  const Mesh<Dim> mesh = make_mesh<Dim>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Variables<flux_tags> fluxes{number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(fluxes.data(), fluxes.size());
+  const auto inverse_jacobian =
+      make_inverse_jacobian<Dim>(number_of_grid_points);
+  Variables<db::wrap_tags_in<Tags::div, flux_tags>> div_fluxes{
+      number_of_grid_points};
+
+  while (state.KeepRunning()) {
+    divergence(make_not_null(&div_fluxes), fluxes, mesh, inverse_jacobian);
+    benchmark::DoNotOptimize(div_fluxes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(fluxes.size()));
+}
+BENCHMARK_TEMPLATE(bench_divergence, 3, scalar_vars<3>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(bench_divergence, 3, gh_vars<3>)  // NOLINT
+    ->Apply(benchmark_helpers::grid_points_arguments);
+
+// The divergence on an element with an affine map, including the check for a
+// constant inverse Jacobian that selects this code path in the elliptic DG
+// operator. Compare to `bench_divergence`.
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim, typename VarsTags>
+void bench_divergence_with_constant_jacobian(  // NOLINT
+    benchmark::State& state) {
+  using flux_tags = db::wrap_tags_in<Tags::Flux, VarsTags, tmpl::size_t<Dim>,
+                                     Frame::Inertial>;
+  const Mesh<Dim> mesh = make_mesh<Dim>(state);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Variables<flux_tags> fluxes{number_of_grid_points};
+  benchmark_helpers::fill_with_random_values(fluxes.data(), fluxes.size());
+  auto inverse_jacobian = make_inverse_jacobian<Dim>(number_of_grid_points);
+  for (auto& component : inverse_jacobian) {
+    component = component[0];
+  }
+  Variables<db::wrap_tags_in<Tags::div, flux_tags>> div_fluxes{
+      number_of_grid_points};
+
+  while (state.KeepRunning()) {
+    if (has_constant_jacobian(inverse_jacobian)) {
+      divergence_with_constant_jacobian(make_not_null(&div_fluxes), fluxes,
+                                        mesh, inverse_jacobian);
+    }
+    benchmark::DoNotOptimize(div_fluxes.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(fluxes.size()));
+}
+BENCHMARK_TEMPLATE(bench_divergence_with_constant_jacobian, 3,  // NOLINT
+                   scalar_vars<3>)
+    ->Apply(benchmark_helpers::grid_points_arguments);
+BENCHMARK_TEMPLATE(bench_divergence_with_constant_jacobian, 3,  // NOLINT
+                   gh_vars<3>)
+    ->Apply(benchmark_helpers::grid_points_arguments);
+}  // namespace
@@ -0,0 +1,52 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <initializer_list>
+#include <random>
+
+namespace benchmark_helpers {
+/// Fill `size` doubles starting at `data` with random values in
+/// `[lower, upper)`. All calls draw from the same generator, so different
+/// buffers hold different values. Its seed is fixed so that different builds
+/// benchmark the same data.
+inline void fill_with_random_values(double* data, const size_t size,
+                                    const double lower = -1.0,
+                                    const double upper = 1.0) noexcept {
+  static std::mt19937 generator{1};
+  std::uniform_real_distribution<double> distribution{lower, upper};
+  for (size_t i = 0; i < size; ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data[i] = distribution(generator);
+  }
+}
+
+/// Number of grid points per dimension covering the meshes we typically
+/// evolve on.
+inline void grid_points_arguments(
+    benchmark::internal::Benchmark* benchmark) noexcept {
+  for (const int points : {4, 6, 8, 10, 12}) {
+    benchmark->Arg(points);
+  }
+}
+
+/// Number of grid points per dimension and number of independent components.
+///
+/// The extents above `apply_matrices_detail::max_sum_factorization_extent`
+/// cover the BLAS fallback of `apply_matrices`. Spectral meshes can't have this
+/// many points, so benchmarks with this argument can't use spectral matrices.
+inline void grid_points_and_components_arguments(
+    benchmark::internal::Benchmark* benchmark) noexcept {
+  for (const int points : {4, 6, 8, 10, 12, 14, 16}) {
+    for (const int components : {1, 10, 50}) {
+      benchmark->Args({points, components});
+    }
+  }
+}
+}  // namespace benchmark_helpers
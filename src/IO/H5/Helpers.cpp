@@ -4,6 +4,7 @@
 #include "IO/H5/Helpers.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -14,8 +15,10 @@
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Header.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "IO/H5/Type.hpp"
+#include "IO/H5/Version.hpp"
 #include "IO/H5/Wrappers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -642,6 +645,35 @@ GENERATE_INSTANTIATIONS(INSTANTIATE_READ_DATAVECTOR, (DataVector), (1, 2, 3))
 }  // namespace h5
 
 namespace h5::detail {
+std::string name_with_extension(const std::string& name,
+                                const std::string& extension) noexcept {
+  return name.size() > extension.size() and
+                 extension == name.substr(name.size() - extension.size())
+             ? name
+             : name + extension;
+}
+
+std::string open_or_write_version_and_header(
+    const bool subfile_exists, const hid_t subfile_group_id,
+    const gsl::not_null<uint32_t*> version) noexcept {
+  if (subfile_exists) {
+    // We treat this as an internal version for now. We'll need to deal with
+    // proper versioning later.
+    const Version open_version(true, OpenGroup{}, subfile_group_id, "version");
+    *version = open_version.get_version();
+    const Header header(true, OpenGroup{}, subfile_group_id, "header");
+    return header.get_header();
+  }
+  // Subfiles are closed as they go out of scope, so we have the extra braces
+  // here to add the necessary scope
+  {
+    Version open_version(false, OpenGroup{}, subfile_group_id, "version",
+                         *version);
+  }
+  const Header header(false, OpenGroup{}, subfile_group_id, "header");
+  return header.get_header();
+}
+
 template <size_t Dims>
 hid_t create_extensible_dataset(const hid_t group_id, const std::string& name,
                                 const std::array<hsize_t, Dims>& initial_size,
@@ -8,11 +8,13 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <hdf5.h>
 #include <string>
 #include <vector>
 
 #include "DataStructures/Index.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -163,6 +165,27 @@ Index<Dim> read_extents(hid_t group_id,
 
 namespace h5 {
 namespace detail {
+/*!
+ * \ingroup HDF5Group
+ * \brief The name of a subfile: `name` with the `extension` appended unless
+ * it already ends with it
+ */
+std::string name_with_extension(const std::string& name,
+                                const std::string& extension) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Read the version and header of the existing subfile whose group is
+ * `subfile_group_id`, or write them to it if the subfile is new
+ *
+ * \returns the header of the subfile
+ * \effects if `subfile_exists` then `version` is set to the version stored in
+ * the subfile, otherwise `version` is written to the subfile
+ */
+std::string open_or_write_version_and_header(
+    bool subfile_exists, hid_t subfile_group_id,
+    gsl::not_null<uint32_t*> version) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Create a dataset that can be extended/appended to
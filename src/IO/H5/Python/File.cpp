@@ -10,6 +10,7 @@
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
 #include "Utilities/MakeString.hpp"
 
 namespace py = pybind11;
@@ -57,6 +58,20 @@ void bind_h5file_impl(py::module& m) {  // NOLINT
                 return f.template get<h5::VolumeData>(path);
               },
               py::return_value_policy::reference, py::arg("path"))
+          .def(
+              "get_vol_index",
+              [](const H5File& f,
+                 const std::string& path) -> const h5::VolumeDataIndex& {
+                if (not f.template exists<h5::VolumeDataIndex>(path)) {
+                  const auto subfiles =
+                      boost::algorithm::join(f.groups(), ", ");
+                  throw std::runtime_error(
+                      "Subfile `" + path + "` was not found in file `" +
+                      f.name() + "`. Available subfiles are:\n" + subfiles);
+                }
+                return f.template get<h5::VolumeDataIndex>(path);
+              },
+              py::return_value_policy::reference, py::arg("path"))
           .def("__enter__", [](H5File& file) -> H5File& { return file; })
           .def("__exit__", [](H5File& f, const py::object& /* exception_type */,
                               const py::object& /* val */,
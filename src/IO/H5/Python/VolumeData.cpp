@@ -3,11 +3,13 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <cstddef>
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
 
 namespace py = pybind11;
 
@@ -27,8 +29,15 @@ void bind_h5vol(py::module& m) {  // NOLINT
            py::arg("observation_id"))
       .def("list_tensor_components", &h5::VolumeData::list_tensor_components,
            py::arg("observation_id"))
-      .def("get_tensor_component", &h5::VolumeData::get_tensor_component,
+      .def("get_tensor_component",
+           py::overload_cast<size_t, const std::string&>(
+               &h5::VolumeData::get_tensor_component, py::const_),
            py::arg("observation_id"), py::arg("tensor_component"))
+      .def("get_tensor_component",
+           py::overload_cast<size_t, const std::string&, size_t, size_t>(
+               &h5::VolumeData::get_tensor_component, py::const_),
+           py::arg("observation_id"), py::arg("tensor_component"),
+           py::arg("offset"), py::arg("length"))
       .def("get_extents", &h5::VolumeData::get_extents,
            py::arg("observation_id"))
       .def("get_quadratures", &h5::VolumeData::get_quadratures,
@@ -37,5 +46,29 @@ void bind_h5vol(py::module& m) {  // NOLINT
   m.def("offset_and_length_for_grid", &h5::offset_and_length_for_grid,
         py::arg("grid_name"), py::arg("all_grid_names"),
         py::arg("all_extents"));
+  m.def("offsets_and_lengths_for_grids", &h5::offsets_and_lengths_for_grids,
+        py::arg("all_grid_names"), py::arg("all_extents"));
+
+  py::class_<h5::GridLocation>(m, "GridLocation")
+      .def_readonly("shard", &h5::GridLocation::shard)
+      .def_readonly("offset", &h5::GridLocation::offset)
+      .def_readonly("length", &h5::GridLocation::length);
+  py::class_<h5::VolumeDataIndex>(m, "H5VolIndex")
+      .def_static("extension", &h5::VolumeDataIndex::extension)
+      .def("get_header", &h5::VolumeDataIndex::get_header)
+      .def("get_version", &h5::VolumeDataIndex::get_version)
+      .def("list_observation_ids", &h5::VolumeDataIndex::list_observation_ids)
+      .def("get_observation_value",
+           &h5::VolumeDataIndex::get_observation_value,
+           py::arg("observation_id"))
+      .def("find_observation_id", &h5::VolumeDataIndex::find_observation_id,
+           py::arg("observation_value"))
+      .def("get_shard_file_names", &h5::VolumeDataIndex::get_shard_file_names,
+           py::arg("observation_id"))
+      .def("get_grid_locations", &h5::VolumeDataIndex::get_grid_locations,
+           py::arg("observation_id"));
+  m.def("write_volume_data_index", &h5::write_volume_data_index,
+        py::arg("index_file_name"), py::arg("shard_file_names"),
+        py::arg("subfile_name"));
 }
 }  // namespace py_bindings
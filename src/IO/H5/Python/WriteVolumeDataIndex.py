@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import spectre.IO.H5 as spectre_h5
+import argparse
+import glob
+import logging
+import os
+
+
+def write_index(file_prefix, index_file, subfile_name):
+    """
+    Index the volume data subfile `subfile_name` in all H5 files that start
+    with the `file_prefix` followed by a number, i.e. the files written by each
+    node of a simulation. The index is written to the subfile of the same name
+    in the `index_file`.
+
+    The shard file names are stored relative to the directory of the
+    `index_file`, so the index and the shards can be moved together.
+    """
+    shard_files = sorted(glob.glob(file_prefix + "[0-9]*.h5"))
+    shard_files = [
+        shard_file for shard_file in shard_files
+        if os.path.abspath(shard_file) != os.path.abspath(index_file)
+    ]
+    assert len(shard_files) > 0, "No H5 files with prefix '{}' found.".format(
+        file_prefix)
+    index_dir = os.path.dirname(os.path.abspath(index_file))
+    shard_files = [
+        os.path.relpath(os.path.abspath(shard_file), index_dir)
+        for shard_file in shard_files
+    ]
+    logging.info("Indexing '{}' in {} files.".format(subfile_name,
+                                                    len(shard_files)))
+    spectre_h5.write_volume_data_index(index_file_name=index_file,
+                                       shard_file_names=shard_files,
+                                       subfile_name=subfile_name)
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=(
+            "Write an index of the volume data in the H5 files of a "
+            "simulation, so the data of any element can be located without "
+            "reading every file. The volume data importer reads through the "
+            "index when it is given the index file."))
+    parser.add_argument(
+        '--file-prefix',
+        required=True,
+        help="The common prefix of the H5 volume data files to index. The "
+        "files are the prefix followed by a number.")
+    parser.add_argument('--index-file',
+                        required=True,
+                        help="The H5 file to write the index to.")
+    parser.add_argument(
+        '--subfile-name',
+        required=True,
+        help="Name of the volume data subfile in the H5 files, e.g. "
+        "'/element_data'. The index is written to the subfile of the same "
+        "name in the index file.")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    logging.basicConfig(level=logging.INFO)
+    input_args = parse_args()
+    write_index(**vars(input_args))
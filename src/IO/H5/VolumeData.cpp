@@ -10,16 +10,19 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
-#include "IO/H5/Header.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/SpectralIo.hpp"
-#include "IO/H5/Version.hpp"
+#include "IO/H5/Type.hpp"
+#include "IO/H5/Wrappers.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -93,35 +96,11 @@ VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
                        const hid_t /*location*/, const std::string& name,
                        const uint32_t version) noexcept
     : group_(std::move(group)),
-      name_(name.size() > extension().size()
-                ? (extension() == name.substr(name.size() - extension().size())
-                       ? name
-                       : name + extension())
-                : name + extension()),
+      name_(detail::name_with_extension(name, extension())),
       version_(version),
       volume_data_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
-  if (subfile_exists) {
-    // We treat this as an internal version for now. We'll need to deal with
-    // proper versioning later.
-    const Version open_version(true, detail::OpenGroup{},
-                               volume_data_group_.id(), "version");
-    version_ = open_version.get_version();
-    const Header header(true, detail::OpenGroup{}, volume_data_group_.id(),
-                        "header");
-    header_ = header.get_header();
-  } else {  // file does not exist
-    // Subfiles are closed as they go out of scope, so we have the extra
-    // braces here to add the necessary scope
-    {
-      Version open_version(false, detail::OpenGroup{}, volume_data_group_.id(),
-                           "version", version_);
-    }
-    {
-      Header header(false, detail::OpenGroup{}, volume_data_group_.id(),
-                    "header");
-      header_ = header.get_header();
-    }
-  }
+  header_ = detail::open_or_write_version_and_header(
+      subfile_exists, volume_data_group_.id(), make_not_null(&version_));
 }
 
 // Write Volume Data stored in a vector of `ExtentsAndTensorVolumeData` to
@@ -356,6 +335,50 @@ DataVector VolumeData::get_tensor_component(
   }
 }
 
+DataVector VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component,
+    const size_t offset, const size_t length) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const hid_t dataset_id =
+      h5::open_dataset(observation_group.id(), tensor_component);
+  const hid_t dataspace_id = h5::open_dataspace(dataset_id);
+  if (H5Sget_simple_extent_ndims(dataspace_id) != 1) {
+    ERROR("Reading part of the tensor component '"
+          << tensor_component << "' requires a dataset of rank 1, but it has "
+          << "rank " << H5Sget_simple_extent_ndims(dataspace_id) << ".");
+  }
+  hsize_t size = 0;
+  H5Sget_simple_extent_dims(dataspace_id, &size, nullptr);
+  if (offset + length > size) {
+    ERROR("Trying to read the interval [" << offset << ", " << offset + length
+                                          << ") of the tensor component '"
+                                          << tensor_component
+                                          << "' which has only " << size
+                                          << " entries.");
+  }
+  DataVector data{length};
+  if (length > 0) {
+    const auto start = static_cast<hsize_t>(offset);
+    const auto count = static_cast<hsize_t>(length);
+    CHECK_H5(H5Sselect_hyperslab(dataspace_id, H5S_SELECT_SET, &start, nullptr,
+                                 &count, nullptr),
+             "Failed to select part of the tensor component '"
+                 << tensor_component << "'");
+    const hid_t memspace_id = H5Screate_simple(1, &count, nullptr);
+    CHECK_H5(memspace_id, "Failed to create memspace");
+    CHECK_H5(H5Dread(dataset_id, h5::h5_type<double>(), memspace_id,
+                     dataspace_id, h5::h5p_default(), data.data()),
+             "Failed to read part of the tensor component '"
+                 << tensor_component << "'");
+    CHECK_H5(H5Sclose(memspace_id), "Failed to close memspace");
+  }
+  h5::close_dataspace(dataspace_id);
+  h5::close_dataset(dataset_id);
+  return data;
+}
+
 std::vector<std::vector<size_t>> VolumeData::get_extents(
     const size_t observation_id) const noexcept {
   const std::string path = "ObservationId" + std::to_string(observation_id);
@@ -396,6 +419,27 @@ std::pair<size_t, size_t> offset_and_length_for_grid(
   }
 }
 
+std::unordered_map<std::string, std::pair<size_t, size_t>>
+offsets_and_lengths_for_grids(
+    const std::vector<std::string>& all_grid_names,
+    const std::vector<std::vector<size_t>>& all_extents) noexcept {
+  ASSERT(all_grid_names.size() == all_extents.size(),
+         "Got " << all_grid_names.size() << " grid names but "
+                << all_extents.size() << " extents.");
+  std::unordered_map<std::string, std::pair<size_t, size_t>>
+      offsets_and_lengths{};
+  offsets_and_lengths.reserve(all_grid_names.size());
+  size_t offset = 0;
+  for (size_t i = 0; i < all_grid_names.size(); ++i) {
+    const size_t length =
+        alg::accumulate(all_extents[i], 1_st, std::multiplies<>{});
+    offsets_and_lengths.emplace(all_grid_names[i],
+                                std::make_pair(offset, length));
+    offset += length;
+  }
+  return offsets_and_lengths;
+}
+
 size_t VolumeData::get_dimension() const noexcept {
   return h5::read_value_attribute<double>(volume_data_group_.id(), "dimension");
 }
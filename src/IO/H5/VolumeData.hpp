@@ -10,6 +10,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "IO/H5/Object.hpp"
@@ -132,6 +133,15 @@ class VolumeData : public h5::Object {
       size_t observation_id,
       const std::string& tensor_component) const noexcept;
 
+  /// Read the part `[offset, offset + length)` of the tensor component with
+  /// name `tensor_component` at observation id `observation_id`, e.g. the
+  /// data of the grids found with `h5::offsets_and_lengths_for_grids`. Only
+  /// the requested part of the dataset is read from disk.
+  DataVector get_tensor_component(size_t observation_id,
+                                  const std::string& tensor_component,
+                                  size_t offset,
+                                  size_t length) const noexcept;
+
   /// Read the extents of all the grids stored in the file at the observation id
   /// `observation_id`
   std::vector<std::vector<size_t>> get_extents(
@@ -188,4 +198,18 @@ std::pair<size_t, size_t> offset_and_length_for_grid(
     const std::vector<std::string>& all_grid_names,
     const std::vector<std::vector<size_t>>& all_extents) noexcept;
 
+/*!
+ * \brief The intervals within the contiguous dataset stored in
+ * `h5::VolumeData` that hold the data of each grid, keyed by the grid name.
+ *
+ * Same as calling `h5::offset_and_length_for_grid` for every grid, but builds
+ * all intervals in a single pass so that looking up many grids is linear in
+ * the number of grids rather than quadratic.
+ *
+ * \see `h5::VolumeData`
+ */
+std::unordered_map<std::string, std::pair<size_t, size_t>>
+offsets_and_lengths_for_grids(
+    const std::vector<std::string>& all_grid_names,
+    const std::vector<std::vector<size_t>>& all_extents) noexcept;
 }  // namespace h5
@@ -0,0 +1,235 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/VolumeDataIndex.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <functional>
+#include <hdf5.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/Helpers.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace h5 {
+namespace {
+// Write the `names` as a vector of chars with individual names separated by
+// `VolumeData::separator()`
+void write_names(const hid_t group_id, const std::vector<std::string>& names,
+                 const std::string& dataset_name) noexcept {
+  std::vector<char> names_as_chars{};
+  for (const auto& name : names) {
+    names_as_chars.insert(names_as_chars.end(), name.begin(), name.end());
+    names_as_chars.push_back(VolumeData::separator());
+  }
+  h5::write_data(group_id, names_as_chars, {names_as_chars.size()},
+                 dataset_name);
+}
+
+std::vector<std::string> read_names(const hid_t group_id,
+                                    const std::string& dataset_name) noexcept {
+  const std::vector<char> names_as_chars =
+      h5::read_data<1, std::vector<char>>(group_id, dataset_name);
+  const std::string all_names(names_as_chars.begin(), names_as_chars.end());
+  std::vector<std::string> names{};
+  boost::split(names, all_names, [](const char c) noexcept {
+    return c == VolumeData::separator();
+  });
+  // boost::split counts the last separator as a split even though there are no
+  // characters after it, so the last entry of the vector is empty
+  names.pop_back();
+  return names;
+}
+}  // namespace
+
+VolumeDataIndex::VolumeDataIndex(const bool subfile_exists,
+                                 detail::OpenGroup&& group,
+                                 const hid_t /*location*/,
+                                 const std::string& name,
+                                 const uint32_t version) noexcept
+    : group_(std::move(group)),
+      name_(detail::name_with_extension(name, extension())),
+      version_(version),
+      index_group_(group_.id(), name_, h5::AccessType::ReadWrite) {
+  header_ = detail::open_or_write_version_and_header(
+      subfile_exists, index_group_.id(), make_not_null(&version_));
+}
+
+void VolumeDataIndex::write_index(
+    const size_t observation_id, const double observation_value,
+    const std::vector<std::string>& shard_file_names,
+    const std::vector<std::vector<std::string>>& grid_names,
+    const std::vector<std::vector<std::vector<size_t>>>& extents) noexcept {
+  ASSERT(grid_names.size() == shard_file_names.size() and
+             extents.size() == shard_file_names.size(),
+         "Expected grid names and extents for each of the "
+             << shard_file_names.size() << " shards, but got "
+             << grid_names.size() << " and " << extents.size() << ".");
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  if (contains_dataset_or_group(index_group_.id(), "", path)) {
+    ERROR("Trying to write the index of ObservationId "
+          << observation_id << " which already exists in file at " << path
+          << ".");
+  }
+  detail::OpenGroup observation_group(index_group_.id(), path,
+                                      AccessType::ReadWrite);
+
+  std::vector<std::string> all_grid_names{};
+  std::vector<size_t> shards{};
+  std::vector<size_t> offsets{};
+  std::vector<size_t> lengths{};
+  for (size_t shard = 0; shard < shard_file_names.size(); ++shard) {
+    ASSERT(grid_names[shard].size() == extents[shard].size(),
+           "Got " << grid_names[shard].size() << " grid names but "
+                  << extents[shard].size() << " extents for shard '"
+                  << shard_file_names[shard] << "'.");
+    size_t offset = 0;
+    for (size_t grid = 0; grid < grid_names[shard].size(); ++grid) {
+      const size_t length =
+          alg::accumulate(extents[shard][grid], 1_st, std::multiplies<>{});
+      all_grid_names.push_back(grid_names[shard][grid]);
+      shards.push_back(shard);
+      offsets.push_back(offset);
+      lengths.push_back(length);
+      offset += length;
+    }
+  }
+  if (all_grid_names.empty()) {
+    ERROR("Trying to write an index of ObservationId "
+          << observation_id << " that contains no grids.");
+  }
+
+  h5::write_to_attribute(observation_group.id(), "observation_value",
+                         observation_value);
+  write_names(observation_group.id(), shard_file_names, "shard_file_names");
+  write_names(observation_group.id(), all_grid_names, "grid_names");
+  h5::write_data(observation_group.id(), shards, {shards.size()}, "shards");
+  h5::write_data(observation_group.id(), offsets, {offsets.size()}, "offsets");
+  h5::write_data(observation_group.id(), lengths, {lengths.size()}, "lengths");
+}
+
+std::vector<size_t> VolumeDataIndex::list_observation_ids() const noexcept {
+  const auto names = get_group_names(index_group_.id(), "");
+  const auto helper = [](const std::string& s) noexcept {
+    return std::stoul(s.substr(std::string("ObservationId").size()));
+  };
+  return {boost::make_transform_iterator(names.begin(), helper),
+          boost::make_transform_iterator(names.end(), helper)};
+}
+
+double VolumeDataIndex::get_observation_value(
+    const size_t observation_id) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(index_group_.id(), path,
+                                      AccessType::ReadOnly);
+  return h5::read_value_attribute<double>(observation_group.id(),
+                                          "observation_value");
+}
+
+size_t VolumeDataIndex::find_observation_id(
+    const double observation_value) const noexcept {
+  for (const size_t observation_id : list_observation_ids()) {
+    if (get_observation_value(observation_id) == observation_value) {
+      return observation_id;
+    }
+  }
+  ERROR("No observation with value " << observation_value
+                                     << " found in volume data index.");
+}
+
+std::vector<std::string> VolumeDataIndex::get_shard_file_names(
+    const size_t observation_id) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(index_group_.id(), path,
+                                      AccessType::ReadOnly);
+  return read_names(observation_group.id(), "shard_file_names");
+}
+
+std::unordered_map<std::string, GridLocation>
+VolumeDataIndex::get_grid_locations(
+    const size_t observation_id) const noexcept {
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  detail::OpenGroup observation_group(index_group_.id(), path,
+                                      AccessType::ReadOnly);
+  const auto grid_names = read_names(observation_group.id(), "grid_names");
+  const auto shards = h5::read_data<1, std::vector<size_t>>(
+      observation_group.id(), "shards");
+  const auto offsets = h5::read_data<1, std::vector<size_t>>(
+      observation_group.id(), "offsets");
+  const auto lengths = h5::read_data<1, std::vector<size_t>>(
+      observation_group.id(), "lengths");
+  ASSERT(shards.size() == grid_names.size() and
+             offsets.size() == grid_names.size() and
+             lengths.size() == grid_names.size(),
+         "The index of ObservationId " << observation_id
+                                       << " is inconsistent.");
+  std::unordered_map<std::string, GridLocation> grid_locations{};
+  grid_locations.reserve(grid_names.size());
+  for (size_t i = 0; i < grid_names.size(); ++i) {
+    grid_locations.emplace(grid_names[i],
+                           GridLocation{shards[i], offsets[i], lengths[i]});
+  }
+  return grid_locations;
+}
+
+std::string shard_file_path(const std::string& index_file_name,
+                            const std::string& shard_file_name) noexcept {
+  if (shard_file_name.empty() or shard_file_name.front() == '/') {
+    return shard_file_name;
+  }
+  return file_system::get_parent_path(index_file_name) + "/" +
+         shard_file_name;
+}
+
+void write_volume_data_index(const std::string& index_file_name,
+                             const std::vector<std::string>& shard_file_names,
+                             const std::string& subfile_name) noexcept {
+  // Observation value and the grid names and extents of every shard, for each
+  // observation id
+  struct Grids {
+    double observation_value{};
+    std::vector<std::vector<std::string>> grid_names{};
+    std::vector<std::vector<std::vector<size_t>>> extents{};
+  };
+  std::map<size_t, Grids> grids{};
+  for (size_t shard = 0; shard < shard_file_names.size(); ++shard) {
+    const h5::H5File<h5::AccessType::ReadOnly> shard_file{
+        shard_file_path(index_file_name, shard_file_names[shard])};
+    if (not shard_file.exists<h5::VolumeData>(subfile_name)) {
+      continue;
+    }
+    const auto& volume_file = shard_file.get<h5::VolumeData>(subfile_name);
+    for (const size_t observation_id : volume_file.list_observation_ids()) {
+      auto& [observation_value, grid_names, extents] = grids[observation_id];
+      if (grid_names.empty()) {
+        observation_value = volume_file.get_observation_value(observation_id);
+        grid_names.resize(shard_file_names.size());
+        extents.resize(shard_file_names.size());
+      }
+      grid_names[shard] = volume_file.get_grid_names(observation_id);
+      extents[shard] = volume_file.get_extents(observation_id);
+    }
+  }
+
+  h5::H5File<h5::AccessType::ReadWrite> index_file{index_file_name, true};
+  auto& index = index_file.try_insert<h5::VolumeDataIndex>(subfile_name);
+  for (const auto& [observation_id, grids_at_observation] : grids) {
+    index.write_index(observation_id, grids_at_observation.observation_value,
+                      shard_file_names, grids_at_observation.grid_names,
+                      grids_at_observation.extents);
+  }
+}
+}  // namespace h5
@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <hdf5.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IO/H5/Object.hpp"
+#include "IO/H5/OpenGroup.hpp"
+
+namespace h5 {
+/// \ingroup HDF5Group
+/// The location of the data of a single grid in a set of `h5::VolumeData`
+/// files, e.g. the files written by each node of a simulation.
+///
+/// `shard` indexes the list of file names that the `h5::VolumeDataIndex` was
+/// built from, and `offset` and `length` locate the data of the grid in the
+/// contiguous tensor datasets of that file (see
+/// `h5::offset_and_length_for_grid`).
+struct GridLocation {
+  size_t shard;
+  size_t offset;
+  size_t length;
+};
+
+/*!
+ * \ingroup HDF5Group
+ * \brief An index of where the data of each grid is stored in a set of
+ * `h5::VolumeData` files.
+ *
+ * Volume data is written to one H5 file (shard) per node, so finding the data
+ * of a particular grid requires reading the grid names from every shard. This
+ * subfile stores, for each observation id, the names of the shards together
+ * with the shard, offset and length of every grid, so that readers can load
+ * it once and then locate the data of any grid in constant time with
+ * `get_grid_locations`.
+ *
+ * The index is built from a set of shards after they have been written, with
+ * `h5::write_volume_data_index` or the `WriteVolumeDataIndex` command-line
+ * script. `importers::Actions::ReadAllVolumeDataAndDistribute` reads through
+ * the index when the file it is given contains one in place of the volume
+ * data subfile.
+ */
+class VolumeDataIndex : public h5::Object {
+ public:
+  static std::string extension() noexcept { return ".idx"; }
+
+  VolumeDataIndex(bool subfile_exists, detail::OpenGroup&& group,
+                  hid_t location, const std::string& name,
+                  uint32_t version = 1) noexcept;
+
+  VolumeDataIndex(const VolumeDataIndex& /*rhs*/) = delete;
+  VolumeDataIndex& operator=(const VolumeDataIndex& /*rhs*/) = delete;
+  VolumeDataIndex(VolumeDataIndex&& /*rhs*/) noexcept = delete;  // NOLINT
+  VolumeDataIndex& operator=(VolumeDataIndex&& /*rhs*/) noexcept =  // NOLINT
+      delete;
+
+  ~VolumeDataIndex() override = default;
+
+  /// \returns the header of the VolumeDataIndex file
+  const std::string& get_header() const noexcept { return header_; }
+
+  /// \returns the user-specified version number of the VolumeDataIndex file
+  uint32_t get_version() const noexcept { return version_; }
+
+  /// Insert the index of the grids at `observation_id`, which has the
+  /// `observation_value`. The `grid_names[shard]` and `extents[shard]` are the
+  /// results of `h5::VolumeData::get_grid_names` and
+  /// `h5::VolumeData::get_extents` for the file `shard_file_names[shard]`.
+  void write_index(
+      size_t observation_id, double observation_value,
+      const std::vector<std::string>& shard_file_names,
+      const std::vector<std::vector<std::string>>& grid_names,
+      const std::vector<std::vector<std::vector<size_t>>>& extents) noexcept;
+
+  /// List all the integral observation ids in the subfile
+  std::vector<size_t> list_observation_ids() const noexcept;
+
+  /// Get the observation value at the integral observation id in the subfile
+  double get_observation_value(size_t observation_id) const noexcept;
+
+  /// Find the observation ID that matches the `observation_value`
+  size_t find_observation_id(double observation_value) const noexcept;
+
+  /// The names of the files that the index at `observation_id` refers to
+  std::vector<std::string> get_shard_file_names(
+      size_t observation_id) const noexcept;
+
+  /// The location of the data of every grid at `observation_id`, keyed by the
+  /// grid name
+  std::unordered_map<std::string, GridLocation> get_grid_locations(
+      size_t observation_id) const noexcept;
+
+ private:
+  detail::OpenGroup group_{};
+  std::string name_{};
+  uint32_t version_{};
+  detail::OpenGroup index_group_{};
+  std::string header_{};
+};
+
+/// \ingroup HDF5Group
+/// The path to the shard `shard_file_name` listed in the index in the file
+/// `index_file_name`. Relative shard file names are relative to the directory
+/// of the index file, so the index and its shards can be moved together.
+std::string shard_file_path(const std::string& index_file_name,
+                            const std::string& shard_file_name) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Build an `h5::VolumeDataIndex` of the `h5::VolumeData` subfile
+ * `subfile_name` in the `shard_file_names` and write it to the subfile of the
+ * same name in the file `index_file_name`.
+ *
+ * All observation ids found in any of the shards are indexed. The grid names
+ * and extents of each shard are read once per observation id. Relative
+ * `shard_file_names` are relative to the directory of the index file (see
+ * `h5::shard_file_path`).
+ */
+void write_volume_data_index(const std::string& index_file_name,
+                             const std::vector<std::string>& shard_file_names,
+                             const std::string& subfile_name) noexcept;
+}  // namespace h5
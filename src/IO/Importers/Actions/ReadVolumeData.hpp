@@ -3,8 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <string>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -13,6 +19,7 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
 #include "IO/Importers/Tags.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "Parallel/ArrayIndex.hpp"
@@ -119,6 +126,11 @@ struct ReadVolumeData {
  * tensor data is stored in datasets named `db::tag_name<Tag>() + suffix`, where
  * the `suffix` is empty for scalars or `"_"` followed by the
  * `Tensor::component_name` for each independent tensor component.
+ * - The file may hold an `h5::VolumeDataIndex` instead of the volume data
+ * itself, e.g. one written by the `WriteVolumeDataIndex` script after a
+ * simulation that wrote a volume data file per node. Then the index locates
+ * each element's data, and only the shards that hold registered elements are
+ * opened and read.
  * - `Parallel::receive_data` is invoked on each registered element of the
  * `ReceiveComponent` to populate `importers::Tags::VolumeData` in the element's
  * inbox with a `tuples::tagged_tuple_from_typelist<FieldTagsList>` containing
@@ -162,35 +174,10 @@ struct ReadAllVolumeDataAndDistribute {
           local_has_read_volume_data->insert(std::move(volume_data_id));
         });
 
-    // Open the volume data file
-    h5::H5File<h5::AccessType::ReadOnly> h5file(
-        Parallel::get<Tags::FileName<ImporterOptionsGroup>>(cache));
-    constexpr size_t version_number = 0;
-    const auto& volume_file = h5file.get<h5::VolumeData>(
-        "/" + Parallel::get<Tags::Subgroup<ImporterOptionsGroup>>(cache),
-        version_number);
-    const auto observation_id = volume_file.find_observation_id(
-        Parallel::get<Tags::ObservationValue<ImporterOptionsGroup>>(cache));
-    // Read the tensor data for all elements at once, since that's how it's
-    // stored in the file
-    tuples::tagged_tuple_from_typelist<FieldTagsList> all_tensor_data{};
-    tmpl::for_each<FieldTagsList>([&all_tensor_data, &volume_file,
-                                   &observation_id](auto field_tag_v) noexcept {
-      using field_tag = tmpl::type_from<decltype(field_tag_v)>;
-      auto& tensor_data = get<field_tag>(all_tensor_data);
-      for (size_t i = 0; i < tensor_data.size(); i++) {
-        tensor_data[i] = volume_file.get_tensor_component(
-            observation_id,
-            db::tag_name<field_tag>() +
-                tensor_data.component_suffix(tensor_data.get_tensor_index(i)));
-      }
-    });
-    // Retrieve the information needed to reconstruct which element the data
-    // belongs to
-    const auto all_grid_names = volume_file.get_grid_names(observation_id);
-    const auto all_extents = volume_file.get_extents(observation_id);
-    // Distribute the tensor data to the registered elements
-    for (auto& element_and_name : get<Tags::RegisteredElements>(box)) {
+    // Collect the registered elements of the `ReceiveComponent` and the names
+    // of their grids in the volume data
+    std::vector<std::pair<CkArrayIndex, std::string>> elements_and_grid_names{};
+    for (const auto& element_and_name : get<Tags::RegisteredElements>(box)) {
       const CkArrayIndex& raw_element_index =
           element_and_name.first.array_index();
       // Check if the parallel component of the registered element matches the
@@ -204,15 +191,132 @@ struct ReadAllVolumeDataAndDistribute {
               raw_element_index)) {
         continue;
       }
-      // Find the data offset that corresponds to this element
-      const auto element_data_offset_and_length =
-          h5::offset_and_length_for_grid(element_and_name.second,
-                                         all_grid_names, all_extents);
+      elements_and_grid_names.emplace_back(raw_element_index,
+                                           element_and_name.second);
+    }
+    if (elements_and_grid_names.empty()) {
+      return;
+    }
+
+    // Open the volume data file
+    const std::string& file_name =
+        Parallel::get<Tags::FileName<ImporterOptionsGroup>>(cache);
+    const std::string subfile_name =
+        "/" + Parallel::get<Tags::Subgroup<ImporterOptionsGroup>>(cache);
+    const double observation_value =
+        Parallel::get<Tags::ObservationValue<ImporterOptionsGroup>>(cache);
+    h5::H5File<h5::AccessType::ReadOnly> h5file(file_name);
+    if (h5file.exists<h5::VolumeDataIndex>(subfile_name)) {
+      // The file holds an index of the volume data in a set of shards, so we
+      // look up the shard, offset and length of each element's grid in the
+      // index instead of reading the grid names from every shard
+      size_t observation_id = 0;
+      std::vector<std::string> shard_file_names{};
+      std::unordered_map<std::string, h5::GridLocation> grid_locations{};
+      {
+        const auto& index = h5file.get<h5::VolumeDataIndex>(subfile_name);
+        observation_id = index.find_observation_id(observation_value);
+        shard_file_names = index.get_shard_file_names(observation_id);
+        grid_locations = index.get_grid_locations(observation_id);
+        h5file.close_current_object();
+      }
+      std::vector<ElementsOffsetsAndLengths> elements_offsets_and_lengths(
+          shard_file_names.size());
+      for (auto& [raw_element_index, grid_name] : elements_and_grid_names) {
+        const auto found_location = grid_locations.find(grid_name);
+        if (found_location == grid_locations.end()) {
+          ERROR("Found no grid named '" + grid_name + "' in the index.");
+        }
+        const h5::GridLocation& location = found_location->second;
+        elements_offsets_and_lengths[location.shard].emplace_back(
+            std::move(raw_element_index),
+            std::make_pair(location.offset, location.length));
+      }
+      for (size_t shard = 0; shard < shard_file_names.size(); ++shard) {
+        if (elements_offsets_and_lengths[shard].empty()) {
+          continue;
+        }
+        const h5::H5File<h5::AccessType::ReadOnly> shard_file(
+            h5::shard_file_path(file_name, shard_file_names[shard]));
+        read_and_distribute(
+            shard_file.get<h5::VolumeData>(subfile_name), observation_id,
+            elements_offsets_and_lengths[shard], make_not_null(&cache));
+      }
+      return;
+    }
+
+    constexpr size_t version_number = 0;
+    const auto& volume_file =
+        h5file.get<h5::VolumeData>(subfile_name, version_number);
+    const auto observation_id =
+        volume_file.find_observation_id(observation_value);
+    // Find the data of all registered elements in the file. The intervals are
+    // computed once for all grids so finding each element is a hash lookup.
+    const auto all_offsets_and_lengths = h5::offsets_and_lengths_for_grids(
+        volume_file.get_grid_names(observation_id),
+        volume_file.get_extents(observation_id));
+    ElementsOffsetsAndLengths elements_offsets_and_lengths{};
+    for (auto& [raw_element_index, grid_name] : elements_and_grid_names) {
+      const auto found_offset_and_length =
+          all_offsets_and_lengths.find(grid_name);
+      if (found_offset_and_length == all_offsets_and_lengths.end()) {
+        ERROR("Found no grid named '" + grid_name + "'.");
+      }
+      elements_offsets_and_lengths.emplace_back(
+          std::move(raw_element_index), found_offset_and_length->second);
+    }
+    read_and_distribute(volume_file, observation_id,
+                        elements_offsets_and_lengths, make_not_null(&cache));
+  }
+
+ private:
+  // The elements and the offset and length of their data in a volume file
+  using ElementsOffsetsAndLengths =
+      std::vector<std::pair<CkArrayIndex, std::pair<size_t, size_t>>>;
+
+  // Read the part of the tensor data in the `volume_file` that spans the
+  // elements and distribute it to them
+  template <typename Metavariables>
+  static void read_and_distribute(
+      const h5::VolumeData& volume_file, const size_t observation_id,
+      const ElementsOffsetsAndLengths& elements_offsets_and_lengths,
+      const gsl::not_null<Parallel::GlobalCache<Metavariables>*>
+          cache) noexcept {
+    // Read only the part of the tensor data that spans the registered
+    // elements. The data of each grid is stored contiguously, so this is
+    // typically much less than the full datasets.
+    size_t read_offset = std::numeric_limits<size_t>::max();
+    size_t read_end = 0;
+    for (const auto& element_offset_and_length :
+         elements_offsets_and_lengths) {
+      const auto& [offset, length] = element_offset_and_length.second;
+      read_offset = std::min(read_offset, offset);
+      read_end = std::max(read_end, offset + length);
+    }
+    tuples::tagged_tuple_from_typelist<FieldTagsList> all_tensor_data{};
+    tmpl::for_each<FieldTagsList>([&all_tensor_data, &observation_id,
+                                   &read_end, &read_offset,
+                                   &volume_file](auto field_tag_v) noexcept {
+      using field_tag = tmpl::type_from<decltype(field_tag_v)>;
+      auto& tensor_data = get<field_tag>(all_tensor_data);
+      for (size_t i = 0; i < tensor_data.size(); i++) {
+        tensor_data[i] = volume_file.get_tensor_component(
+            observation_id,
+            db::tag_name<field_tag>() +
+                tensor_data.component_suffix(tensor_data.get_tensor_index(i)),
+            read_offset, read_end - read_offset);
+      }
+    });
+    // Distribute the tensor data to the registered elements
+    for (const auto& [raw_element_index, element_data_offset_and_length] :
+         elements_offsets_and_lengths) {
       // Extract this element's data from the read-in dataset
       tuples::tagged_tuple_from_typelist<FieldTagsList> element_data{};
-      tmpl::for_each<FieldTagsList>([&element_data,
-                                     &element_data_offset_and_length,
-                                     &all_tensor_data](
+      const size_t element_data_offset =
+          element_data_offset_and_length.first - read_offset;
+      const size_t element_data_length = element_data_offset_and_length.second;
+      tmpl::for_each<FieldTagsList>([&element_data, &element_data_offset,
+                                     &element_data_length, &all_tensor_data](
                                         auto field_tag_v) noexcept {
         using field_tag = tmpl::type_from<decltype(field_tag_v)>;
         auto& element_tensor_data = get<field_tag>(element_data);
@@ -220,14 +324,13 @@ struct ReadAllVolumeDataAndDistribute {
         for (size_t i = 0; i < element_tensor_data.size(); i++) {
           const DataVector& data_tensor_component =
               get<field_tag>(all_tensor_data)[i];
-          DataVector element_tensor_component{
-              element_data_offset_and_length.second};
+          DataVector element_tensor_component{element_data_length};
           // Retrieve data from slice of the contigious dataset
           for (size_t j = 0; j < element_tensor_component.size(); j++) {
             element_tensor_component[j] =
-                data_tensor_component[element_data_offset_and_length.first + j];
+                data_tensor_component[element_data_offset + j];
           }
-          element_tensor_data[i] = element_tensor_component;
+          element_tensor_data[i] = std::move(element_tensor_component);
         }
       });
       // Pass the data to the element
@@ -238,7 +341,7 @@ struct ReadAllVolumeDataAndDistribute {
       Parallel::receive_data<
           Tags::VolumeData<ImporterOptionsGroup, FieldTagsList>>(
           Parallel::get_parallel_component<ReceiveComponent>(
-              cache)[element_index],
+              *cache)[element_index],
           // Using `0` for the temporal ID since we only read the volume data
           // once, so there's no need to keep track of the temporal ID.
           0_st, std::move(element_data));
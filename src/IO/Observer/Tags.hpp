@@ -6,9 +6,11 @@
 #include <atomic>
 #include <converse.h>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -105,6 +107,26 @@ struct TensorData : db::SimpleTag {
                                             ElementVolumeData>>;
 };
 
+/// \brief Volume data of completed observations that is waiting to be written
+/// to disk.
+///
+/// Each entry holds the name of the `h5::VolumeData` subfile, the observation
+/// id, and the data of all elements on the node. The queue is guarded by the
+/// `VolumeDataLock` and drained by a single thread on the node, so that
+/// contributing volume data does not have to wait for the disk.
+struct VolumeDataWriteQueue : db::SimpleTag {
+  using type = std::deque<std::tuple<std::string, observers::ObservationId,
+                                     std::vector<ElementVolumeData>>>;
+};
+
+/// \brief Whether a thread on the node is currently writing the
+/// `VolumeDataWriteQueue` to disk.
+///
+/// Guarded by the `VolumeDataLock`.
+struct VolumeDataWriterIsActive : db::SimpleTag {
+  using type = bool;
+};
+
 /// \cond
 template <class... ReductionDatums>
 struct ReductionDataNames;
@@ -5,7 +5,10 @@
 
 #include <cstddef>
 #include <iterator>
+#include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Index.hpp"
@@ -157,13 +160,97 @@ struct ContributeVolumeData {
 }  // namespace Actions
 
 namespace ThreadedActions {
+namespace VolumeActions_detail {
+/*!
+ * \brief Write all volume data in the `write_queue` to disk.
+ *
+ * The calling thread must have set `writer_is_active` while holding the
+ * `volume_data_lock`, so that only one thread on the node drains the queue.
+ * Data queued by other threads while this thread writes is written too, and
+ * `writer_is_active` is reset once the queue is empty. The H5 file is opened
+ * only once for all queued observations.
+ */
+template <typename ParallelComponent, typename Metavariables>
+void write_queued_volume_data(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const gsl::not_null<Parallel::NodeLock*> volume_file_lock,
+    const gsl::not_null<Parallel::NodeLock*> volume_data_lock,
+    const gsl::not_null<Tags::VolumeDataWriteQueue::type*> write_queue,
+    const gsl::not_null<bool*> writer_is_active) noexcept {
+  volume_file_lock->lock();
+  {
+    // Scoping is for closing HDF5 file before we release the lock.
+    const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    h5::H5File<h5::AccessType::ReadWrite> h5file(
+        file_prefix +
+            std::to_string(Parallel::my_node(*my_proxy.ckLocalBranch())) +
+            ".h5",
+        true);
+    constexpr size_t version_number = 0;
+    for (;;) {
+      volume_data_lock->lock();
+      if (write_queue->empty()) {
+        *writer_is_active = false;
+        volume_data_lock->unlock();
+        break;
+      }
+      const auto [subfile_name, observation_id, dg_elements] =
+          std::move(write_queue->front());
+      write_queue->pop_front();
+      volume_data_lock->unlock();
+
+      auto& volume_file =
+          h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
+      volume_file.write_volume_data(observation_id.hash(),
+                                    observation_id.value(), dg_elements);
+    }
+  }
+  volume_file_lock->unlock();
+}
+
+/*!
+ * \brief Wait until the `write_queue` holds at most `maximum_size`
+ * observations or no thread is writing it to disk anymore.
+ *
+ * The writing thread removes one observation at a time from the queue while
+ * holding the `volume_data_lock`, so this function returns as soon as the
+ * writer frees a slot in the queue, not only once it has drained the queue.
+ */
+template <typename LockType>
+void wait_for_space_in_write_queue(
+    const gsl::not_null<LockType*> volume_data_lock,
+    const gsl::not_null<const Tags::VolumeDataWriteQueue::type*> write_queue,
+    const gsl::not_null<const bool*> writer_is_active,
+    const size_t maximum_size) noexcept {
+  for (;;) {
+    volume_data_lock->lock();
+    const bool has_space =
+        write_queue->size() <= maximum_size or not *writer_is_active;
+    volume_data_lock->unlock();
+    if (has_space) {
+      return;
+    }
+    std::this_thread::yield();
+  }
+}
+}  // namespace VolumeActions_detail
+
 /*!
  * \ingroup ObserversGroup
  * \brief Move data to the observer writer for writing to disk.
  *
- * Once data from all cores is collected this action writes the data to disk.
+ * Once data from all cores is collected for an observation it is added to the
+ * `Tags::VolumeDataWriteQueue`. If no other thread on the node is writing
+ * volume data, this thread drains the queue to disk. Otherwise the action
+ * returns without waiting for the disk, unless more than
+ * `maximum_queued_observations` observations are waiting to be written, in
+ * which case it waits until the writing thread has freed a slot in the queue
+ * in order to bound the memory held by the queue.
  */
 struct ContributeVolumeDataToWriter {
+  static constexpr size_t maximum_queued_observations = 4;
+
   template <typename ParallelComponent, typename DbTagsList,
             typename Metavariables, typename ArrayIndex>
   static void apply(
@@ -178,6 +265,10 @@ struct ContributeVolumeDataToWriter {
                   tmpl::list_contains_v<DbTagsList,
                                         Tags::ContributorsOfTensorData> and
                   tmpl::list_contains_v<DbTagsList, Tags::VolumeDataLock> and
+                  tmpl::list_contains_v<DbTagsList,
+                                        Tags::VolumeDataWriteQueue> and
+                  tmpl::list_contains_v<DbTagsList,
+                                        Tags::VolumeDataWriterIsActive> and
                   tmpl::list_contains_v<DbTagsList, Tags::H5FileLock>) {
       // The below gymnastics with pointers is done in order to minimize the
       // time spent locking the entire node, which is necessary because the
@@ -192,8 +283,8 @@ struct ContributeVolumeDataToWriter {
           observers::ObservationId,
           std::unordered_map<observers::ArrayComponentId, ElementVolumeData>>*
           all_volume_data = nullptr;
-      std::unordered_map<observers::ArrayComponentId, ElementVolumeData>
-          volume_data;
+      Tags::VolumeDataWriteQueue::type* write_queue = nullptr;
+      bool* volume_writer_is_active = nullptr;
       Parallel::NodeLock* volume_file_lock = nullptr;
       std::unordered_map<ObservationId, std::unordered_set<ArrayComponentId>>*
           volume_observers_contributed = nullptr;
@@ -203,11 +294,13 @@ struct ContributeVolumeDataToWriter {
 
       node_lock->lock();
       db::mutate<Tags::TensorData, Tags::ContributorsOfTensorData,
-                 Tags::VolumeDataLock, Tags::H5FileLock>(
+                 Tags::VolumeDataLock, Tags::VolumeDataWriteQueue,
+                 Tags::VolumeDataWriterIsActive, Tags::H5FileLock>(
           make_not_null(&box),
           [&observation_id, &observations_registered_with_id,
            &observer_group_id, &all_volume_data, &volume_observers_contributed,
-           &volume_data_lock, &volume_file_lock](
+           &volume_data_lock, &write_queue, &volume_writer_is_active,
+           &volume_file_lock](
               const gsl::not_null<std::unordered_map<
                   observers::ObservationId,
                   std::unordered_map<observers::ArrayComponentId,
@@ -217,6 +310,9 @@ struct ContributeVolumeDataToWriter {
                   ObservationId, std::unordered_set<ArrayComponentId>>*>
                   volume_observers_contributed_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_data_lock_ptr,
+              const gsl::not_null<Tags::VolumeDataWriteQueue::type*>
+                  write_queue_ptr,
+              const gsl::not_null<bool*> volume_writer_is_active_ptr,
               const gsl::not_null<Parallel::NodeLock*> volume_file_lock_ptr,
               const std::unordered_map<ObservationKey,
                                        std::unordered_set<ArrayComponentId>>&
@@ -234,6 +330,8 @@ struct ContributeVolumeDataToWriter {
             all_volume_data = &*volume_data_ptr;
             volume_observers_contributed = &*volume_observers_contributed_ptr;
             volume_data_lock = &*volume_data_lock_ptr;
+            write_queue = &*write_queue_ptr;
+            volume_writer_is_active = &*volume_writer_is_active_ptr;
             observations_registered_with_id =
                 observations_registered.at(key).size();
             volume_file_lock = &*volume_file_lock_ptr;
@@ -249,6 +347,10 @@ struct ContributeVolumeDataToWriter {
              "Failed to set volume_observers_contributed in the mutate");
       ASSERT(volume_data_lock != nullptr,
              "Failed to set volume_data_lock in the mutate");
+      ASSERT(write_queue != nullptr,
+             "Failed to set write_queue in the mutate");
+      ASSERT(volume_writer_is_active != nullptr,
+             "Failed to set volume_writer_is_active in the mutate");
       ASSERT(
           observations_registered_with_id != std::numeric_limits<size_t>::max(),
           "Failed to set observations_registered_with_id when mutating the "
@@ -277,49 +379,47 @@ struct ContributeVolumeDataToWriter {
             std::make_move_iterator(received_volume_data.end()));
       }
       // Check if we have received all "volume" data from the Observer
-      // group. If so we write to disk.
+      // group. If so we queue it to be written to disk.
       bool perform_write = false;
+      bool wait_for_writer = false;
       if (volume_observers_contributed->at(observation_id).size() ==
           observations_registered_with_id) {
-        perform_write = true;
-        volume_data = std::move(all_volume_data->operator[](observation_id));
+        auto& volume_data = all_volume_data->operator[](observation_id);
+        ASSERT(not volume_data.empty(),
+               "Failed to populate volume_data before trying to write it.");
+        std::vector<ElementVolumeData> dg_elements;
+        dg_elements.reserve(volume_data.size());
+        for (auto& id_and_element : volume_data) {
+          dg_elements.push_back(std::move(id_and_element.second));
+        }
+        write_queue->emplace_back(subfile_name, observation_id,
+                                  std::move(dg_elements));
         all_volume_data->erase(observation_id);
         volume_observers_contributed->erase(observation_id);
+        if (*volume_writer_is_active) {
+          wait_for_writer = write_queue->size() > maximum_queued_observations;
+        } else {
+          *volume_writer_is_active = true;
+          perform_write = true;
+        }
       }
       volume_data_lock->unlock();
 
       if (perform_write) {
-        ASSERT(not volume_data.empty(),
-               "Failed to populate volume_data before trying to write it.");
         // Write to file. We use a separate node lock because writing can be
         // very time consuming (it's network dependent, depends on how full the
         // disks are, what other users are doing, etc.) and we want to be able
         // to continue to work on the nodegroup while we are writing data to
         // disk.
-        volume_file_lock->lock();
-        {
-          // Scoping is for closing HDF5 file before we release the lock.
-          const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-          auto& my_proxy =
-              Parallel::get_parallel_component<ParallelComponent>(cache);
-          h5::H5File<h5::AccessType::ReadWrite> h5file(
-              file_prefix +
-                  std::to_string(Parallel::my_node(*my_proxy.ckLocalBranch())) +
-                  ".h5",
-              true);
-          constexpr size_t version_number = 0;
-          auto& volume_file =
-              h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-          std::vector<ElementVolumeData> dg_elements;
-          dg_elements.reserve(volume_data.size());
-          for (const auto& id_and_element : volume_data) {
-            dg_elements.push_back(id_and_element.second);
-          }
-          // Write the data to the file
-          volume_file.write_volume_data(observation_id.hash(),
-                                        observation_id.value(), dg_elements);
-        }
-        volume_file_lock->unlock();
+        VolumeActions_detail::write_queued_volume_data<ParallelComponent>(
+            cache, make_not_null(volume_file_lock),
+            make_not_null(volume_data_lock), make_not_null(write_queue),
+            make_not_null(volume_writer_is_active));
+      } else if (wait_for_writer) {
+        VolumeActions_detail::wait_for_space_in_write_queue(
+            make_not_null(volume_data_lock), make_not_null(write_queue),
+            make_not_null(volume_writer_is_active),
+            maximum_queued_observations);
       }
     } else {
       (void)node_lock;
@@ -329,8 +429,8 @@ struct ContributeVolumeDataToWriter {
       (void)received_volume_data;
       ERROR(
           "Could not find one of the tags TensorData, "
-          "ContributorsOfTensorData, "
-          "VolumeDataLock, or H5FileLock in the DataBox.");
+          "ContributorsOfTensorData, VolumeDataLock, VolumeDataWriteQueue, "
+          "VolumeDataWriterIsActive, or H5FileLock in the DataBox.");
     }
   }
 };
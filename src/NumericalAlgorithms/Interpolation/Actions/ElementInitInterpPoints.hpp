@@ -26,7 +26,11 @@ namespace Actions {
 /// \ingroup ActionsGroup
 /// \brief Adds interpolation point holders to the Element's DataBox.
 ///
-/// This action is for the case in which the points are time-independent.
+/// This action is for the case in which the points are time-independent,
+/// with `InterpPointInfoTag` being `intrp::Tags::InterpPointInfo`, or for
+/// the case in which the points are sent to the Element at each
+/// `temporal_id`, with `InterpPointInfoTag` being
+/// `intrp::Tags::ElementInterpolationInfos`.
 ///
 /// This action should be placed in the Initialization PDAL for DgElementArray.
 ///
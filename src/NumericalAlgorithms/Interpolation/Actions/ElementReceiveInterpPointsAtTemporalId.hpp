@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/IdPair.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/ElementLogicalCoordinates.hpp"
+#include "Domain/Structure/BlockId.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/ElementReceiveVolumeVars.hpp"
+#include "NumericalAlgorithms/Interpolation/ElementInterpolationInfo.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+/// \endcond
+
+namespace intrp {
+namespace Actions {
+
+/// \ingroup ActionsGroup
+/// \brief Receives the points of an InterpolationTarget at a
+/// `temporal_id`.
+///
+/// This action is for the case in which the points are sent to the
+/// `Element`s separately for each `temporal_id`; it is invoked by
+/// `intrp::Actions::SendPointsToInterpolator` on all `Element`s.  Keeps
+/// only the points that lie in this `Element`.  If the `Element`'s
+/// variables at `temporal_id` have already arrived (see
+/// `ElementReceiveVolumeVars`), interpolates onto those points and
+/// sends the result to the InterpolationTarget.  Otherwise holds the
+/// points until the variables arrive.
+///
+/// Uses: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `intrp::Tags::ElementInterpolationInfos<Metavariables>`
+template <typename InterpolationTargetTag>
+struct ElementReceiveInterpPointsAtTemporalId {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::ElementInterpolationInfos<Metavariables>>> =
+                nullptr>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const TemporalId& temporal_id,
+      const std::vector<std::optional<
+          IdPair<domain::BlockId, tnsr::I<double, Metavariables::volume_dim,
+                                          typename ::Frame::Logical>>>>&
+          block_logical_coords) noexcept {
+    static constexpr size_t dim = Metavariables::volume_dim;
+    using info_tag =
+        Vars::ElementInterpolationInfoTag<InterpolationTargetTag,
+                                          Metavariables>;
+    typename info_tag::type::Points points{};
+    const std::vector<ElementId<dim>> element_ids{{ElementId<dim>{
+        array_index}}};
+    auto element_coord_holders =
+        element_logical_coordinates(element_ids, block_logical_coords);
+    // There is exactly one element_id in the list of element_ids.
+    if (element_coord_holders.count(element_ids[0]) != 0) {
+      auto& element_coord_holder = element_coord_holders.at(element_ids[0]);
+      points.element_logical_coords =
+          std::move(element_coord_holder.element_logical_coords);
+      points.offsets = std::move(element_coord_holder.offsets);
+    }
+
+    db::mutate<Tags::ElementInterpolationInfos<Metavariables>>(
+        make_not_null(&box),
+        [&cache, &points, &temporal_id](
+            const gsl::not_null<
+                typename Tags::ElementInterpolationInfos<Metavariables>::type*>
+                infos) noexcept {
+          auto& info = get<info_tag>(*infos);
+          const auto volume_vars = info.volume_vars.find(temporal_id);
+          if (volume_vars == info.volume_vars.end()) {
+            info.points.emplace(temporal_id, std::move(points));
+            return;
+          }
+          detail::interpolate_on_element_and_send<InterpolationTargetTag>(
+              cache, temporal_id, points, volume_vars->second.mesh,
+              volume_vars->second.vars);
+          info.volume_vars.erase(volume_vars);
+        });
+  }
+};
+}  // namespace Actions
+}  // namespace intrp
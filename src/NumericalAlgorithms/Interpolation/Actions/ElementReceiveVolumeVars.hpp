@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
+#include "NumericalAlgorithms/Interpolation/ElementInterpolationInfo.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace intrp {
+template <typename Metavariables, typename InterpolationTargetTag>
+struct InterpolationTarget;
+}  // namespace intrp
+/// \endcond
+
+namespace intrp {
+namespace Actions {
+namespace detail {
+// Interpolates the volume data of an Element onto the target points
+// that lie in that Element, and sends the result to the
+// InterpolationTarget.  Does nothing if no target points lie in the
+// Element.
+template <typename InterpolationTargetTag, typename Metavariables,
+          typename TemporalId>
+void interpolate_on_element_and_send(
+    Parallel::GlobalCache<Metavariables>& cache, const TemporalId& temporal_id,
+    const typename Vars::ElementInterpolationInfo<
+        InterpolationTargetTag, Metavariables>::Points& points,
+    const Mesh<Metavariables::volume_dim>& mesh,
+    const Variables<
+        typename InterpolationTargetTag::vars_to_interpolate_to_target>&
+        vars) noexcept {
+  if (points.offsets.empty()) {
+    return;
+  }
+  // The points generally move between temporal_ids, so the interpolant
+  // is not worth caching.
+  const Irregular<Metavariables::volume_dim> interpolator(
+      mesh, points.element_logical_coords);
+  auto& receiver_proxy = Parallel::get_parallel_component<
+      InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+  Parallel::simple_action<
+      InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
+      receiver_proxy,
+      std::vector<Variables<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
+          {interpolator.interpolate(vars)}),
+      std::vector<std::vector<size_t>>({points.offsets}), temporal_id);
+}
+}  // namespace detail
+
+/// \ingroup ActionsGroup
+/// \brief Receives the variables to interpolate from an `Element` at a
+/// `temporal_id`.
+///
+/// Invoked by `intrp::Events::InterpolateOnElements` on the same
+/// `Element`.  If the target points at `temporal_id` have already
+/// arrived, interpolates onto those that lie in the `Element` and sends
+/// the result to the InterpolationTarget.  Otherwise holds the
+/// variables until `ElementReceiveInterpPointsAtTemporalId` delivers
+/// the points.
+///
+/// Uses: nothing
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - `intrp::Tags::ElementInterpolationInfos<Metavariables>`
+template <typename InterpolationTargetTag>
+struct ElementReceiveVolumeVars {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId,
+            Requires<tmpl::list_contains_v<
+                DbTags, Tags::ElementInterpolationInfos<Metavariables>>> =
+                nullptr>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const TemporalId& temporal_id,
+      const Mesh<Metavariables::volume_dim>& mesh,
+      const Variables<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>&
+          vars) noexcept {
+    using info_tag =
+        Vars::ElementInterpolationInfoTag<InterpolationTargetTag,
+                                          Metavariables>;
+    db::mutate<Tags::ElementInterpolationInfos<Metavariables>>(
+        make_not_null(&box),
+        [&cache, &mesh, &temporal_id, &vars](
+            const gsl::not_null<
+                typename Tags::ElementInterpolationInfos<Metavariables>::type*>
+                infos) noexcept {
+          auto& info = get<info_tag>(*infos);
+          const auto points = info.points.find(temporal_id);
+          if (points == info.points.end()) {
+            info.volume_vars.emplace(
+                temporal_id,
+                typename info_tag::type::VolumeVars{mesh, vars});
+            return;
+          }
+          detail::interpolate_on_element_and_send<InterpolationTargetTag>(
+              cache, temporal_id, points->second, mesh, vars);
+          info.points.erase(points);
+        });
+  }
+};
+}  // namespace Actions
+}  // namespace intrp
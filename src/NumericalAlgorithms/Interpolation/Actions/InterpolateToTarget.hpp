@@ -110,7 +110,8 @@ struct InterpolateToTarget {
         });
 
     // 3. Set up interpolator
-    intrp::Irregular<dim> interpolator(
+    const auto interpolator = intrp::cached_irregular(
+        intrp::irregular_cache_key<InterpolationTargetTag>(element_ids[0]),
         mesh, element_coord_holder.element_logical_coords);
 
     // 4. Interpolate and send interpolated data to target
@@ -121,7 +122,7 @@ struct InterpolateToTarget {
         receiver_proxy,
         std::vector<Variables<
             typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(local_vars)}),
+            {interpolator->interpolate(local_vars)}),
         std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
         db::get<typename Metavariables::temporal_id>(new_box));
 
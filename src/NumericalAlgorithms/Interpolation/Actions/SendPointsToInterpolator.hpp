@@ -6,6 +6,7 @@
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/ElementReceiveInterpPointsAtTemporalId.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -18,6 +19,13 @@ namespace Actions {
 /// \brief Sets up points on an `InterpolationTarget` at a new `temporal_id`
 /// and sends these points to an `Interpolator`.
 ///
+/// If `InterpolationTargetTag` sets `static constexpr bool
+/// interpolate_on_elements = true`, the points are instead sent to every
+/// `Element` of its `interpolating_component`, each of which interpolates
+/// onto the points that it contains (see
+/// `intrp::Events::InterpolateOnElements`).  This avoids sending the volume
+/// data of every `Element` to the `Interpolator`.
+///
 /// Uses:
 /// - DataBox:
 ///   - `domain::Tags::Domain<3>`
@@ -46,10 +54,24 @@ struct SendPointsToInterpolator {
         InterpolationTargetTag>(box, cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
-    auto& receiver_proxy =
-        Parallel::get_parallel_component<Interpolator<Metavariables>>(cache);
-    Parallel::simple_action<Actions::ReceivePoints<InterpolationTargetTag>>(
-        receiver_proxy, temporal_id, std::move(coords));
+    if constexpr (InterpolationTarget_detail::interpolates_on_elements<
+                      InterpolationTargetTag>()) {
+      static_assert(not InterpolationTargetTag::compute_target_points::
+                        is_sequential::value,
+                    "Interpolating on elements is supported only for "
+                    "non-sequential compute_target_points");
+      auto& receiver_proxy = Parallel::get_parallel_component<
+          typename InterpolationTargetTag::interpolating_component>(cache);
+      Parallel::simple_action<
+          Actions::ElementReceiveInterpPointsAtTemporalId<
+              InterpolationTargetTag>>(receiver_proxy, temporal_id,
+                                       std::move(coords));
+    } else {
+      auto& receiver_proxy =
+          Parallel::get_parallel_component<Interpolator<Metavariables>>(cache);
+      Parallel::simple_action<Actions::ReceivePoints<InterpolationTargetTag>>(
+          receiver_proxy, temporal_id, std::move(coords));
+    }
   }
 };
 
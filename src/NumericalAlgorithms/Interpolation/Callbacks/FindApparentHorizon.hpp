@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <deque>
 #include <utility>
 
 #include "ApparentHorizons/FastFlow.hpp"
@@ -13,6 +14,7 @@
 #include "DataStructures/VariablesTag.hpp"
 #include "IO/Logging/Tags.hpp"
 #include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetApparentHorizon.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Printf.hpp"
@@ -71,11 +73,20 @@ namespace callbacks {
 ///   - `::gr::Tags::SpatialChristoffelSecondKind<3,Frame>`
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+///   - `::ah::Tags::PreviousStrahlkorpers<Frame>`
+/// - GlobalCache:
+///   - `intrp::Tags::ApparentHorizon<InterpolationTargetTag, Frame>`
 ///
 /// Modifies:
 /// - DataBox:
 ///   - `::ah::Tags::FastFlow`
 ///   - `StrahlkorperTags::Strahlkorper<Frame>`
+///   - `::ah::Tags::PreviousStrahlkorpers<Frame>`
+///
+/// The first iteration of each horizon find starts from the horizons found
+/// at previous times, extrapolated in time to `temporal_id` with the order
+/// given by the `ExtrapolationOrder` option (see
+/// `intrp::TargetPoints::ApparentHorizon::current_strahlkorper`).
 ///
 /// This is an InterpolationTargetTag::post_interpolation_callback;
 /// see InterpolationTarget for a description of InterpolationTargetTag.
@@ -156,6 +167,20 @@ struct FindApparentHorizon {
 
       std::pair<FastFlow::Status, FastFlow::IterInfo> status_and_info;
 
+      // The points for the first iteration were computed on the initial
+      // guess extrapolated from the previously found horizons, so start
+      // iterating from that guess.
+      if (db::get<::ah::Tags::FastFlow>(*box).current_iteration() == 0) {
+        auto initial_guess =
+            TargetPoints::ApparentHorizon<InterpolationTargetTag, Frame>::
+                current_strahlkorper(*box, temporal_id);
+        db::mutate<StrahlkorperTags::Strahlkorper<Frame>>(
+            box, [&initial_guess](const gsl::not_null<::Strahlkorper<Frame>*>
+                                      strahlkorper) noexcept {
+              *strahlkorper = std::move(initial_guess);
+            });
+      }
+
       // Do a FastFlow iteration.
       db::mutate<::ah::Tags::FastFlow, StrahlkorperTags::Strahlkorper<Frame>>(
           box, [&inv_g, &ex_curv, &christoffel, &status_and_info](
@@ -252,25 +277,36 @@ struct FindApparentHorizon {
     }
 
     // Prepare for finding horizon at a new time.  If the horizon
-    // finder was successful, then do not change the strahlkorper,
-    // which will be the initial guess for finding the horizon at the
-    // next time.
-    // Eventually we will do time-extrapolation to set the next guess.
+    // finder was successful, then save the strahlkorper, from which
+    // (together with the previously found ones) the initial guess for
+    // finding the horizon at the next time is extrapolated.
+    const auto& options =
+        Parallel::get<Tags::ApparentHorizon<InterpolationTargetTag, Frame>>(
+            *cache);
     db::mutate<::ah::Tags::FastFlow, StrahlkorperTags::Strahlkorper<Frame>,
-               ::ah::Tags::PreviousStrahlkorper<Frame>>(
-        box, [&horizon_finder_failed](
+               ::ah::Tags::PreviousStrahlkorpers<Frame>>(
+        box, [&horizon_finder_failed, &options, &temporal_id](
                  const gsl::not_null<::FastFlow*> fast_flow,
                  const gsl::not_null<::Strahlkorper<Frame>*> strahlkorper,
-                 const gsl::not_null<::Strahlkorper<Frame>*>
-                     previous_strahlkorper) noexcept {
+                 const gsl::not_null<
+                     std::deque<std::pair<double, ::Strahlkorper<Frame>>>*>
+                     previous_strahlkorpers) noexcept {
           if (horizon_finder_failed) {
             // Don't keep a partially-converged strahlkorper in the DataBox.
-            // Reset to the previous value, even if that previous value
-            // is the original initial guess.
-            *strahlkorper = *previous_strahlkorper;
+            // Reset to the most recently found horizon, or to the original
+            // initial guess if no horizon has been found yet.
+            *strahlkorper = previous_strahlkorpers->empty()
+                                ? options.initial_guess
+                                : previous_strahlkorpers->front().second;
           } else {
-            // Save a new previous_strahlkorper.
-            *previous_strahlkorper = *strahlkorper;
+            // Save the new horizon, keeping only as many as are needed for
+            // the extrapolation.
+            previous_strahlkorpers->emplace_front(
+                temporal_id.substep_time().value(), *strahlkorper);
+            while (previous_strahlkorpers->size() >
+                   options.extrapolation_order + 1) {
+              previous_strahlkorpers->pop_back();
+            }
           }
           fast_flow->reset_for_next_find();
         });
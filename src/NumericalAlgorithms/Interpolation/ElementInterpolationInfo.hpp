@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace intrp {
+namespace Vars {
+/// \brief Holds what an `Element` needs to interpolate onto an
+/// InterpolationTarget whose points are sent to the `Element`s
+/// separately for each `temporal_id`.
+///
+/// The points and the volume data at a given `temporal_id` may arrive
+/// at the `Element` in either order, so whichever arrives first is held
+/// here until the other one arrives.  Only the points that lie in the
+/// `Element` are held, not all of the target points.
+template <typename InterpolationTargetTag, typename Metavariables>
+struct ElementInterpolationInfo {
+  static constexpr size_t volume_dim = Metavariables::volume_dim;
+  using temporal_id_type = typename Metavariables::temporal_id::type;
+  using vars_type = Variables<
+      typename InterpolationTargetTag::vars_to_interpolate_to_target>;
+
+  /// The target points that lie in the `Element`, in element logical
+  /// coordinates, along with their indices into the full list of target
+  /// points.  Both are empty if no target points lie in the `Element`.
+  struct Points {
+    tnsr::I<DataVector, volume_dim, Frame::Logical> element_logical_coords{};
+    std::vector<size_t> offsets{};
+
+    void pup(PUP::er& p) noexcept {  // NOLINT
+      p | element_logical_coords;
+      p | offsets;
+    }
+  };
+
+  /// The variables to interpolate, on the `Element`'s mesh.
+  struct VolumeVars {
+    Mesh<volume_dim> mesh{};
+    vars_type vars{};
+
+    void pup(PUP::er& p) noexcept {  // NOLINT
+      p | mesh;
+      p | vars;
+    }
+  };
+
+  std::unordered_map<temporal_id_type, Points> points{};
+  std::unordered_map<temporal_id_type, VolumeVars> volume_vars{};
+
+  void pup(PUP::er& p) noexcept {  // NOLINT
+    p | points;
+    p | volume_vars;
+  }
+};
+
+template <typename InterpolationTargetTag, typename Metavariables>
+struct ElementInterpolationInfoTag {
+  using type = ElementInterpolationInfo<InterpolationTargetTag, Metavariables>;
+};
+}  // namespace Vars
+
+namespace Tags {
+/// The following tag is for InterpolationTargets that send their points
+/// to the `Element`s at each `temporal_id` (see
+/// `intrp::Events::InterpolateOnElements`).  In that case the
+/// `Element` must hold the points or its volume data, whichever
+/// arrives first, in its `DataBox`.
+///
+/// A particular `Vars::ElementInterpolationInfo` can be retrieved from
+/// this `TaggedTuple` via a `Vars::ElementInterpolationInfoTag`.
+template <typename Metavariables>
+struct ElementInterpolationInfos : db::SimpleTag {
+  using type = tuples::tagged_tuple_from_typelist<
+      db::wrap_tags_in<Vars::ElementInterpolationInfoTag,
+                       typename Metavariables::interpolation_target_tags,
+                       Metavariables>>;
+};
+}  // namespace Tags
+}  // namespace intrp
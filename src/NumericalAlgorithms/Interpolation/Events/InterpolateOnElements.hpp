@@ -0,0 +1,172 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/ElementReceiveVolumeVars.hpp"
+#include "NumericalAlgorithms/Interpolation/AddTemporalIdsToInterpolationTarget.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Tags {
+struct TimeStepId;
+}  // namespace Tags
+namespace domain {
+namespace Tags {
+template <size_t VolumeDim>
+struct Mesh;
+}  // namespace Tags
+}  // namespace domain
+template <size_t Dim>
+class Mesh;
+namespace intrp {
+template <typename Metavariables, typename Tag>
+struct InterpolationTarget;
+}  // namespace intrp
+/// \endcond
+
+namespace intrp {
+namespace Events {
+/// \cond
+template <size_t VolumeDim, typename InterpolationTargetTag,
+          typename Metavariables, typename Tensors>
+class InterpolateOnElements;
+/// \endcond
+
+/// \brief Does an interpolation onto an InterpolationTargetTag whose points
+/// may change with `temporal_id`, with each `Element` interpolating its
+/// own volume data.
+///
+/// Unlike `Interpolate`, the volume data are not sent to the
+/// `Interpolator`.  Instead, the InterpolationTarget computes its points
+/// at the `temporal_id` and sends them to all `Element`s (see
+/// `intrp::Actions::SendPointsToInterpolator`); each `Element` keeps
+/// only the points that it contains, interpolates onto them, and sends
+/// only the interpolated values to the InterpolationTarget.  Unlike
+/// `InterpolateWithoutInterpComponent`, the points need not be
+/// time-independent, so this works with time-dependent maps.
+///
+/// `InterpolationTargetTag` must be non-sequential, must set
+/// `static constexpr bool interpolate_on_elements = true` and must have an
+/// `interpolating_component` type alias naming the `Element`s'
+/// component, whose DataBox must hold
+/// `intrp::Tags::ElementInterpolationInfos<Metavariables>` (see
+/// `intrp::Actions::ElementInitInterpPoints`).
+template <size_t VolumeDim, typename InterpolationTargetTag,
+          typename Metavariables, typename... Tensors>
+class InterpolateOnElements<VolumeDim, InterpolationTargetTag, Metavariables,
+                            tmpl::list<Tensors...>> : public Event {
+  static_assert(
+      not InterpolationTargetTag::compute_target_points::is_sequential::value,
+      "Use InterpolateOnElements only with non-sequential "
+      "compute_target_points");
+  static_assert(InterpolationTarget_detail::has_interpolating_component_v<
+                        InterpolationTargetTag> and
+                    InterpolationTarget_detail::interpolates_on_elements<
+                        InterpolationTargetTag>(),
+                "Use InterpolateOnElements only with an InterpolationTargetTag "
+                "that sets interpolate_on_elements and has an "
+                "interpolating_component");
+
+  /// \cond
+  explicit InterpolateOnElements(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(InterpolateOnElements);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help =
+      "Starts interpolation onto the given InterpolationTargetTag, "
+      "with each Element interpolating its own volume data.";
+
+  static std::string name() noexcept {
+    return Options::name<InterpolationTargetTag>();
+  }
+
+  InterpolateOnElements() = default;
+
+  using argument_tags =
+      tmpl::list<::Tags::TimeStepId, domain::Tags::Mesh<VolumeDim>, Tensors...>;
+
+  template <typename ParallelComponent>
+  void operator()(const TimeStepId& time_id, const Mesh<VolumeDim>& mesh,
+                  const typename Tensors::type&... tensors,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ElementId<VolumeDim>& array_index,
+                  const ParallelComponent* const /*meta*/) const noexcept {
+    Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+        interp_vars(mesh.number_of_grid_points());
+
+    // Clang-tidy wants extra braces for `if constexpr`
+    if constexpr (std::is_same_v<tmpl::list<>, typename InterpolationTargetTag::
+                                                   compute_items_on_source>) {
+      // Copy the tensors directly into the variables; no need to
+      // make a DataBox because we have no ComputeItems.
+      [[maybe_unused]] const auto copy_to_variables = [&interp_vars](
+          const auto tensor_tag_v, const auto& tensor) noexcept {
+        using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+        get<tensor_tag>(interp_vars) = tensor;
+        return 0;
+      };
+      expand_pack(copy_to_variables(tmpl::type_<Tensors>{}, tensors)...);
+    } else {
+      // Make a DataBox and insert ComputeItems
+      const auto box = db::create<
+          db::AddSimpleTags<Tensors...>,
+          db::AddComputeTags<
+              typename InterpolationTargetTag::compute_items_on_source>>(
+          tensors...);
+      // Copy vars_to_interpolate_to_target from databox to vars
+      tmpl::for_each<
+          typename InterpolationTargetTag::vars_to_interpolate_to_target>(
+          [&box, &interp_vars ](auto tag_v) noexcept {
+            using tag = typename decltype(tag_v)::type;
+            get<tag>(interp_vars) = db::get<tag>(box);
+          });
+    }
+
+    // Hold the variables on this Element until the points arrive (or
+    // interpolate right away if they already have).
+    auto& element_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index];
+    Parallel::simple_action<
+        Actions::ElementReceiveVolumeVars<InterpolationTargetTag>>(
+        element_proxy, time_id, mesh, std::move(interp_vars));
+
+    // Tell the interpolation target that it should interpolate.
+    auto& target = Parallel::get_parallel_component<
+        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+    Parallel::simple_action<
+        Actions::AddTemporalIdsToInterpolationTarget<InterpolationTargetTag>>(
+        target, std::vector<TimeStepId>{time_id});
+  }
+
+  bool needs_evolved_variables() const noexcept override { return true; }
+};
+
+/// \cond
+template <size_t VolumeDim, typename InterpolationTargetTag,
+          typename Metavariables, typename... Tensors>
+PUP::able::PUP_ID InterpolateOnElements<VolumeDim, InterpolationTargetTag,
+                                        Metavariables,
+                                        tmpl::list<Tensors...>>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+
+}  // namespace Events
+}  // namespace intrp
@@ -141,7 +141,8 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
     }
 
     // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
+    const auto interpolator = intrp::cached_irregular(
+        intrp::irregular_cache_key<InterpolationTargetTag>(element_ids[0]),
         mesh, element_coord_holder.element_logical_coords);
 
     // 3. Interpolate and send interpolated data to target
@@ -152,7 +153,7 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
         receiver_proxy,
         std::vector<Variables<
             typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
+            {interpolator->interpolate(interp_vars)}),
         std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
         time_id);
   }
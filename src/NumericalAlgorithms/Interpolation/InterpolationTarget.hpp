@@ -107,6 +107,13 @@ namespace intrp {
 /// - interpolating_component (used only if not `is_sequential`):
 ///      A type alias for the component that will be interpolating to the
 ///      interpolation target.
+/// - interpolate_on_elements (optional, used only if not `is_sequential`):
+///      A `static constexpr bool`.  If `true`, `SendPointsToInterpolator`
+///      sends the points at each `temporal_id` to the
+///      `interpolating_component` instead of to the `Interpolator`, so that
+///      the `Element`s interpolate their own volume data (see
+///      `intrp::Events::InterpolateOnElements`).  If omitted, the points are
+///      sent to the `Interpolator`.
 ///
 /// `Metavariables` must contain the following type aliases:
 /// - interpolator_source_vars:
@@ -4,6 +4,7 @@
 #include "NumericalAlgorithms/Interpolation/InterpolationTargetApparentHorizon.hpp"
 
 #include <algorithm>
+#include <cstddef>
 
 #include "IO/Logging/Verbosity.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
@@ -16,9 +17,11 @@ namespace intrp::OptionHolders {
 template <typename Frame>
 ApparentHorizon<Frame>::ApparentHorizon(Strahlkorper<Frame> initial_guess_in,
                                         ::FastFlow fast_flow_in,
+                                        const size_t extrapolation_order_in,
                                         ::Verbosity verbosity_in) noexcept
     : initial_guess(std::move(initial_guess_in)),
-      fast_flow(std::move(fast_flow_in)),    // NOLINT
+      fast_flow(std::move(fast_flow_in)),  // NOLINT
+      extrapolation_order(extrapolation_order_in),
       verbosity(std::move(verbosity_in)) {}  // NOLINT
 // clang-tidy std::move of trivially copyable type.
 
@@ -26,6 +29,7 @@ template <typename Frame>
 void ApparentHorizon<Frame>::pup(PUP::er& p) noexcept {
   p | initial_guess;
   p | fast_flow;
+  p | extrapolation_order;
   p | verbosity;
 }
 
@@ -33,7 +37,9 @@ template <typename Frame>
 bool operator==(const ApparentHorizon<Frame>& lhs,
                 const ApparentHorizon<Frame>& rhs) noexcept {
   return lhs.initial_guess == rhs.initial_guess and
-         lhs.fast_flow == rhs.fast_flow and lhs.verbosity == rhs.verbosity;
+         lhs.fast_flow == rhs.fast_flow and
+         lhs.extrapolation_order == rhs.extrapolation_order and
+         lhs.verbosity == rhs.verbosity;
 }
 
 template <typename Frame>
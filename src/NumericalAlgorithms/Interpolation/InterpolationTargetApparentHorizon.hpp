@@ -4,7 +4,10 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
+#include <utility>
 
+#include "ApparentHorizons/ExtrapolateStrahlkorperInTime.hpp"
 #include "ApparentHorizons/FastFlow.hpp"
 #include "ApparentHorizons/Strahlkorper.hpp"
 #include "ApparentHorizons/Tags.hpp"
@@ -59,17 +62,30 @@ struct ApparentHorizon {
     static constexpr Options::String help = {"FastFlow options"};
     using type = ::FastFlow;
   };
+  /// Order of the polynomial in time, through the most recently found
+  /// horizons, that is used to extrapolate the initial guess for the next
+  /// horizon find.
+  struct ExtrapolationOrder {
+    static constexpr Options::String help = {
+        "Order of the extrapolation in time of previously found horizons\n"
+        "to the initial guess for the next horizon find. 0 uses the most\n"
+        "recently found horizon."};
+    using type = size_t;
+    static type upper_bound() noexcept { return 2; }
+  };
   struct Verbosity {
     static constexpr Options::String help = {"Verbosity"};
     using type = ::Verbosity;
   };
-  using options = tmpl::list<InitialGuess, FastFlow, Verbosity>;
+  using options =
+      tmpl::list<InitialGuess, FastFlow, ExtrapolationOrder, Verbosity>;
   static constexpr Options::String help = {
       "Provide an initial guess for the apparent horizon surface\n"
       "(Strahlkorper) and apparent-horizon-finding-algorithm (FastFlow)\n"
       "options."};
 
   ApparentHorizon(Strahlkorper<Frame> initial_guess_in, ::FastFlow fast_flow_in,
+                  size_t extrapolation_order_in,
                   ::Verbosity verbosity_in) noexcept;
 
   ApparentHorizon() = default;
@@ -84,6 +100,7 @@ struct ApparentHorizon {
 
   Strahlkorper<Frame> initial_guess{};
   ::FastFlow fast_flow{};
+  size_t extrapolation_order{0};
   ::Verbosity verbosity{::Verbosity::Quiet};
 };
 
@@ -135,6 +152,9 @@ namespace TargetPoints {
 ///   than the Strahlkorper in the DataBox, as needed for horizon finding.
 /// - It uses a `FastFlow` in the DataBox.
 /// - It has different options (including those for `FastFlow`).
+/// - On the first iteration of a horizon find, it supplies points on the
+///   initial guess extrapolated in time from the previously found horizons
+///   (see `current_strahlkorper`).
 ///
 /// For requirements on InterpolationTargetTag, see InterpolationTarget
 template <typename InterpolationTargetTag, typename Frame>
@@ -145,7 +165,7 @@ struct ApparentHorizon {
       tmpl::append<StrahlkorperTags::items_tags<Frame>,
                    tmpl::list<::ah::Tags::FastFlow,
                               logging::Tags::Verbosity<InterpolationTargetTag>,
-                              ::ah::Tags::PreviousStrahlkorper<Frame>>,
+                              ::ah::Tags::PreviousStrahlkorpers<Frame>>,
                    StrahlkorperTags::compute_items_tags<Frame>>;
   using is_sequential = std::true_type;
   using frame = Frame;
@@ -153,7 +173,7 @@ struct ApparentHorizon {
   using simple_tags =
       tmpl::push_back<StrahlkorperTags::items_tags<Frame>, ::ah::Tags::FastFlow,
                       logging::Tags::Verbosity<InterpolationTargetTag>,
-                      ::ah::Tags::PreviousStrahlkorper<Frame>>;
+                      ::ah::Tags::PreviousStrahlkorpers<Frame>>;
   using compute_tags = typename StrahlkorperTags::compute_items_tags<Frame>;
 
   template <typename DbTags, typename Metavariables>
@@ -166,20 +186,37 @@ struct ApparentHorizon {
 
     // Put Strahlkorper and its ComputeItems, FastFlow,
     // and verbosity into a new DataBox.
-    // Put the initial guess also into PreviousStrahlkorper.
+    // No horizons have been found yet, so PreviousStrahlkorpers is empty.
     Initialization::mutate_assign<simple_tags>(
         box, options.initial_guess, options.fast_flow, options.verbosity,
-        options.initial_guess);
+        std::deque<std::pair<double, Strahlkorper<Frame>>>{});
+  }
+
+  /// The surface on which the current iteration of the horizon finder
+  /// evaluates the residual.  On the first iteration of a horizon find,
+  /// this is the initial guess extrapolated to the time of `temporal_id`
+  /// from the previously found horizons, if there are any.  Otherwise it is
+  /// the Strahlkorper in the DataBox.
+  template <typename DbTags, typename TemporalId>
+  static Strahlkorper<Frame> current_strahlkorper(
+      const db::DataBox<DbTags>& box, const TemporalId& temporal_id) noexcept {
+    const auto& previous_strahlkorpers =
+        db::get<::ah::Tags::PreviousStrahlkorpers<Frame>>(box);
+    if (db::get<::ah::Tags::FastFlow>(box).current_iteration() == 0 and
+        not previous_strahlkorpers.empty()) {
+      return extrapolate_strahlkorper_in_time(
+          previous_strahlkorpers, temporal_id.substep_time().value());
+    }
+    return db::get<StrahlkorperTags::Strahlkorper<Frame>>(box);
   }
 
   template <typename Metavariables, typename DbTags, typename TemporalId>
   static tnsr::I<DataVector, 3, Frame> points(
       const db::DataBox<DbTags>& box,
       const tmpl::type_<Metavariables>& /*meta*/,
-      const TemporalId& /*temporal_id*/) noexcept {
+      const TemporalId& temporal_id) noexcept {
     const auto& fast_flow = db::get<::ah::Tags::FastFlow>(box);
-    const auto& strahlkorper =
-        db::get<StrahlkorperTags::Strahlkorper<Frame>>(box);
+    const auto strahlkorper = current_strahlkorper(box, temporal_id);
 
     const size_t L_mesh = fast_flow.current_l_mesh(strahlkorper);
     const auto prolonged_strahlkorper =
@@ -26,6 +26,7 @@
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
 #include "Utilities/TypeTraits/CreateHasStaticMemberVariable.hpp"
+#include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
 
 /// \cond
 // IWYU pragma: no_forward_declare db::DataBox
@@ -95,6 +96,26 @@ auto apply_callback(
 CREATE_HAS_STATIC_MEMBER_VARIABLE(fill_invalid_points_with)
 CREATE_HAS_STATIC_MEMBER_VARIABLE_V(fill_invalid_points_with)
 
+CREATE_HAS_TYPE_ALIAS(interpolating_component)
+CREATE_HAS_TYPE_ALIAS_V(interpolating_component)
+
+CREATE_HAS_STATIC_MEMBER_VARIABLE(interpolate_on_elements)
+CREATE_HAS_STATIC_MEMBER_VARIABLE_V(interpolate_on_elements)
+
+// Whether the target sends its points to the elements of its
+// `interpolating_component` instead of to the `Interpolator`. Targets opt in
+// with `static constexpr bool interpolate_on_elements = true`, because the
+// `interpolating_component` alias alone also marks targets for
+// `InterpolateWithoutInterpComponent` and for the `Interpolator`.
+template <typename InterpolationTargetTag>
+constexpr bool interpolates_on_elements() noexcept {
+  if constexpr (has_interpolate_on_elements_v<InterpolationTargetTag, bool>) {
+    return InterpolationTargetTag::interpolate_on_elements;
+  } else {
+    return false;
+  }
+}
+
 // Fills invalid points with some constant value.
 template <typename InterpolationTargetTag, typename TemporalId, typename DbTags,
           Requires<not has_fill_invalid_points_with_v<
@@ -469,7 +490,7 @@ void add_received_variables(
 ///
 /// block_logical_coords is called by an Action of InterpolationTarget.
 ///
-/// Currently two Actions call block_logical_coords:
+/// Currently three Actions call block_logical_coords:
 /// - SendPointsToInterpolator (called by AddTemporalIdsToInterpolationTarget
 ///                             and by FindApparentHorizon)
 /// - InterpolationTargetVarsFromElement (called by DgElementArray)
@@ -4,76 +4,41 @@
 #include "IrregularInterpolant.hpp"
 
 #include <array>
+#include <list>
+#include <memory>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/Gsl.hpp"
 // IWYU pragma: no_forward_declare Tensor
 
 namespace {
-
 template <size_t Dim>
-Matrix interpolation_matrix(
+std::array<Matrix, Dim> interpolation_matrices(
     const Mesh<Dim>& mesh,
-    const tnsr::I<DataVector, Dim, Frame::Logical>& points) noexcept;
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<1>& mesh,
-    const tnsr::I<DataVector, 1, Frame::Logical>& points) noexcept {
-  // For 1d interpolation matrix, simply return the legendre-gauss-lobatto
-  // matrix.
-  return Spectral::interpolation_matrix(mesh, get<0>(points));
-}
-
-template <>
-Matrix interpolation_matrix(
-    const Mesh<2>& mesh,
-    const tnsr::I<DataVector, 2, Frame::Logical>& points) noexcept {
-  const std::array<Matrix, 2> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points))}};
-
-  const auto number_of_points = get<0>(points).size();
-  Matrix result(number_of_points, mesh.number_of_grid_points());
-  // First dimension of DataVector varies fastest.
-  for (size_t j = 0, s = 0; j < mesh.extents(1); ++j) {
-    for (size_t i = 0; i < mesh.extents(0); ++i) {
-      for (size_t p = 0; p < number_of_points; ++p) {
-        result(p, s) = matrices[0](p, i) * matrices[1](p, j);
-      }
-      ++s;
-    }
+    const tnsr::I<DataVector, Dim, Frame::Logical>& points) noexcept {
+  std::array<Matrix, Dim> matrices{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(matrices, d) =
+        Spectral::interpolation_matrix(mesh.slice_through(d), points.get(d));
   }
-  return result;
+  return matrices;
 }
 
-template <>
-Matrix interpolation_matrix(
-    const Mesh<3>& mesh,
-    const tnsr::I<DataVector, 3, Frame::Logical>& points) noexcept {
-  const std::array<Matrix, 3> matrices{
-      {Spectral::interpolation_matrix(mesh.slice_through(0), get<0>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(1), get<1>(points)),
-       Spectral::interpolation_matrix(mesh.slice_through(2), get<2>(points))}};
-
-  const auto number_of_points = get<0>(points).size();
-  Matrix result(number_of_points, mesh.number_of_grid_points());
-  // First dimension of DataVector varies fastest.
-  for (size_t k = 0, s = 0; k < mesh.extents(2); ++k) {
-    for (size_t j = 0; j < mesh.extents(1); ++j) {
-      for (size_t i = 0; i < mesh.extents(0); ++i) {
-        for (size_t p = 0; p < number_of_points; ++p) {
-          result(p, s) =
-              matrices[0](p, i) * matrices[1](p, j) * matrices[2](p, k);
-        }
-        ++s;
-      }
-    }
-  }
-  return result;
-}
+template <size_t Dim>
+struct CacheEntry {
+  size_t key;
+  Mesh<Dim> source_mesh;
+  tnsr::I<DataVector, Dim, Frame::Logical> target_points;
+  std::shared_ptr<const intrp::Irregular<Dim>> interpolant;
+};
 }  // namespace
 
 namespace intrp {
@@ -85,11 +50,80 @@ template <size_t Dim>
 Irregular<Dim>::Irregular(
     const Mesh<Dim>& source_mesh,
     const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
+    : interpolation_matrices_(
+          interpolation_matrices(source_mesh, target_points)) {}
 
 template <size_t Dim>
 void Irregular<Dim>::pup(PUP::er& p) noexcept {
-  p | interpolation_matrix_;
+  p | interpolation_matrices_;
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_source_points() const noexcept {
+  size_t number_of_points = 1;
+  for (const auto& matrix : interpolation_matrices_) {
+    number_of_points *= matrix.columns();
+  }
+  return number_of_points;
+}
+
+template <size_t Dim>
+void Irregular<Dim>::interpolate_data(
+    const gsl::not_null<double*> result, const double* const source,
+    const size_t number_of_components) const noexcept {
+  const size_t number_of_targets = number_of_target_points();
+  if (number_of_targets == 0) {
+    return;
+  }
+  // Viewing the source data as a column-major matrix with a row for each grid
+  // point in the first dimension, which varies fastest in the data, the first
+  // dimension is contracted with the weights of all target points at once in a
+  // single matrix-matrix product. This is the bulk of the work.
+  const Matrix& first_weights = interpolation_matrices_[0];
+  const size_t first_extent = first_weights.columns();
+  const size_t contracted_size =
+      number_of_source_points() / first_extent * number_of_components;
+  if constexpr (Dim == 1) {
+    dgemm_('N', 'N', number_of_targets, number_of_components, first_extent, 1.0,
+           first_weights.data(), first_weights.spacing(), source, first_extent,
+           0.0, result.get(), number_of_targets);
+  } else {
+    Arena& arena = Arena::local();
+    const ArenaScope arena_scope{make_not_null(&arena)};
+    // Column `p` holds the data contracted at target point `p`
+    double* const contracted_data =
+        arena.allocate<double>(contracted_size * number_of_targets);
+    dgemm_('T', 'T', contracted_size, number_of_targets, first_extent, 1.0,
+           source, first_extent, first_weights.data(), first_weights.spacing(),
+           0.0, contracted_data, contracted_size);
+    // The remaining dimensions are contracted one target point at a time, which
+    // is cheap because the data is already smaller by the first extent. Each
+    // contraction is a matrix-vector product whose result holds the data with
+    // the current dimension removed, and the last one is written to the
+    // `result`.
+    double* const buffer =
+        Dim > 2 ? arena.allocate<double>(contracted_size /
+                                         interpolation_matrices_[1].columns())
+                : nullptr;
+    for (size_t p = 0; p < number_of_targets; ++p) {
+      const double* data = contracted_data + p * contracted_size;
+      size_t data_size = contracted_size;
+      for (size_t d = 1; d < Dim; ++d) {
+        const Matrix& weights = gsl::at(interpolation_matrices_, d);
+        const size_t rows = weights.columns();
+        const size_t columns = data_size / rows;
+        if (d + 1 == Dim) {
+          dgemv_('T', rows, columns, 1.0, data, rows, weights.data() + p,
+                 weights.spacing(), 0.0, result.get() + p, number_of_targets);
+        } else {
+          dgemv_('T', rows, columns, 1.0, data, rows, weights.data() + p,
+                 weights.spacing(), 0.0, buffer, 1);
+          data = buffer;
+        }
+        data_size = columns;
+      }
+    }
+  }
 }
 
 template <size_t Dim>
@@ -97,6 +131,39 @@ bool operator!=(const Irregular<Dim>& lhs, const Irregular<Dim>& rhs) noexcept {
   return not(lhs == rhs);
 }
 
+template <size_t Dim>
+std::shared_ptr<const Irregular<Dim>> cached_irregular(
+    const size_t cache_key, const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept {
+  // Most recently used entries first, and the entry of each key
+  thread_local std::list<CacheEntry<Dim>> cache{};
+  thread_local std::unordered_map<size_t,
+                                  typename std::list<CacheEntry<Dim>>::iterator>
+      entries{};
+  const auto found_entry = entries.find(cache_key);
+  if (found_entry != entries.end()) {
+    cache.splice(cache.begin(), cache, found_entry->second);
+    CacheEntry<Dim>& entry = cache.front();
+    if (entry.source_mesh != source_mesh or
+        entry.target_points != target_points) {
+      entry.source_mesh = source_mesh;
+      entry.target_points = target_points;
+      entry.interpolant =
+          std::make_shared<const Irregular<Dim>>(source_mesh, target_points);
+    }
+    return entry.interpolant;
+  }
+  cache.push_front(CacheEntry<Dim>{
+      cache_key, source_mesh, target_points,
+      std::make_shared<const Irregular<Dim>>(source_mesh, target_points)});
+  entries.emplace(cache_key, cache.begin());
+  if (cache.size() > irregular_cache_capacity) {
+    entries.erase(cache.back().key);
+    cache.pop_back();
+  }
+  return cache.front().interpolant;
+}
+
 template class Irregular<1>;
 template class Irregular<2>;
 template class Irregular<3>;
@@ -106,5 +173,14 @@ template bool operator!=(const Irregular<2>& lhs,
                          const Irregular<2>& rhs) noexcept;
 template bool operator!=(const Irregular<3>& lhs,
                          const Irregular<3>& rhs) noexcept;
+template std::shared_ptr<const Irregular<1>> cached_irregular(
+    size_t cache_key, const Mesh<1>& source_mesh,
+    const tnsr::I<DataVector, 1, Frame::Logical>& target_points) noexcept;
+template std::shared_ptr<const Irregular<2>> cached_irregular(
+    size_t cache_key, const Mesh<2>& source_mesh,
+    const tnsr::I<DataVector, 2, Frame::Logical>& target_points) noexcept;
+template std::shared_ptr<const Irregular<3>> cached_irregular(
+    size_t cache_key, const Mesh<3>& source_mesh,
+    const tnsr::I<DataVector, 3, Frame::Logical>& target_points) noexcept;
 
 }  // namespace intrp
@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <array>
+#include <boost/functional/hash.hpp>
 #include <cstddef>
+#include <functional>
+#include <memory>
+#include <typeinfo>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
-#include "Utilities/Blas.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -24,8 +28,22 @@ class er;
 
 namespace intrp {
 
-/// \ingroup NumericalAlgorithmsGroup
-/// Interpolates a `Variables` onto an arbitrary set of points.
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Interpolates a `Variables` onto an arbitrary set of points.
+ *
+ * The interpolant holds the one-dimensional interpolation matrices of each
+ * dimension of the source mesh, i.e. the Lagrange weights of each target point
+ * in each dimension, rather than the dense matrix of their tensor product. This
+ * makes constructing the interpolant and its memory scale with the sum of the
+ * extents of the source mesh instead of with their product. The interpolation
+ * contracts the source data with the weights one dimension at a time. The
+ * first dimension, which holds the bulk of the work, is contracted for all
+ * target points at once with a single matrix-matrix product.
+ *
+ * \see `intrp::cached_irregular` to reuse interpolants for targets that don't
+ * change between interpolations.
+ */
 template <size_t Dim>
 class Irregular {
  public:
@@ -52,11 +70,29 @@ class Irregular {
       noexcept;
   /// @}
 
+  /// The number of target points
+  size_t number_of_target_points() const noexcept {
+    return interpolation_matrices_[0].rows();
+  }
+
+  /// The number of grid points of the source mesh
+  size_t number_of_source_points() const noexcept;
+
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) noexcept {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.interpolation_matrices_ == rhs.interpolation_matrices_;
   }
-  Matrix interpolation_matrix_;
+
+  // Interpolates the `number_of_components` components of the `source` data,
+  // which are stored contiguously one after another, to the components of the
+  // `result`, which are stored the same way.
+  void interpolate_data(gsl::not_null<double*> result, const double* source,
+                        size_t number_of_components) const noexcept;
+
+  // The interpolation matrix in each dimension, with a row for each target
+  // point and a column for each grid point of the source mesh in that
+  // dimension
+  std::array<Matrix, Dim> interpolation_matrices_{};
 };
 
 template <size_t Dim>
@@ -64,24 +100,18 @@ template <typename TagsList>
 void Irregular<Dim>::interpolate(
     const gsl::not_null<Variables<TagsList>*> result,
     const Variables<TagsList>& vars) const noexcept {
-  // For matrix multiplication of Interp . Source = Result:
-  //   matrix Interp is m rows by k columns
-  //   matrix Source is k rows by n columns
-  //   matrix Result is m rows by n columns
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
-  const size_t n = vars.number_of_independent_components;
-  ASSERT(k == vars.number_of_grid_points(),
+  ASSERT(number_of_source_points() == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
              << vars.number_of_grid_points()
-             << ",\n disagrees with the size of the source_mesh, " << k
+             << ",\n disagrees with the size of the source_mesh, "
+             << number_of_source_points()
              << ", that was passed into the constructor");
+  const size_t m = number_of_target_points();
   if (result->number_of_grid_points() != m) {
     *result = Variables<TagsList>(m, 0.);
   }
-  dgemm_('n', 'n', m, n, k, 1.0, interpolation_matrix_.data(),
-         interpolation_matrix_.spacing(), vars.data(), k, 0.0, result->data(),
-         m);
+  interpolate_data(make_not_null(result->data()), vars.data(),
+                   vars.number_of_independent_components);
 }
 
 template <size_t Dim>
@@ -97,5 +127,42 @@ template <size_t Dim>
 bool operator!=(const Irregular<Dim>& lhs,
                 const Irregular<Dim>& rhs) noexcept;
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief An `Irregular` interpolant from the `source_mesh` to the
+ * `target_points`, which is reused if the interpolation identified by the
+ * `cache_key` requested it before.
+ *
+ * Targets that don't move relative to an element, such as `SpecifiedPoints` or
+ * a `KerrHorizon` of fixed resolution in a time-independent domain, request
+ * interpolation to the same logical coordinates at every observation. This
+ * function keeps the most recent interpolant of each `cache_key`, e.g. of each
+ * pair of interpolation target and element (see `intrp::irregular_cache_key`),
+ * so finding it is a hash-map lookup of the key. The interpolant is reused if
+ * the mesh and the target points compare equal to those it was constructed
+ * from, otherwise it is replaced. So moving targets, and keys that collide,
+ * construct a new interpolant but never reuse a wrong one.
+ *
+ * The cache is local to the calling thread, so no synchronization is needed,
+ * and holds at most `irregular_cache_capacity` interpolants, evicting the
+ * least recently used one.
+ */
+template <size_t Dim>
+std::shared_ptr<const Irregular<Dim>> cached_irregular(
+    size_t cache_key, const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept;
+
+/// A key for `intrp::cached_irregular` that identifies the interpolation of
+/// the data on the element `element_id` to the `InterpolationTargetTag`
+template <typename InterpolationTargetTag, typename ElementIdType>
+size_t irregular_cache_key(const ElementIdType& element_id) noexcept {
+  size_t key = typeid(InterpolationTargetTag).hash_code();
+  boost::hash_combine(key, std::hash<ElementIdType>{}(element_id));
+  return key;
+}
+
+/// The maximum number of interpolants held by the cache of `cached_irregular`
+constexpr size_t irregular_cache_capacity = 256;
+
 }  // namespace intrp
 
@@ -105,9 +105,11 @@ void interpolate_data(
                 });
 
             // Now interpolate.
-            intrp::Irregular<Metavariables::volume_dim> interpolator(
+            const auto interpolator = intrp::cached_irregular(
+                intrp::irregular_cache_key<InterpolationTargetTag>(element_id),
                 volume_info.mesh, element_coord_holder.element_logical_coords);
-            interp_info.vars.emplace_back(interpolator.interpolate(local_vars));
+            interp_info.vars.emplace_back(
+                interpolator->interpolate(local_vars));
             interp_info.global_offsets.emplace_back(
                 element_coord_holder.offsets);
           }
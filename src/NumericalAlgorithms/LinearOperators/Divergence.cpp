@@ -3,9 +3,11 @@
 
 #include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
@@ -60,14 +62,31 @@ void divergence(
   }
 }
 
+template <size_t Dim, typename DerivativeFrame>
+bool has_constant_jacobian(
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  return std::all_of(
+      inverse_jacobian.begin(), inverse_jacobian.end(),
+      [](const DataVector& component) noexcept {
+        return std::all_of(component.begin(), component.end(),
+                           [&component](const double value) noexcept {
+                             return value == component[0];
+                           });
+      });
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
-#define INSTANTIATE(_, data)                                       \
-  template Scalar<DataVector> divergence(                          \
-      const tnsr::I<DataVector, DIM(data), FRAME(data)>& input,    \
-      const Mesh<DIM(data)>& mesh,                                 \
-      const InverseJacobian<DataVector, DIM(data), Frame::Logical, \
+#define INSTANTIATE(_, data)                                          \
+  template Scalar<DataVector> divergence(                             \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& input,       \
+      const Mesh<DIM(data)>& mesh,                                    \
+      const InverseJacobian<DataVector, DIM(data), Frame::Logical,    \
+                            FRAME(data)>& inverse_jacobian) noexcept; \
+  template bool has_constant_jacobian(                                \
+      const InverseJacobian<DataVector, DIM(data), Frame::Logical,    \
                             FRAME(data)>& inverse_jacobian) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (Frame::Grid, Frame::Inertial))
@@ -72,6 +72,39 @@ void divergence(
         inverse_jacobian) noexcept;
 /// @}
 
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Compute the (Euclidean) divergence of fluxes on an element with a
+ * constant inverse Jacobian, e.g. an element with an affine map
+ *
+ * A constant inverse Jacobian commutes with the logical derivatives, so
+ * \f$\partial_i F^i = \partial_{\xi^j}\left(\frac{\partial\xi^j}{\partial
+ * x^i} F^i\right)\f$. This function contracts the fluxes with the inverse
+ * Jacobian first and then differentiates each contracted component along a
+ * single dimension with a sum-factorized sweep. It takes `Dim` times fewer
+ * derivatives than `divergence`, which differentiates all flux components in
+ * all dimensions, and needs no buffer for all these derivatives.
+ *
+ * Only the first grid point of the `inverse_jacobian` is used, so check that
+ * it is constant with `has_constant_jacobian` before calling this function.
+ */
+template <typename... DivTags, typename... FluxTags, size_t Dim,
+          typename DerivativeFrame>
+void divergence_with_constant_jacobian(
+    gsl::not_null<Variables<tmpl::list<DivTags...>>*> divergence_of_F,
+    const Variables<tmpl::list<FluxTags...>>& F, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept;
+
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Whether the `inverse_jacobian` is the same at all grid points
+///
+/// \see divergence_with_constant_jacobian
+template <size_t Dim, typename DerivativeFrame>
+bool has_constant_jacobian(
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept;
+
 /// @{
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Compute the divergence of the vector `input`
@@ -5,10 +5,17 @@
 
 #include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
 
+#include <functional>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/Arena.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
 template <typename FluxTags, size_t Dim, typename DerivativeFrame>
@@ -69,3 +76,75 @@ void divergence(
   };
   EXPAND_PACK_LEFT_TO_RIGHT(apply_div(FluxTags{}, DivTags{}));
 }
+
+template <typename... DivTags, typename... FluxTags, size_t Dim,
+          typename DerivativeFrame>
+void divergence_with_constant_jacobian(
+    const gsl::not_null<Variables<tmpl::list<DivTags...>>*> divergence_of_F,
+    const Variables<tmpl::list<FluxTags...>>& F, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  using DivVars = Variables<tmpl::list<DivTags...>>;
+  const size_t num_points = mesh.number_of_grid_points();
+  if (UNLIKELY(divergence_of_F->number_of_grid_points() != num_points)) {
+    divergence_of_F->initialize(num_points);
+  }
+  // The temporaries are taken from the arena so repeated calls, e.g. in every
+  // application of an elliptic DG operator, don't allocate from the heap
+  Arena& arena = Arena::local();
+  const ArenaScope arena_scope{make_not_null(&arena)};
+  DivVars contracted_F{
+      arena.allocate<double>(num_points *
+                             DivVars::number_of_independent_components),
+      num_points};
+  // Only used in more than one dimension, but memory from the arena is cheap
+  DivVars logical_derivative{
+      arena.allocate<double>(num_points *
+                             DivVars::number_of_independent_components),
+      num_points};
+
+  static const Matrix identity{};
+  auto matrices = make_array<Dim>(std::cref(identity));
+  for (size_t logical_i = 0; logical_i < Dim; ++logical_i) {
+    // Contract the fluxes with the row of the inverse Jacobian that belongs to
+    // this logical direction
+    const auto contract_fluxes = [&contracted_F, &F, &inverse_jacobian,
+                                  &logical_i](auto flux_tag_v,
+                                              auto div_tag_v) noexcept {
+      using FluxTag = std::decay_t<decltype(flux_tag_v)>;
+      using DivFluxTag = std::decay_t<decltype(div_tag_v)>;
+      using first_index = tmpl::front<typename FluxTag::type::index_list>;
+      static_assert(
+          std::is_same_v<typename first_index::Frame, DerivativeFrame> and
+              first_index::ul == UpLo::Up,
+          "First index of tensor cannot be contracted with derivative "
+          "because either it is in the wrong frame or it has the wrong "
+          "valence");
+      const auto& flux = get<FluxTag>(F);
+      auto& contracted_flux = get<DivFluxTag>(contracted_F);
+      for (auto it = contracted_flux.begin(); it != contracted_flux.end();
+           ++it) {
+        const auto div_flux_indices = contracted_flux.get_tensor_index(it);
+        *it = inverse_jacobian.get(logical_i, 0)[0] *
+              flux.get(prepend(div_flux_indices, size_t{0}));
+        for (size_t deriv_i = 1; deriv_i < Dim; ++deriv_i) {
+          *it += inverse_jacobian.get(logical_i, deriv_i)[0] *
+                 flux.get(prepend(div_flux_indices, deriv_i));
+        }
+      }
+    };
+    EXPAND_PACK_LEFT_TO_RIGHT(contract_fluxes(FluxTags{}, DivTags{}));
+
+    // Differentiate the contracted fluxes only along this logical direction
+    gsl::at(matrices, logical_i) = std::cref(
+        Spectral::differentiation_matrix(mesh.slice_through(logical_i)));
+    if (logical_i == 0) {
+      apply_matrices(divergence_of_F, matrices, contracted_F, mesh.extents());
+    } else {
+      apply_matrices(make_not_null(&logical_derivative), matrices,
+                     contracted_F, mesh.extents());
+      *divergence_of_F += logical_derivative;
+    }
+    gsl::at(matrices, logical_i) = std::cref(identity);
+  }
+}
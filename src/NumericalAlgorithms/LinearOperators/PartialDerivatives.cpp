@@ -3,17 +3,22 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <functional>
 #include <vector>
 
+#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Transpose.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
@@ -38,6 +43,66 @@ void apply_matrix_in_first_dim(double* result, const double* const input,
 }
 }  // namespace
 
+namespace partial_derivatives_detail {
+template <size_t Dim>
+bool use_fused_logical_partial_derivatives(const Mesh<Dim>& mesh) noexcept {
+  return alg::all_of(mesh.extents(), [](const size_t extent) noexcept {
+    return extent <= apply_matrices_detail::max_sum_factorization_extent;
+  });
+}
+
+template <size_t Dim>
+void fused_logical_partial_derivatives(
+    const gsl::not_null<std::array<double*, Dim>*> logical_du,
+    const double* const u, const size_t number_of_components,
+    const Mesh<Dim>& mesh) noexcept {
+  const size_t num_grid_points = mesh.number_of_grid_points();
+  const size_t components_per_block =
+      fused_components_per_block<Dim>(num_grid_points);
+  const Matrix empty_matrix{};
+  std::array<std::reference_wrapper<const Matrix>, Dim> diff_matrices{
+      make_array<Dim, std::reference_wrapper<const Matrix>>(empty_matrix)};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(diff_matrices, d) =
+        std::cref(Spectral::differentiation_matrix(mesh.slice_through(d)));
+  }
+  // Only the matrix in the direction being differentiated is non-empty, so
+  // `apply_matrices` performs a single strided pass over the block.
+  std::array<std::reference_wrapper<const Matrix>, Dim> matrices{
+      make_array<Dim, std::reference_wrapper<const Matrix>>(empty_matrix)};
+  for (size_t first_component = 0; first_component < number_of_components;
+       first_component += components_per_block) {
+    const size_t block_size =
+        std::min(components_per_block, number_of_components - first_component);
+    const size_t offset = first_component * num_grid_points;
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(matrices, d) = gsl::at(diff_matrices, d);
+      apply_matrices_detail::Impl<double, Dim>::apply(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          make_not_null(gsl::at(*logical_du, d) + offset), matrices,
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          u + offset, mesh.extents(), block_size);
+      gsl::at(matrices, d) = std::cref(empty_matrix);
+    }
+  }
+}
+
+#define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                       \
+  template bool use_fused_logical_partial_derivatives(               \
+      const Mesh<GET_DIM(data)>& mesh) noexcept;                     \
+  template void fused_logical_partial_derivatives(                   \
+      gsl::not_null<std::array<double*, GET_DIM(data)>*> logical_du, \
+      const double* u, size_t number_of_components,                  \
+      const Mesh<GET_DIM(data)>& mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef GET_DIM
+}  // namespace partial_derivatives_detail
+
 template <typename SymmList, typename IndexList, size_t Dim>
 void logical_partial_derivative(
     const gsl::not_null<TensorMetafunctions::prepend_spatial_index<
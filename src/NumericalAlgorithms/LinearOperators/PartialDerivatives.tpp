@@ -5,6 +5,10 @@
 
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -25,46 +29,48 @@ namespace partial_derivatives_detail {
 template <size_t Dim, typename VariableTags, typename DerivativeTags>
 struct LogicalImpl;
 
-// This routine has been optimized to perform really well. The following
-// describes what optimizations were made.
-//
-// - The `partial_derivatives` functions below have an overload where the
-//   logical derivatives may be passed in instead of being computed. In the
-//   overloads where the logical derivatives are not passed in they must be
-//   computed. However, it is more efficient to allocate the memory for the
-//   logical partial derivatives with respect to each coordinate at once. This
-//   requires the `partial_derivatives_impl` to accept raw pointers to doubles
-//   for the logical derivatives so it can be used for all overloads.
-//
-// - The resultant Variables `du` is a not_null pointer so that mutating compute
-//   items can be supported.
-//
-// - The storage indices into the inverse Jacobian are precomputed to avoid
-//   having to recompute them for each tensor component of `u`.
-//
-// - The DataVectors lhs and logical_du are non-owning DataVectors to be able to
-//   plug into the optimized expression templates. This requires a `const_cast`
-//   even though we will never change the `double*`.
+// The fused path computes the derivatives in all `Dim` logical directions of a
+// block of tensor components before moving on to the next block, so that the
+// block of `u` is read from cache rather than from main memory for every
+// direction. The differentiation matrices are applied with the sum-factorized
+// kernels of `apply_matrices`, which need no transposes and no temporary
+// buffer. When the inverse Jacobian is given, it is applied to each block of
+// logical derivatives right away so the logical derivatives never have to be
+// stored for all components at once.
 //
-// - Loop over every Tensor component in the variables by incrementing a raw
-//   pointer to the contiguous data (vs. looping over each Tensor in the
-//   variables with a tmpl::for_each then iterating over each component of this
-//   Tensor).
-//
-// - We factor out the `logical_deriv_index == 0` case so that we do not need to
-//   zero the memory in `du` before the computation.
-template <typename DerivativeTags, size_t Dim, typename DerivativeFrame>
-void partial_derivatives_impl(
-    const gsl::not_null<Variables<db::wrap_tags_in<
-        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
-        du,
+// The block size is chosen so that a block of `u` together with its `Dim`
+// logical derivatives (`fused_block_size` doubles in total) fits comfortably
+// in the L2 cache.
+constexpr size_t fused_block_size = 16384;
+
+template <size_t Dim>
+constexpr size_t fused_components_per_block(
+    const size_t num_grid_points) noexcept {
+  return std::max(size_t{1}, fused_block_size / ((Dim + 1) * num_grid_points));
+}
+
+// The fused path is used when every extent of the mesh is small enough for
+// the sum-factorized kernels. Otherwise the BLAS-based `LogicalImpl` is used.
+template <size_t Dim>
+bool use_fused_logical_partial_derivatives(const Mesh<Dim>& mesh) noexcept;
+
+// Computes the logical derivatives of the first `number_of_components`
+// components of the contiguous data `u` in all directions, block by block.
+template <size_t Dim>
+void fused_logical_partial_derivatives(
+    gsl::not_null<std::array<double*, Dim>*> logical_du, const double* u,
+    size_t number_of_components, const Mesh<Dim>& mesh) noexcept;
+
+// Contracts the logical derivatives of `number_of_components` components with
+// the inverse Jacobian, writing the result to `pdu` in the layout of a
+// `Variables` of `Tags::deriv`.
+template <size_t Dim, typename DerivativeFrame>
+void apply_inverse_jacobian(
+    double* pdu,
     const std::array<const double*, Dim>& logical_partial_derivatives_of_u,
+    const size_t number_of_components, const size_t num_grid_points,
     const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
         inverse_jacobian) noexcept {
-  constexpr size_t number_of_independent_components =
-      Variables<DerivativeTags>::number_of_independent_components;
-  double* pdu = du->data();
-  const size_t num_grid_points = du->number_of_grid_points();
   DataVector lhs{};
   DataVector logical_du{};
 
@@ -77,8 +83,8 @@ void partial_derivatives_impl(
     }
   }
 
-  for (size_t component_index = 0;
-       component_index < number_of_independent_components; ++component_index) {
+  for (size_t component_index = 0; component_index < number_of_components;
+       ++component_index) {
     for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
       lhs.set_data_ref(pdu, num_grid_points);
       // clang-tidy: const cast is fine since we won't modify the data and we
@@ -109,6 +115,48 @@ void partial_derivatives_impl(
     }
   }
 }
+
+// This routine has been optimized to perform really well. The following
+// describes what optimizations were made.
+//
+// - The `partial_derivatives` functions below have an overload where the
+//   logical derivatives may be passed in instead of being computed. In the
+//   overloads where the logical derivatives are not passed in they must be
+//   computed. However, it is more efficient to allocate the memory for the
+//   logical partial derivatives with respect to each coordinate at once. This
+//   requires the `partial_derivatives_impl` to accept raw pointers to doubles
+//   for the logical derivatives so it can be used for all overloads.
+//
+// - The resultant Variables `du` is a not_null pointer so that mutating compute
+//   items can be supported.
+//
+// - The storage indices into the inverse Jacobian are precomputed to avoid
+//   having to recompute them for each tensor component of `u`.
+//
+// - The DataVectors lhs and logical_du are non-owning DataVectors to be able to
+//   plug into the optimized expression templates. This requires a `const_cast`
+//   even though we will never change the `double*`.
+//
+// - Loop over every Tensor component in the variables by incrementing a raw
+//   pointer to the contiguous data (vs. looping over each Tensor in the
+//   variables with a tmpl::for_each then iterating over each component of this
+//   Tensor).
+//
+// - We factor out the `logical_deriv_index == 0` case so that we do not need to
+//   zero the memory in `du` before the computation.
+template <typename DerivativeTags, size_t Dim, typename DerivativeFrame>
+void partial_derivatives_impl(
+    const gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const std::array<const double*, Dim>& logical_partial_derivatives_of_u,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept {
+  apply_inverse_jacobian(
+      du->data(), logical_partial_derivatives_of_u,
+      Variables<DerivativeTags>::number_of_independent_components,
+      du->number_of_grid_points(), inverse_jacobian);
+}
 }  // namespace partial_derivatives_detail
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
@@ -127,6 +175,13 @@ void logical_partial_derivatives(
     gsl::at(deriv_pointers, i) =
         gsl::at(*logical_partial_derivatives_of_u, i).data();
   }
+  if (partial_derivatives_detail::use_fused_logical_partial_derivatives(
+          mesh)) {
+    partial_derivatives_detail::fused_logical_partial_derivatives(
+        make_not_null(&deriv_pointers), u.data(),
+        Variables<DerivativeTags>::number_of_independent_components, mesh);
+    return;
+  }
   if (Dim == 1) {
     Variables<DerivativeTags>* temp = nullptr;
     partial_derivatives_detail::LogicalImpl<Dim, VariableTags, DerivativeTags>::
@@ -192,6 +247,41 @@ void partial_derivatives(
     partial_derivatives_of_u.initialize(mesh.number_of_grid_points());
   }
 
+  if (partial_derivatives_detail::use_fused_logical_partial_derivatives(
+          mesh)) {
+    constexpr size_t number_of_components =
+        Variables<DerivativeTags>::number_of_independent_components;
+    const size_t num_grid_points = mesh.number_of_grid_points();
+    const size_t components_per_block = std::min(
+        number_of_components,
+        partial_derivatives_detail::fused_components_per_block<Dim>(
+            num_grid_points));
+    const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
+        Dim * components_per_block * num_grid_points);
+    std::array<double*, Dim> logical_derivs{};
+    std::array<const double*, Dim> const_logical_derivs{};
+    for (size_t first_component = 0; first_component < number_of_components;
+         first_component += components_per_block) {
+      const size_t block_size = std::min(components_per_block,
+                                         number_of_components - first_component);
+      for (size_t i = 0; i < Dim; ++i) {
+        gsl::at(logical_derivs, i) =
+            &(logical_derivs_data[i * block_size * num_grid_points]);
+        gsl::at(const_logical_derivs, i) = gsl::at(logical_derivs, i);
+      }
+      partial_derivatives_detail::fused_logical_partial_derivatives(
+          make_not_null(&logical_derivs),
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          u.data() + first_component * num_grid_points, block_size, mesh);
+      partial_derivatives_detail::apply_inverse_jacobian(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          partial_derivatives_of_u.data() +
+              first_component * Dim * num_grid_points,
+          const_logical_derivs, block_size, num_grid_points, inverse_jacobian);
+    }
+    return;
+  }
+
   const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
       Dim * u.number_of_grid_points() *
       Variables<DerivativeTags>::number_of_independent_components);
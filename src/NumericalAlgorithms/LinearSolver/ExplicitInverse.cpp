@@ -0,0 +1,223 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
+
+#include <algorithm>
+#include <array>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <stdexcept>
+#include <utility>
+
+#include "DataStructures/DenseMatrix.hpp"
+#include "DataStructures/DenseVector.hpp"
+#include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+using LinearSolver::Serial::detail::InverseOperator;
+using LinearSolver::Serial::detail::OperatorFingerprint;
+
+constexpr double roundoff_eps = std::numeric_limits<double>::epsilon() * 100.0;
+
+// Entry `j` of the vector that fingerprints apply the operator to. The entries
+// have pseudo-random signs and magnitudes in [1, 2), computed with the
+// SplitMix64 mixing function so they are the same on all processes.
+double probe_entry(const size_t j) noexcept {
+  uint64_t bits = static_cast<uint64_t>(j) + 0x9e3779b97f4a7c15;
+  bits = (bits ^ (bits >> 30)) * 0xbf58476d1ce4e5b9;
+  bits = (bits ^ (bits >> 27)) * 0x94d049bb133111eb;
+  bits ^= bits >> 31;
+  const double magnitude =
+      1. + std::ldexp(static_cast<double>(bits >> 11), -53);
+  return (bits & 1) == 0 ? magnitude : -magnitude;
+}
+
+// Only the inverse operators that are in use are kept alive, so the cache holds
+// a handful of entries and a linear search over their fingerprints is fast
+std::mutex cache_mutex{};
+std::list<std::weak_ptr<const InverseOperator>> cache{};
+
+// Must be called with the `cache_mutex` locked
+std::shared_ptr<const InverseOperator> find_in_cache(
+    const OperatorFingerprint& fingerprint,
+    const bool lu_factorization) noexcept {
+  cache.remove_if(
+      [](const std::weak_ptr<const InverseOperator>& entry) noexcept {
+        return entry.expired();
+      });
+  for (const auto& entry : cache) {
+    auto cached_inverse_operator = entry.lock();
+    if (cached_inverse_operator != nullptr and
+        cached_inverse_operator->pivots.empty() != lu_factorization and
+        cached_inverse_operator->fingerprint == fingerprint) {
+      return cached_inverse_operator;
+    }
+  }
+  return nullptr;
+}
+
+// Returns the cached operator that is equal to the `inverse_operator`, or adds
+// the `inverse_operator` to the cache
+std::shared_ptr<const InverseOperator> insert_into_cache(
+    std::shared_ptr<const InverseOperator> inverse_operator) noexcept {
+  const std::lock_guard<std::mutex> lock{cache_mutex};
+  // Another thread may have inverted the same operator in the meantime
+  auto cached_inverse_operator =
+      find_in_cache(inverse_operator->fingerprint,
+                    not inverse_operator->pivots.empty());
+  if (cached_inverse_operator != nullptr) {
+    return cached_inverse_operator;
+  }
+  cache.push_back(inverse_operator);
+  return inverse_operator;
+}
+}  // namespace
+
+namespace LinearSolver::Serial::detail {
+
+OperatorFingerprint::OperatorFingerprint(
+    const DenseMatrix<double, blaze::columnMajor>& operator_matrix) noexcept
+    : size(operator_matrix.rows()),
+      sampled_rows(operator_matrix.columns(), 3),
+      probe_result(operator_matrix.rows(), 0.),
+      probe_magnitude(operator_matrix.rows(), 0.) {
+  ASSERT(operator_matrix.rows() == operator_matrix.columns(),
+         "The operator matrix must be square, but it has "
+             << operator_matrix.rows() << " rows and "
+             << operator_matrix.columns() << " columns.");
+  if (size == 0) {
+    return;
+  }
+  const std::array<size_t, 3> sampled_row_indices{{0, size / 2, size - 1}};
+  for (size_t j = 0; j < size; ++j) {
+    const double probe = probe_entry(j);
+    for (size_t i = 0; i < size; ++i) {
+      const double entry = operator_matrix(i, j);
+      scale = std::max(scale, std::abs(entry));
+      probe_result[i] += entry * probe;
+      probe_magnitude[i] += std::abs(entry * probe);
+    }
+    for (size_t k = 0; k < sampled_row_indices.size(); ++k) {
+      sampled_rows(j, k) = operator_matrix(gsl::at(sampled_row_indices, k), j);
+    }
+  }
+}
+
+void OperatorFingerprint::pup(PUP::er& p) noexcept {
+  p | size;
+  p | scale;
+  p | sampled_rows;
+  p | probe_result;
+  p | probe_magnitude;
+}
+
+bool operator==(const OperatorFingerprint& lhs,
+                const OperatorFingerprint& rhs) noexcept {
+  if (lhs.size != rhs.size or
+      lhs.sampled_rows.columns() != rhs.sampled_rows.columns()) {
+    return false;
+  }
+  // Entries that are small compared to the matrix compare with an absolute
+  // tolerance
+  const double scale = std::max(lhs.scale, rhs.scale);
+  for (size_t k = 0; k < lhs.sampled_rows.columns(); ++k) {
+    for (size_t j = 0; j < lhs.size; ++j) {
+      if (not equal_within_roundoff(lhs.sampled_rows(j, k),
+                                    rhs.sampled_rows(j, k), roundoff_eps,
+                                    scale)) {
+        return false;
+      }
+    }
+  }
+  for (size_t i = 0; i < lhs.size; ++i) {
+    if (not equal_within_roundoff(
+            lhs.probe_result[i], rhs.probe_result[i], roundoff_eps,
+            std::max(lhs.probe_magnitude[i], rhs.probe_magnitude[i]) +
+                scale)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool operator!=(const OperatorFingerprint& lhs,
+                const OperatorFingerprint& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+void InverseOperator::apply(const gsl::not_null<DenseVector<double>*> result,
+                            const DenseVector<double>& operand) const
+    noexcept {
+  if (pivots.empty()) {
+    *result = matrix * operand;
+  } else {
+    *result = operand;
+    blaze::getrs(matrix, *result, 'N', pivots.data());
+  }
+}
+
+void InverseOperator::pup(PUP::er& p) noexcept {
+  p | fingerprint;
+  p | matrix;
+  p | pivots;
+}
+
+std::shared_ptr<const InverseOperator> shared_inverse_operator(
+    DenseMatrix<double, blaze::columnMajor> operator_matrix,
+    const bool lu_factorization) noexcept {
+  OperatorFingerprint fingerprint{operator_matrix};
+  {
+    const std::lock_guard<std::mutex> lock{cache_mutex};
+    auto cached_inverse_operator =
+        find_in_cache(fingerprint, lu_factorization);
+    if (cached_inverse_operator != nullptr) {
+      return cached_inverse_operator;
+    }
+  }
+
+  // Invert or factorize the matrix without holding the lock, so other threads
+  // can look up different operators in the meantime
+  const size_t size = operator_matrix.rows();
+  auto inverse_operator = std::make_shared<InverseOperator>();
+  inverse_operator->fingerprint = std::move(fingerprint);
+  inverse_operator->matrix = std::move(operator_matrix);
+  if (lu_factorization) {
+    inverse_operator->pivots.resize(size);
+    blaze::getrf(inverse_operator->matrix, inverse_operator->pivots.data());
+    for (size_t i = 0; i < size; ++i) {
+      if (inverse_operator->matrix(i, i) == 0.) {
+        ERROR("Could not factorize subdomain matrix (size "
+              << size << "): The matrix is singular.");
+      }
+    }
+  } else {
+    try {
+      blaze::invert(inverse_operator->matrix);
+    } catch (const std::invalid_argument& e) {
+      ERROR("Could not invert subdomain matrix (size " << size
+                                                       << "): " << e.what());
+    }
+  }
+  return insert_into_cache(std::move(inverse_operator));
+}
+
+std::shared_ptr<const InverseOperator> shared_inverse_operator(
+    InverseOperator inverse_operator) noexcept {
+  return insert_into_cache(
+      std::make_shared<const InverseOperator>(std::move(inverse_operator)));
+}
+
+}  // namespace LinearSolver::Serial::detail
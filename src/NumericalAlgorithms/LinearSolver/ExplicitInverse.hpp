@@ -4,7 +4,10 @@
 #pragma once
 
 #include <algorithm>
+#include <blaze/math/blas/Types.h>
 #include <cstddef>
+#include <limits>
+#include <memory>
 #include <vector>
 
 #include "DataStructures/DenseMatrix.hpp"
@@ -13,6 +16,8 @@
 #include "NumericalAlgorithms/LinearSolver/LinearSolver.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/CharmPupable.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/CreateIsCallable.hpp"
@@ -32,6 +37,81 @@ using ExplicitInverse = Registration::Registrar<Serial::ExplicitInverse>;
 namespace detail {
 CREATE_IS_CALLABLE(reset)
 CREATE_IS_CALLABLE_V(reset)
+
+/*!
+ * \brief Identifies an operator matrix up to roundoff without storing it
+ *
+ * Holds a few rows of the operator matrix and the product of the matrix with
+ * a fixed vector of pseudo-random entries, so it takes \f$\mathcal{O}(N)\f$
+ * memory for an \f$N \times N\f$ matrix. Each entry of the product is
+ * compared within the roundoff error of computing it, and the pseudo-random
+ * signs and magnitudes of the vector make it practically impossible for
+ * differences between operators to cancel in the product.
+ */
+struct OperatorFingerprint {
+  OperatorFingerprint() = default;
+  explicit OperatorFingerprint(
+      const DenseMatrix<double, blaze::columnMajor>& operator_matrix) noexcept;
+
+  size_t size = 0;
+  // The largest magnitude of the entries of the matrix
+  double scale = 0.;
+  // The first, middle and last rows of the matrix, stored as columns
+  DenseMatrix<double, blaze::columnMajor> sampled_rows{};
+  // The product of the matrix with the pseudo-random vector, and the product
+  // of the magnitudes, which bounds the roundoff error of the product
+  DenseVector<double> probe_result{};
+  DenseVector<double> probe_magnitude{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+};
+
+/// Whether the fingerprints belong to operator matrices that are equal up to
+/// roundoff
+bool operator==(const OperatorFingerprint& lhs,
+                const OperatorFingerprint& rhs) noexcept;
+
+bool operator!=(const OperatorFingerprint& lhs,
+                const OperatorFingerprint& rhs) noexcept;
+
+/// The inverse of a linear operator, represented either by an explicit matrix
+/// or by the LU factors of the operator matrix
+struct InverseOperator {
+  // Identifies the operator that this is the inverse of
+  OperatorFingerprint fingerprint{};
+  DenseMatrix<double, blaze::columnMajor> matrix{};
+  // The row permutation of the LU factorization, or empty if `matrix` is the
+  // explicit inverse
+  std::vector<blaze::blas_int_t> pivots{};
+
+  void apply(gsl::not_null<DenseVector<double>*> result,
+             const DenseVector<double>& operand) const noexcept;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept;
+};
+
+/*!
+ * \brief Invert or LU-factorize the `operator_matrix`, sharing the result with
+ * all other callers that pass an identical matrix.
+ *
+ * A cached inverse operator lives as long as any caller holds on to it, so the
+ * cache releases the memory once all solvers that use it are reset. The cache
+ * identifies operators by their `OperatorFingerprint` rather than keeping a
+ * copy of every operator matrix. Operators that differ only by roundoff, e.g.
+ * because the Jacobians of their elements were computed from different block
+ * corners, share an inverse.
+ */
+std::shared_ptr<const InverseOperator> shared_inverse_operator(
+    DenseMatrix<double, blaze::columnMajor> operator_matrix,
+    bool lu_factorization) noexcept;
+
+/// Share the deserialized `inverse_operator` with all other callers that use
+/// an identical operator, or with all callers that pass an identical operator
+/// later.
+std::shared_ptr<const InverseOperator> shared_inverse_operator(
+    InverseOperator inverse_operator) noexcept;
 }  // namespace detail
 
 /*!
@@ -44,6 +124,24 @@ CREATE_IS_CALLABLE_V(reset)
  * in a single step. This means that each element has a large initialization
  * cost, but all successive solves converge immediately.
  *
+ * With the `LuFactorization` option the solver stores the LU factors of the
+ * operator matrix (with partial pivoting) instead of its inverse. The
+ * factorization is about three times cheaper to compute than the inverse and
+ * takes the same amount of memory. Each solve then performs two triangular
+ * solves instead of a matrix-vector product, which has the same operation
+ * count.
+ *
+ * Solvers that build identical operator matrices share a single inverse or
+ * factorization within a process (see
+ * `LinearSolver::Serial::detail::shared_inverse_operator`). For example, the
+ * subdomain operators of a `LinearSolver::Schwarz::Schwarz` smoother are
+ * identical for all subdomains with the same mesh, Jacobians and overlaps,
+ * which is the case for most subdomains in uniform regions of the domain. Only
+ * the first of these subdomains pays for the inversion, and the memory is
+ * shared by all of them. The operator matrix is still built on every element,
+ * since that is needed to detect identical operators, but it is only kept
+ * until it is inverted.
+ *
  * \par Advice on using this linear solver:
  *
  * - This solver is entirely agnostic to the structure of the linear operator.
@@ -55,11 +153,11 @@ CREATE_IS_CALLABLE_V(reset)
  * - Since this linear solver stores the full inverse operator matrix it can
  *   have significant memory demands. For example, an operator representing a 3D
  *   first-order Elasticity system (9 variables) discretized on 12 grid points
- *   per dimension requires ca. 2GB of memory (per element) to store the matrix,
- *   scaling quadratically with the number of variables and with a power of 6
- *   with the number of grid points per dimension. Therefore, make sure to
- *   distribute the elements on a sufficient number of nodes to meet the memory
- *   requirements.
+ *   per dimension requires ca. 2GB of memory (per distinct operator) to store
+ *   the matrix, scaling quadratically with the number of variables and with
+ *   a power of 6 with the number of grid points per dimension. Therefore, make
+ *   sure to distribute the elements on a sufficient number of nodes to meet
+ *   the memory requirements.
  * - This linear solver can be `reset()` when the operator changes (e.g. in each
  *   nonlinear-solver iteration). However, when using this solver as
  *   preconditioner it can be advantageous to avoid the reset and the
@@ -75,11 +173,23 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   using Base = LinearSolver<LinearSolverRegistrars>;
 
  public:
-  using options = tmpl::list<>;
+  struct LuFactorization {
+    using type = bool;
+    static constexpr Options::String help =
+        "Store the LU factorization of the matrix instead of its inverse. It "
+        "is cheaper to compute and takes the same amount of memory as the "
+        "inverse.";
+  };
+
+  using options = tmpl::list<LuFactorization>;
   static constexpr Options::String help =
       "Build a matrix representation of the linear operator and invert it "
       "directly. This means that the first solve has a large initialization "
-      "cost, but all subsequent solves converge immediately.";
+      "cost, but all subsequent solves converge immediately. Identical "
+      "operators share their inverse.";
+
+  explicit ExplicitInverse(const bool lu_factorization) noexcept
+      : lu_factorization_(lu_factorization) {}
 
   ExplicitInverse() = default;
   ExplicitInverse(const ExplicitInverse& /*rhs*/) = default;
@@ -114,28 +224,49 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
                                   const LinearOperator& linear_operator,
                                   const SourceType& source) const noexcept;
 
-  /// Flags the operator to require re-initialization. No memory is released.
-  /// Call this function to rebuild the solver when the operator changed.
+  /// Flags the operator to require re-initialization. Releases this solver's
+  /// share of the inverse operator, which is freed once no other solver uses
+  /// it. Call this function to rebuild the solver when the operator changed.
   void reset() noexcept override {
     size_ = std::numeric_limits<size_t>::max();
+    inverse_operator_.reset();
   }
 
   /// Size of the operator. The stored matrix will have `size^2` entries.
   size_t size() const noexcept { return size_; }
 
+  /// Whether the solver stores the LU factorization of the operator matrix
+  /// instead of its inverse
+  bool lu_factorization() const noexcept { return lu_factorization_; }
+
   /// The matrix representation of the solver. This matrix approximates the
-  /// inverse of the subdomain operator.
+  /// inverse of the subdomain operator, or holds the LU factors of the
+  /// subdomain operator if `lu_factorization()` is `true`.
   const DenseMatrix<double>& matrix_representation() const noexcept {
-    return inverse_;
+    ASSERT(inverse_operator_ != nullptr,
+           "The solver has not built the matrix yet. Invoke 'solve' first.");
+    return inverse_operator_->matrix;
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) noexcept override {
     p | size_;
-    p | inverse_;
-    if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
-      source_workspace_.resize(size_);
-      solution_workspace_.resize(size_);
+    p | lu_factorization_;
+    if (size_ != std::numeric_limits<size_t>::max()) {
+      if (p.isUnpacking()) {
+        // Share the inverse operator again with the other solvers on this
+        // process that use an identical operator
+        detail::InverseOperator inverse_operator{};
+        p | inverse_operator;
+        inverse_operator_ =
+            detail::shared_inverse_operator(std::move(inverse_operator));
+        source_workspace_.resize(size_);
+        solution_workspace_.resize(size_);
+      } else {
+        // Sizing and packing only read the shared inverse operator
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        p | const_cast<detail::InverseOperator&>(*inverse_operator_);
+      }
     }
   }
 
@@ -144,9 +275,11 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   }
 
  private:
+  bool lu_factorization_ = false;
+
   // Caches for successive solves of the same operator
   mutable size_t size_ = std::numeric_limits<size_t>::max();
-  mutable DenseMatrix<double, blaze::columnMajor> inverse_{};
+  mutable std::shared_ptr<const detail::InverseOperator> inverse_operator_{};
 
   // Buffers to avoid re-allocating memory for applying the operator
   mutable DenseVector<double> source_workspace_{};
@@ -164,12 +297,11 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
     size_ = used_for_size.size();
     source_workspace_.resize(size_);
     solution_workspace_.resize(size_);
-    inverse_.resize(size_, size_);
     // Construct explicit matrix representation by "sniffing out" the operator,
     // i.e. feeding it unit vectors
     auto unit_vector = make_with_value<VarsType>(used_for_size, 0.);
     auto result_buffer = make_with_value<SourceType>(used_for_size, 0.);
-    auto& operator_matrix = inverse_;
+    DenseMatrix<double, blaze::columnMajor> operator_matrix(size_, size_);
     size_t i = 0;
     // Re-using the iterators for all operator invocations
     auto result_iterator_begin = result_buffer.begin();
@@ -195,13 +327,10 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
                 column(operator_matrix, i).begin());
       ++i;
     }
-    // Directly invert the matrix
-    try {
-      blaze::invert(inverse_);
-    } catch (const std::invalid_argument& e) {
-      ERROR("Could not invert subdomain matrix (size " << size_
-                                                       << "): " << e.what());
-    }
+    // Directly invert or factorize the matrix, or re-use the result for an
+    // identical matrix
+    inverse_operator_ = detail::shared_inverse_operator(
+        std::move(operator_matrix), lu_factorization_);
   }
   // Copy source into contiguous workspace. In cases where the source and
   // solution data are already stored contiguously we might avoid the copy and
@@ -209,7 +338,8 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
   // and storing the matrix this is likely insignificant.
   std::copy(source.begin(), source.end(), source_workspace_.begin());
   // Apply inverse
-  solution_workspace_ = inverse_ * source_workspace_;
+  inverse_operator_->apply(make_not_null(&solution_workspace_),
+                           source_workspace_);
   // Reconstruct solution data from contiguous workspace
   std::copy(solution_workspace_.begin(), solution_workspace_.end(),
             solution->begin());
@@ -27,6 +27,7 @@
 #include "Parallel/CharmRegistration.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
+#include "Parallel/MeasuredLoad.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -181,6 +182,13 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
 
   using phase_dependent_action_lists = tmpl::list<PhaseDepActionListsPack...>;
 
+  /// Array elements measure the wall time they spend executing actions if the
+  /// executable has a `LoadBalancing` phase, and report the resulting load on
+  /// each processor before and after load balancing.
+  static constexpr bool measures_load =
+      std::is_same_v<chare_type, Parallel::Algorithms::Array> and
+      Algorithm_detail::has_LoadBalancing_v<typename metavariables::Phase>;
+
   /// \cond
   // Needed for serialization
   AlgorithmImpl() noexcept;
@@ -212,6 +220,8 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
     }
     p | terminate_;
     p | halt_algorithm_until_next_phase_;
+    p | measured_load_;
+    p | number_of_load_reports_;
     p | box_;
     // After unpacking the DataBox, we "touch" the GlobalCache proxy inside.
     // This forces the DataBox to recompute the GlobalCache* the next time it
@@ -361,6 +371,17 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
     // set terminate to true if there are no actions in this PDAL
     set_terminate(number_of_actions_in_phase(next_phase) == 0);
 
+    if constexpr (measures_load) {
+      if (next_phase == metavariables::Phase::LoadBalancing) {
+        contribute_measured_load(false);
+      } else if (phase_ == metavariables::Phase::LoadBalancing) {
+        // The element may have migrated, so this reports the load that the
+        // new distribution would have had during the last measurement
+        contribute_measured_load(true);
+        measured_load_ = 0.0;
+      }
+    }
+
     // Ideally, we'd set the bookmarks as we are leaving a phase, but there is
     // no 'clean-up' code that we run when departing a phase, so instead we set
     // the bookmark for the previous phase (still stored in `phase_` at this
@@ -567,6 +588,34 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
     return number_of_actions;
   }
 
+  // Reduce the measured load of all elements to the total load and the largest
+  // load on a processor, which the Main chare reports. The loads on each
+  // processor are summed locally, so each element only contributes two numbers
+  // independent of the number of processors.
+  void contribute_measured_load(const bool after_load_balancing) noexcept {
+    ++number_of_load_reports_;
+    auto reduction_data =
+        Parallel::detail::measured_load_contribution<ParallelComponent>(
+            measured_load_, number_of_load_reports_, sys::my_proc(),
+            after_load_balancing);
+    const auto main_proxy =
+        global_cache_proxy_.ckLocalBranch()->get_main_proxy();
+    ASSERT(main_proxy.has_value(),
+           "The Main proxy must be set to report the measured load.");
+    using reduction_data_type = decltype(reduction_data);
+    (void)Parallel::charmxx::RegisterReducerFunction<
+        reduction_data_type::combine>::registrar;
+    const CkCallback callback(CProxy_Main<metavariables>::index_t::
+                                  redn_wrapper_report_measured_load(nullptr),
+                              main_proxy.value());
+    this->contribute(static_cast<int>(reduction_data.size()),
+                     reduction_data.packed().get(),
+                     Parallel::charmxx::charm_reducer_functions.at(
+                         std::hash<Parallel::charmxx::ReducerFunctions>{}(
+                             &reduction_data_type::combine)),
+                     callback);
+  }
+
   // Invoke the static `apply` method of `ThisAction`. The if constexprs are for
   // handling the cases where the `apply` method returns a tuple of one, two,
   // or three elements, in order:
@@ -668,6 +717,10 @@ class AlgorithmImpl<ParallelComponent, tmpl::list<PhaseDepActionListsPack...>>
 
   bool terminate_{true};
   bool halt_algorithm_until_next_phase_{false};
+  // Wall time spent executing actions since the last load balancing
+  double measured_load_{0.0};
+  // Identifies the reductions of the measured load, which are collective
+  size_t number_of_load_reports_{0};
 
   using all_cache_tags = get_const_global_cache_tags<metavariables>;
   using initial_databox = db::compute_databox_type<tmpl::flatten<tmpl::list<
@@ -876,6 +929,10 @@ constexpr void AlgorithmImpl<
 #ifdef SPECTRE_CHARM_PROJECTIONS
   non_action_time_start_ = sys::wall_time();
 #endif
+  [[maybe_unused]] double load_measurement_start = 0.0;
+  if constexpr (measures_load) {
+    load_measurement_start = sys::wall_time();
+  }
   if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
     node_lock_.lock();
   }
@@ -899,6 +956,9 @@ constexpr void AlgorithmImpl<
   if constexpr (std::is_same_v<Parallel::NodeLock, decltype(node_lock_)>) {
     node_lock_.unlock();
   }
+  if constexpr (measures_load) {
+    measured_load_ += sys::wall_time() - load_measurement_start;
+  }
 #ifdef SPECTRE_CHARM_PROJECTIONS
   traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
                         non_action_time_start_, sys::wall_time());
@@ -20,6 +20,7 @@
 #include "Parallel/CharmRegistration.hpp"
 #include "Parallel/CreateFromOptions.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/MeasuredLoad.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/PhaseControlReductionHelpers.hpp"
 #include "Parallel/Printf.hpp"
@@ -95,6 +96,15 @@ class Main : public CBase_Main<Metavariables> {
   /// used as the callback after a quiescence detection.
   void start_load_balance() noexcept;
 
+  /// Reduction target for the wall time that the elements of an array
+  /// component spent executing actions since the last load balancing, which
+  /// prints the load imbalance between processors.
+  ///
+  /// \details The load after balancing is the load that the new distribution
+  /// of elements would have had over the same interval.
+  void report_measured_load(
+      Parallel::detail::measured_load_reduction_data reduction_data) noexcept;
+
   /// Place the Charm++ call that starts writing a checkpoint
   ///
   /// \details This call is wrapped within an entry method so that it may be
@@ -655,6 +665,20 @@ void Main<Metavariables>::start_load_balance() noexcept {
   // ResumeFromSync instead.
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::report_measured_load(
+    Parallel::detail::measured_load_reduction_data reduction_data) noexcept {
+  const auto& [component_name, after_load_balancing, total_load, max_load] =
+      reduction_data.data();
+  const double mean_load =
+      total_load / static_cast<double>(sys::number_of_procs());
+  Parallel::printf(
+      "Load of %s per processor %s load balancing: mean %g s, max %g s, "
+      "imbalance (max / mean) %g\n",
+      component_name, after_load_balancing ? "after" : "before", mean_load,
+      max_load, mean_load > 0.0 ? max_load / mean_load : 1.0);
+}
+
 template <typename Metavariables>
 void Main<Metavariables>::start_write_checkpoint() noexcept {
   const std::string dir = checkpoint_dir();
@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/PrettyType.hpp"
+
+namespace Parallel {
+namespace detail {
+/// The reduction data of the wall time that the elements of an array component
+/// spent executing actions: the name of the component, whether the load was
+/// measured before or after load balancing, the total load, and the largest
+/// load on a processor.
+using measured_load_reduction_data =
+    ReductionData<ReductionDatum<std::string, funcl::AssertEqual<>>,
+                  ReductionDatum<bool, funcl::AssertEqual<>>,
+                  ReductionDatum<double, funcl::Plus<>>,
+                  ReductionDatum<double, funcl::Max<>>>;
+
+/*!
+ * \brief The contribution of an element of the `ParallelComponent` on the
+ * processor `proc` to the reduction of the measured load.
+ *
+ * \details The loads of the elements on each processor are summed locally, so
+ * each element contributes its own load to the total and the load that its
+ * processor has accumulated so far to the maximum. The accumulated load only
+ * grows, so the maximum is the largest load on any processor once all elements
+ * have contributed.
+ *
+ * All elements contribute with the same `report_number` to a reduction, which
+ * must change between reductions so the accumulated loads are reset.
+ */
+template <typename ParallelComponent>
+measured_load_reduction_data measured_load_contribution(
+    const double element_load, const size_t report_number, const int proc,
+    const bool after_load_balancing) noexcept {
+  struct ProcessorLoad {
+    size_t report_number{0};
+    double load{0.0};
+  };
+  // In a parallel run each processor is a separate thread, so this only holds
+  // the load of the processor running the thread. When processors are mocked
+  // in a single thread, it holds the load of each of them.
+  thread_local std::unordered_map<int, ProcessorLoad> processor_loads{};
+  auto& processor_load = processor_loads[proc];
+  if (processor_load.report_number != report_number) {
+    processor_load = ProcessorLoad{report_number, 0.0};
+  }
+  processor_load.load += element_load;
+  return measured_load_reduction_data{
+      pretty_type::short_name<ParallelComponent>(), after_load_balancing,
+      element_load, processor_load.load};
+}
+}  // namespace detail
+}  // namespace Parallel
@@ -31,6 +31,7 @@
 #include "Parallel/Printf.hpp"
 #include "Parallel/Reduction.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/GetOutput.hpp"
@@ -84,7 +85,8 @@ struct ResidualReductionFormatter
 template <typename OptionsGroup, typename ParallelComponent,
           typename Metavariables, typename ArrayIndex>
 void contribute_to_residual_observation(
-    const size_t iteration_id, const double residual_magnitude_square,
+    const size_t iteration_id, const size_t observation_id_offset,
+    const double residual_magnitude_square,
     Parallel::GlobalCache<Metavariables>& cache,
     const ArrayIndex& array_index) noexcept {
   auto& local_observer =
@@ -96,14 +98,18 @@ void contribute_to_residual_observation(
                ::Verbosity::Quiet)
           ? std::make_optional(ResidualReductionFormatter<OptionsGroup>{})
           : std::nullopt;
+  const std::string level_suffix =
+      observe_detail::multigrid_level_suffix(array_index);
   Parallel::simple_action<observers::Actions::ContributeReductionData>(
       local_observer,
-      observers::ObservationId(iteration_id,
-                               pretty_type::get_name<OptionsGroup>()),
+      observers::ObservationId(
+          observation_id_offset + iteration_id,
+          pretty_type::get_name<OptionsGroup>() + level_suffix),
       observers::ArrayComponentId{
           std::add_pointer_t<ParallelComponent>{nullptr},
           Parallel::ArrayIndex<ArrayIndex>(array_index)},
-      std::string{"/" + Options::name<OptionsGroup>() + "Residuals"},
+      std::string{"/" + Options::name<OptionsGroup>() + level_suffix +
+                  "Residuals"},
       std::vector<std::string>{"Iteration", "Residual"},
       reduction_data{iteration_id, residual_magnitude_square},
       std::move(formatter));
@@ -138,9 +144,11 @@ struct InitializeElement {
   using const_global_cache_tags =
       tmpl::list<Convergence::Tags::Iterations<OptionsGroup>>;
 
-  using simple_tags = tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
-                                 Convergence::Tags::HasConverged<OptionsGroup>,
-                                 operator_applied_to_fields_tag>;
+  using simple_tags =
+      tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
+                 Convergence::Tags::HasConverged<OptionsGroup>,
+                 LinearSolver::Tags::ObservationIdOffset<OptionsGroup>,
+                 operator_applied_to_fields_tag>;
   using compute_tags =
       tmpl::list<LinearSolver::Tags::ResidualCompute<fields_tag, source_tag>>;
 
@@ -157,8 +165,9 @@ struct InitializeElement {
     // values, except for `operator_applied_to_fields_tag` which is
     // expected to be updated in every iteration of the algorithm
     Initialization::mutate_assign<
-        tmpl::list<Convergence::Tags::IterationId<OptionsGroup>>>(
-        make_not_null(&box), std::numeric_limits<size_t>::max());
+        tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
+                   LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>>(
+        make_not_null(&box), std::numeric_limits<size_t>::max(), size_t{0});
     return std::make_tuple(std::move(box));
   }
 };
@@ -169,9 +178,11 @@ struct RegisterObservers {
             typename ArrayIndex>
   static std::pair<observers::TypeOfObservation, observers::ObservationKey>
   register_info(const db::DataBox<DbTagsList>& /*box*/,
-                const ArrayIndex& /*array_index*/) noexcept {
+                const ArrayIndex& array_index) noexcept {
     return {observers::TypeOfObservation::Reduction,
-            observers::ObservationKey{pretty_type::get_name<OptionsGroup>()}};
+            observers::ObservationKey{
+                pretty_type::get_name<OptionsGroup>() +
+                observe_detail::multigrid_level_suffix(array_index)}};
   }
 };
 
@@ -218,18 +229,26 @@ struct PrepareSolve {
     const auto& residual = get<residual_tag>(box);
     const double residual_magnitude_square = inner_product(residual, residual);
     contribute_to_residual_observation<OptionsGroup, ParallelComponent>(
-        iteration_id, residual_magnitude_square, cache, array_index);
+        iteration_id,
+        get<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(box),
+        residual_magnitude_square, cache, array_index);
 
-    // Skip steps entirely if the solve has already converged
+    // Skip steps entirely if the solve has already converged. Then the initial
+    // residual is the only observation of this solve.
     constexpr size_t step_end_index =
         tmpl::index_of<ActionList, CompleteStep<FieldsTag, OptionsGroup,
                                                 SourceTag, Label>>::value;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, PrepareSolve>::value;
-    return {std::move(box), false,
-            get<Convergence::Tags::HasConverged<OptionsGroup>>(box)
-                ? (step_end_index + 1)
-                : (this_action_index + 1)};
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+      db::mutate<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(
+          make_not_null(&box),
+          [](const gsl::not_null<size_t*> observation_id_offset) noexcept {
+            ++(*observation_id_offset);
+          });
+      return {std::move(box), false, step_end_index + 1};
+    }
+    return {std::move(box), false, this_action_index + 1};
   }
 };
 
@@ -273,7 +292,9 @@ struct CompleteStep {
     const auto& residual = get<residual_tag>(box);
     const double residual_magnitude_square = inner_product(residual, residual);
     contribute_to_residual_observation<OptionsGroup, ParallelComponent>(
-        completed_iterations, residual_magnitude_square, cache, array_index);
+        completed_iterations,
+        get<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(box),
+        residual_magnitude_square, cache, array_index);
 
     // Repeat steps until the solve has converged
     constexpr size_t step_begin_index =
@@ -282,10 +303,17 @@ struct CompleteStep {
         1;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, CompleteStep>::value;
-    return {std::move(box), false,
-            get<Convergence::Tags::HasConverged<OptionsGroup>>(box)
-                ? (this_action_index + 1)
-                : step_begin_index};
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+      // The next solve continues after the residuals observed in this one
+      db::mutate<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(
+          make_not_null(&box),
+          [&completed_iterations](
+              const gsl::not_null<size_t*> observation_id_offset) noexcept {
+            *observation_id_offset += completed_iterations + 1;
+          });
+      return {std::move(box), false, this_action_index + 1};
+    }
+    return {std::move(box), false, step_begin_index};
   }
 };
 
@@ -60,6 +60,9 @@ namespace LinearSolver::cg {
  * flag if the `Convergence::Tags::Criteria` are met.
  * 5. `UpdateOperand` (on elements): Update \f$p\f$.
  *
+ * \see PipelinedConjugateGradient for a variant of this algorithm with a single
+ * global synchronization point per iteration.
+ *
  * \see Gmres for a linear solver that can invert nonsymmetric operators
  * \f$A\f$.
  */
@@ -97,4 +100,92 @@ struct ConjugateGradient {
       detail::UpdateOperand<FieldsTag, OptionsGroup, Label>>;
 };
 
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief A pipelined conjugate gradient solver for linear systems of equations
+ * \f$Ax=b\f$ where the operator \f$A\f$ is symmetric.
+ *
+ * \details This variant of the `LinearSolver::cg::ConjugateGradient` algorithm
+ * reformulates the recurrences so that both inner products of an iteration are
+ * reduced together, and the reduction overlaps with the operator application
+ * of the next iteration \cite Ghysels2014. Therefore, each iteration has only
+ * one global synchronization point, and its latency is hidden behind the
+ * operator application. This is beneficial when the latency of global
+ * reductions dominates the cost of an iteration, i.e. on many cores. In
+ * exchange, the algorithm stores three additional vectors and performs one
+ * additional operator application overall. It is also somewhat less stable in
+ * finite precision, so the residual may stagnate at a larger value than in the
+ * standard algorithm.
+ *
+ * The algorithm keeps track of the residual \f$r\f$, the vector
+ * \f$w=A(r)\f$ and the search direction \f$p\f$, as well as the auxiliary
+ * vectors \f$s=A(p)\f$ and \f$z=A(s)\f$. As in the standard algorithm, the
+ * operator must be applied to the
+ * `db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>`, but this
+ * operand is \f$w\f$ here. The actions are implemented in the `cg::detail`
+ * namespace and constitute the full algorithm in the following order:
+ * 1. `PrepareSolve` (on elements): Set the operand to the initial residual
+ * \f$r_0 = b - A(x_0)\f$ and reduce its magnitude, as in the standard
+ * algorithm.
+ * 2. `InitializeResidual` (on `ResidualMonitor`): Check for convergence.
+ * 3. Apply the operator to the operand. In the first pass, this yields
+ * \f$w_0=A(r_0)\f$.
+ * 4. `PerformPipelinedStep` (on elements): In the first pass, start the
+ * pipeline by reducing the inner products \f$\langle r_0, r_0\rangle\f$ and
+ * \f$\langle w_0, r_0\rangle\f$ and return to step 3 to compute
+ * \f$q_0=A(w_0)\f$ while the reduction is in progress.
+ * 5. `UpdatePipelinedResidual` (on `ResidualMonitor`): Determine the step
+ * length \f$\alpha_k\f$ and the residual ratio \f$\beta_k\f$ from the inner
+ * products, as well as a termination flag if the
+ * `Convergence::Tags::Criteria` are met for \f$r_k\f$.
+ * 6. `UpdatePipelinedFields` (on elements): Update \f$p\f$, \f$s\f$, \f$z\f$,
+ * \f$x\f$, \f$r\f$ and \f$w\f$ with the recurrences that need only
+ * \f$q_k=A(w_k)\f$. Then reduce \f$\langle r_{k+1}, r_{k+1}\rangle\f$ and
+ * \f$\langle w_{k+1}, r_{k+1}\rangle\f$ together and return to step 3 to
+ * compute \f$q_{k+1}\f$ while the reduction is in progress.
+ *
+ * Since the first pass applies the operator before the first iteration, the
+ * `Convergence::Tags::IterationId` runs one ahead of the iteration during the
+ * solve. This allows the operator application to use it as a temporal ID. Once
+ * the solve has converged it is the number of completed iterations, as in the
+ * standard algorithm.
+ */
+template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag =
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+struct PipelinedConjugateGradient {
+  using fields_tag = FieldsTag;
+  using options_group = OptionsGroup;
+  using source_tag = SourceTag;
+
+  /// Apply the linear operator to this tag in each iteration
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+
+  /*!
+   * \brief The parallel components used by the pipelined conjugate gradient
+   * linear solver
+   */
+  using component_list = tmpl::list<
+      detail::ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>;
+
+  using initialize_element =
+      detail::InitializePipelinedElement<FieldsTag, OptionsGroup>;
+
+  using register_element = tmpl::list<>;
+
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<observe_detail::reduction_data>>;
+
+  template <typename ApplyOperatorActions, typename Label = OptionsGroup>
+  using solve = tmpl::list<
+      detail::PrepareSolve<FieldsTag, OptionsGroup, Label, SourceTag>,
+      detail::InitializeHasConverged<
+          FieldsTag, OptionsGroup, Label,
+          detail::UpdatePipelinedFields<FieldsTag, OptionsGroup, Label>>,
+      ApplyOperatorActions,
+      detail::PerformPipelinedStep<FieldsTag, OptionsGroup, Label>,
+      detail::UpdatePipelinedFields<FieldsTag, OptionsGroup, Label>>;
+};
+
 }  // namespace LinearSolver::cg
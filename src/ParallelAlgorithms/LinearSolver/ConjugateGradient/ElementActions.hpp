@@ -21,6 +21,7 @@
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
 #include "Utilities/Functional.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -37,6 +38,8 @@ template <typename Metavariables, typename FieldsTag, typename OptionsGroup>
 struct ResidualMonitor;
 template <typename FieldsTag, typename OptionsGroup, typename Label>
 struct UpdateOperand;
+template <typename FieldsTag, typename OptionsGroup, typename Label>
+struct UpdatePipelinedFields;
 }  // namespace LinearSolver::cg::detail
 /// \endcond
 
@@ -93,7 +96,11 @@ struct PrepareSolve {
   }
 };
 
-template <typename FieldsTag, typename OptionsGroup, typename Label>
+// The `StepEndAction` is the last action of an iteration. It is skipped along
+// with the iterations if the solve has already converged.
+template <typename FieldsTag, typename OptionsGroup, typename Label,
+          typename StepEndAction =
+              UpdateOperand<FieldsTag, OptionsGroup, Label>>
 struct InitializeHasConverged {
   using inbox_tags = tmpl::list<Tags::InitialHasConverged<OptionsGroup>>;
 
@@ -126,8 +133,7 @@ struct InitializeHasConverged {
 
     // Skip steps entirely if the solve has already converged
     constexpr size_t step_end_index =
-        tmpl::index_of<ActionList,
-                       UpdateOperand<FieldsTag, OptionsGroup, Label>>::value;
+        tmpl::index_of<ActionList, StepEndAction>::value;
     constexpr size_t this_action_index =
         tmpl::index_of<ActionList, InitializeHasConverged>::value;
     return {std::move(box), Parallel::AlgorithmExecution::Continue,
@@ -297,4 +303,225 @@ struct UpdateOperand {
   }
 };
 
+// Contribute both inner products of an iteration of the pipelined algorithm to
+// a single reduction
+template <typename FieldsTag, typename OptionsGroup, typename ParallelComponent,
+          typename DbTagsList, typename Metavariables, typename ArrayIndex>
+void contribute_pipelined_inner_products(
+    const db::DataBox<DbTagsList>& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const size_t iteration_id) noexcept {
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>;
+  const auto& residual = get<residual_tag>(box);
+  Parallel::contribute_to_reduction<
+      UpdatePipelinedResidual<FieldsTag, OptionsGroup, ParallelComponent>>(
+      Parallel::ReductionData<
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<double, funcl::Plus<>>,
+          Parallel::ReductionDatum<double, funcl::Plus<>>>{
+          iteration_id, inner_product(residual, residual),
+          inner_product(get<operand_tag>(box), residual)},
+      Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+      Parallel::get_parallel_component<
+          ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+}
+
+template <typename FieldsTag, typename OptionsGroup, typename Label>
+struct PerformPipelinedStep {
+ private:
+  using fields_tag = FieldsTag;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using operator_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+  using search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::SearchDirection, fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_applied_twice_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
+
+ public:
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, Parallel::AlgorithmExecution,
+                    size_t>
+  apply(db::DataBox<DbTagsList>& box,
+        const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+        Parallel::GlobalCache<Metavariables>& cache,
+        const ArrayIndex& array_index, const ActionList /*meta*/,
+        const ParallelComponent* const /*meta*/) noexcept {
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, PerformPipelinedStep>::value;
+    // In all but the first pass the operator was applied to w_k, which
+    // overlapped with the reduction of the iteration. Proceed to update the
+    // fields.
+    if (get<Convergence::Tags::IterationId<OptionsGroup>>(box) > 0) {
+      return {std::move(box), Parallel::AlgorithmExecution::Continue,
+              this_action_index + 1};
+    }
+
+    // In the first pass the operator was applied to the initial residual r_0,
+    // so we can start the pipeline with w_0 = A(r_0). The search direction
+    // and the operator applied to it start at zero.
+    db::mutate<operand_tag, search_direction_tag,
+               operator_applied_to_search_direction_tag,
+               operator_applied_twice_to_search_direction_tag,
+               Convergence::Tags::IterationId<OptionsGroup>>(
+        make_not_null(&box),
+        [](const auto operand, const auto search_direction,
+           const auto operator_applied_to_search_direction,
+           const auto operator_applied_twice_to_search_direction,
+           const gsl::not_null<size_t*> iteration_id,
+           const auto& operator_applied_to_residual) noexcept {
+          *operand = typename operand_tag::type(operator_applied_to_residual);
+          *search_direction =
+              make_with_value<typename search_direction_tag::type>(*operand,
+                                                                   0.);
+          *operator_applied_to_search_direction = make_with_value<
+              typename operator_applied_to_search_direction_tag::type>(
+              *operand, 0.);
+          *operator_applied_twice_to_search_direction = make_with_value<
+              typename operator_applied_twice_to_search_direction_tag::type>(
+              *operand, 0.);
+          *iteration_id = 1;
+        },
+        get<operator_tag>(box));
+
+    contribute_pipelined_inner_products<FieldsTag, OptionsGroup,
+                                        ParallelComponent>(box, cache,
+                                                           array_index, 0);
+
+    // Apply the operator to w_0 while the reduction is in progress
+    constexpr size_t apply_operator_index =
+        tmpl::index_of<
+            ActionList,
+            InitializeHasConverged<
+                FieldsTag, OptionsGroup, Label,
+                UpdatePipelinedFields<FieldsTag, OptionsGroup, Label>>>::value +
+        1;
+    return {std::move(box), Parallel::AlgorithmExecution::Continue,
+            apply_operator_index};
+  }
+};
+
+template <typename FieldsTag, typename OptionsGroup, typename Label>
+struct UpdatePipelinedFields {
+ private:
+  using fields_tag = FieldsTag;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using operator_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::SearchDirection, fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_applied_twice_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
+
+ public:
+  using inbox_tags =
+      tmpl::list<Tags::AlphaResidualRatioAndHasConverged<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, Parallel::AlgorithmExecution,
+                    size_t>
+  apply(db::DataBox<DbTagsList>& box,
+        tuples::TaggedTuple<InboxTags...>& inboxes,
+        Parallel::GlobalCache<Metavariables>& cache,
+        const ArrayIndex& array_index, const ActionList /*meta*/,
+        const ParallelComponent* const /*meta*/) noexcept {
+    // The operator application that was just completed is one ahead of the
+    // iteration because the first pass computed w_0
+    auto& inbox =
+        get<Tags::AlphaResidualRatioAndHasConverged<OptionsGroup>>(inboxes);
+    const size_t iteration_id =
+        db::get<Convergence::Tags::IterationId<OptionsGroup>>(box) - 1;
+    if (inbox.find(iteration_id) == inbox.end()) {
+      return {std::move(box), Parallel::AlgorithmExecution::Retry,
+              std::numeric_limits<size_t>::max()};
+    }
+
+    auto received_data = std::move(inbox.extract(iteration_id).mapped());
+    const double alpha = get<0>(received_data);
+    const double res_ratio = get<1>(received_data);
+    auto& has_converged = get<2>(received_data);
+
+    // Terminate once the residual r_k has converged. It is the residual of the
+    // current fields, so we skip the update.
+    if (has_converged) {
+      db::mutate<Convergence::Tags::IterationId<OptionsGroup>,
+                 Convergence::Tags::HasConverged<OptionsGroup>>(
+          make_not_null(&box),
+          [iteration_id, &has_converged](
+              const gsl::not_null<size_t*> local_iteration_id,
+              const gsl::not_null<Convergence::HasConverged*>
+                  local_has_converged) noexcept {
+            *local_iteration_id = iteration_id;
+            *local_has_converged = std::move(has_converged);
+          });
+      constexpr size_t this_action_index =
+          tmpl::index_of<ActionList, UpdatePipelinedFields>::value;
+      return {std::move(box), Parallel::AlgorithmExecution::Continue,
+              this_action_index + 1};
+    }
+
+    db::mutate<fields_tag, residual_tag, operand_tag, search_direction_tag,
+               operator_applied_to_search_direction_tag,
+               operator_applied_twice_to_search_direction_tag,
+               Convergence::Tags::IterationId<OptionsGroup>,
+               Convergence::Tags::HasConverged<OptionsGroup>>(
+        make_not_null(&box),
+        [alpha, res_ratio, iteration_id, &has_converged](
+            const auto fields, const auto residual, const auto operand,
+            const auto search_direction,
+            const auto operator_applied_to_search_direction,
+            const auto operator_applied_twice_to_search_direction,
+            const gsl::not_null<size_t*> local_iteration_id,
+            const gsl::not_null<Convergence::HasConverged*> local_has_converged,
+            const auto& operator_applied_to_operand) noexcept {
+          // Update the recurrences. Only the operator applied to the operand is
+          // computed explicitly, all other quantities are linear combinations.
+          *operator_applied_twice_to_search_direction =
+              operator_applied_to_operand +
+              res_ratio * *operator_applied_twice_to_search_direction;
+          *operator_applied_to_search_direction =
+              *operand + res_ratio * *operator_applied_to_search_direction;
+          *search_direction = *residual + res_ratio * *search_direction;
+          *fields += alpha * *search_direction;
+          *residual -= alpha * *operator_applied_to_search_direction;
+          *operand -= alpha * *operator_applied_twice_to_search_direction;
+          *local_iteration_id = iteration_id + 2;
+          *local_has_converged = std::move(has_converged);
+        },
+        get<operator_tag>(box));
+
+    contribute_pipelined_inner_products<FieldsTag, OptionsGroup,
+                                        ParallelComponent>(
+        box, cache, array_index, iteration_id + 1);
+
+    // Apply the operator to the new w_k while the reduction is in progress
+    constexpr size_t apply_operator_index =
+        tmpl::index_of<ActionList,
+                       InitializeHasConverged<FieldsTag, OptionsGroup, Label,
+                                              UpdatePipelinedFields>>::value +
+        1;
+    return {std::move(box), Parallel::AlgorithmExecution::Continue,
+            apply_operator_index};
+  }
+};
+
 }  // namespace LinearSolver::cg::detail
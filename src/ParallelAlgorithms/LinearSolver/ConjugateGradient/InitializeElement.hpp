@@ -70,4 +70,55 @@ struct InitializeElement {
   }
 };
 
+template <typename FieldsTag, typename OptionsGroup>
+struct InitializePipelinedElement {
+ private:
+  using fields_tag = FieldsTag;
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, fields_tag>;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using operator_applied_to_operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, operand_tag>;
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>;
+  using search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::SearchDirection, fields_tag>;
+  using operator_applied_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         search_direction_tag>;
+  using operator_applied_twice_to_search_direction_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo,
+                         operator_applied_to_search_direction_tag>;
+
+ public:
+  using simple_tags =
+      tmpl::list<Convergence::Tags::IterationId<OptionsGroup>,
+                 operator_applied_to_fields_tag, operand_tag,
+                 operator_applied_to_operand_tag, residual_tag,
+                 search_direction_tag, operator_applied_to_search_direction_tag,
+                 operator_applied_twice_to_search_direction_tag,
+                 Convergence::Tags::HasConverged<OptionsGroup>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    // The `PrepareSolve` and `PerformPipelinedStep` actions populate these tags
+    // with initial values, except for `operator_applied_to_fields_tag` which is
+    // expected to be filled at that point and `operator_applied_to_operand_tag`
+    // which is expected to be updated in every iteration of the algorithm.
+    Initialization::mutate_assign<
+        tmpl::list<Convergence::Tags::IterationId<OptionsGroup>>>(
+        make_not_null(&box), std::numeric_limits<size_t>::max());
+    return std::make_tuple(std::move(box));
+  }
+};
+
 }  // namespace LinearSolver::cg::detail
@@ -78,10 +78,13 @@ struct InitializeResidualMonitor {
   using initial_residual_magnitude_tag =
       ::Tags::Initial<LinearSolver::Tags::Magnitude<
           db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  // Only used by the `LinearSolver::cg::PipelinedConjugateGradient`
+  using step_length_tag = LinearSolver::Tags::StepLength<fields_tag>;
 
  public:
-  using simple_tags =
-      tmpl::list<residual_square_tag, initial_residual_magnitude_tag>;
+  using simple_tags = tmpl::list<residual_square_tag,
+                                 initial_residual_magnitude_tag,
+                                 step_length_tag>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -92,9 +95,11 @@ struct InitializeResidualMonitor {
                     const ArrayIndex& /*array_index*/,
                     const ActionList /*meta*/,
                     const ParallelComponent* const /*meta*/) noexcept {
-    // The `InitializeResidual` action populates these tags with initial values
+    // The `InitializeResidual` and `UpdatePipelinedResidual` actions populate
+    // these tags with initial values
     Initialization::mutate_assign<simple_tags>(
         make_not_null(&box), std::numeric_limits<double>::signaling_NaN(),
+        std::numeric_limits<double>::signaling_NaN(),
         std::numeric_limits<double>::signaling_NaN());
     return std::make_tuple(std::move(box), true);
   }
@@ -188,4 +188,103 @@ struct UpdateResidual {
   }
 };
 
+// Receives both inner products of an iteration of the pipelined algorithm in a
+// single reduction. The residual \f$r_k\f$ is that of the fields after \f$k\f$
+// iterations, so this action also completes iteration \f$k\f$ when
+// \f$k>0\f$. See `LinearSolver::cg::PipelinedConjugateGradient` for details.
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct UpdatePipelinedResidual {
+ private:
+  using fields_tag = FieldsTag;
+  using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
+      db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>;
+  using initial_residual_magnitude_tag =
+      ::Tags::Initial<LinearSolver::Tags::Magnitude<
+          db::add_tag_prefix<LinearSolver::Tags::Residual, fields_tag>>>;
+  using step_length_tag = LinearSolver::Tags::StepLength<fields_tag>;
+
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>,
+            Requires<db::tag_is_retrievable_v<step_length_tag, DataBox>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const size_t iteration_id, const double residual_square,
+                    const double operand_residual_inner_product) noexcept {
+    // The `InitializeResidual` action has already stored the initial residual
+    // and checked it for convergence
+    const double res_ratio =
+        iteration_id == 0 ? 0.
+                          : residual_square / get<residual_square_tag>(box);
+    Convergence::HasConverged has_converged{};
+
+    if (iteration_id > 0) {
+      db::mutate<residual_square_tag>(
+          make_not_null(&box),
+          [residual_square](
+              const gsl::not_null<double*> local_residual_square) noexcept {
+            *local_residual_square = residual_square;
+          });
+
+      // At this point, `iteration_id` iterations are complete. We proceed with
+      // observing, logging and checking convergence before broadcasting back
+      // to the elements.
+
+      const size_t completed_iterations = iteration_id;
+      const double residual_magnitude = sqrt(residual_square);
+      LinearSolver::observe_detail::contribute_to_reduction_observer<
+          OptionsGroup, ParallelComponent>(completed_iterations,
+                                           residual_magnitude, cache);
+
+      // Determine whether the linear solver has converged
+      has_converged = Convergence::HasConverged{
+          get<Convergence::Tags::Criteria<OptionsGroup>>(box),
+          completed_iterations, residual_magnitude,
+          get<initial_residual_magnitude_tag>(box)};
+
+      // Do some logging
+      if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                   ::Verbosity::Quiet)) {
+        Parallel::printf(
+            "%s(%zu) iteration complete. Remaining residual: %e\n",
+            Options::name<OptionsGroup>(), completed_iterations,
+            residual_magnitude);
+      }
+      if (UNLIKELY(has_converged and
+                   get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+                       ::Verbosity::Quiet)) {
+        Parallel::printf(
+            "%s has converged in %zu iterations: %s\n",
+            Options::name<OptionsGroup>(), completed_iterations, has_converged);
+      }
+    }
+
+    // Compute the step length from the recurrence
+    // <p_k, A p_k> = <w_k, r_k> - beta_k^2 <p_(k-1), A p_(k-1)>. Skip it once
+    // the solve has converged because the denominator may vanish.
+    double alpha = 0.;
+    if (not has_converged) {
+      alpha = residual_square /
+              (iteration_id == 0
+                   ? operand_residual_inner_product
+                   : (operand_residual_inner_product -
+                      res_ratio * residual_square / get<step_length_tag>(box)));
+      db::mutate<step_length_tag>(
+          make_not_null(&box),
+          [alpha](const gsl::not_null<double*> step_length) noexcept {
+            *step_length = alpha;
+          });
+    }
+
+    Parallel::receive_data<
+        Tags::AlphaResidualRatioAndHasConverged<OptionsGroup>>(
+        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+        // NOLINTNEXTLINE(performance-move-const-arg)
+        std::make_tuple(alpha, res_ratio, std::move(has_converged)));
+  }
+};
+
 }  // namespace LinearSolver::cg::detail
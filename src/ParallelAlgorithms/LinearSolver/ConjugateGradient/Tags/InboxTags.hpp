@@ -35,4 +35,13 @@ struct ResidualRatioAndHasConverged
       std::map<temporal_id, std::tuple<double, Convergence::HasConverged>>;
 };
 
+template <typename OptionsGroup>
+struct AlphaResidualRatioAndHasConverged
+    : Parallel::InboxInserters::Value<
+          AlphaResidualRatioAndHasConverged<OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id,
+                        std::tuple<double, double, Convergence::HasConverged>>;
+};
+
 }  // namespace LinearSolver::cg::detail::Tags
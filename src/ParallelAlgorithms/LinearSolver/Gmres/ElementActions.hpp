@@ -8,6 +8,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -18,6 +19,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/OrthogonalizationMethod.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitorActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
@@ -220,8 +222,45 @@ struct PrepareStep {
   }
 };
 
+// Contribute the inner products of the operand with all basis vectors to a
+// single reduction. Used by the
+// `OrthogonalizationMethod::ClassicalGramSchmidtTwice`.
+template <typename FieldsTag, typename OptionsGroup, typename ParallelComponent,
+          typename DbTagsList, typename Metavariables, typename ArrayIndex>
+void contribute_orthogonalizations(
+    const db::DataBox<DbTagsList>& box,
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const size_t orthogonalization_pass) noexcept {
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, FieldsTag>;
+  using basis_history_tag =
+      LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+  const auto& operand = get<operand_tag>(box);
+  const auto& basis_history = get<basis_history_tag>(box);
+  std::vector<double> local_orthogonalizations(basis_history.size());
+  for (size_t j = 0; j < basis_history.size(); ++j) {
+    local_orthogonalizations[j] = inner_product(basis_history[j], operand);
+  }
+  // The magnitude of the operand is only needed in the second pass
+  const double local_operand_magnitude_square =
+      orthogonalization_pass == 0 ? 0. : inner_product(operand, operand);
+  Parallel::contribute_to_reduction<
+      StoreOrthogonalizations<FieldsTag, OptionsGroup, ParallelComponent>>(
+      Parallel::ReductionData<
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+          Parallel::ReductionDatum<std::vector<double>, funcl::VectorPlus>,
+          Parallel::ReductionDatum<double, funcl::Plus<>>>{
+          get<Convergence::Tags::IterationId<OptionsGroup>>(box),
+          orthogonalization_pass, std::move(local_orthogonalizations),
+          local_operand_magnitude_square},
+      Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
+      Parallel::get_parallel_component<
+          ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+}
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
-          typename Label>
+          typename Label, OrthogonalizationMethod Method>
 struct PerformStep {
  private:
   using fields_tag = FieldsTag;
@@ -273,19 +312,25 @@ struct PerformStep {
         },
         get<operator_tag>(box));
 
-    Parallel::contribute_to_reduction<
-        StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
-        Parallel::ReductionData<
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
-            Parallel::ReductionDatum<double, funcl::Plus<>>>{
-            get<Convergence::Tags::IterationId<OptionsGroup>>(box),
-            get<orthogonalization_iteration_id_tag>(box),
-            inner_product(get<basis_history_tag>(box)[0],
-                          get<operand_tag>(box))},
-        Parallel::get_parallel_component<ParallelComponent>(cache)[array_index],
-        Parallel::get_parallel_component<
-            ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+    if constexpr (Method == OrthogonalizationMethod::ModifiedGramSchmidt) {
+      Parallel::contribute_to_reduction<
+          StoreOrthogonalization<FieldsTag, OptionsGroup, ParallelComponent>>(
+          Parallel::ReductionData<
+              Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+              Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
+              Parallel::ReductionDatum<double, funcl::Plus<>>>{
+              get<Convergence::Tags::IterationId<OptionsGroup>>(box),
+              get<orthogonalization_iteration_id_tag>(box),
+              inner_product(get<basis_history_tag>(box)[0],
+                            get<operand_tag>(box))},
+          Parallel::get_parallel_component<ParallelComponent>(
+              cache)[array_index],
+          Parallel::get_parallel_component<
+              ResidualMonitor<Metavariables, FieldsTag, OptionsGroup>>(cache));
+    } else {
+      contribute_orthogonalizations<FieldsTag, OptionsGroup, ParallelComponent>(
+          box, cache, array_index, 0);
+    }
 
     return {std::move(box)};
   }
@@ -375,6 +420,75 @@ struct OrthogonalizeOperand {
   }
 };
 
+// Replaces `OrthogonalizeOperand` for the
+// `OrthogonalizationMethod::ClassicalGramSchmidtTwice`. Subtracts the
+// projections on all basis vectors at once, then repeats once to
+// re-orthogonalize.
+template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
+          typename Label>
+struct OrthogonalizeOperandTwice {
+ private:
+  using fields_tag = FieldsTag;
+  using operand_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Operand, fields_tag>;
+  using orthogonalization_pass_tag = LinearSolver::Tags::Orthogonalization<
+      Convergence::Tags::IterationId<OptionsGroup>>;
+  using basis_history_tag =
+      LinearSolver::Tags::KrylovSubspaceBasis<operand_tag>;
+
+ public:
+  using inbox_tags = tmpl::list<Tags::Orthogonalizations<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, Parallel::AlgorithmExecution,
+                    size_t>
+  apply(db::DataBox<DbTagsList>& box,
+        tuples::TaggedTuple<InboxTags...>& inboxes,
+        Parallel::GlobalCache<Metavariables>& cache,
+        const ArrayIndex& array_index, const ActionList /*meta*/,
+        const ParallelComponent* const /*meta*/) noexcept {
+    auto& inbox = get<Tags::Orthogonalizations<OptionsGroup>>(inboxes);
+    if (inbox.find(db::get<Convergence::Tags::IterationId<OptionsGroup>>(
+            box)) == inbox.end()) {
+      return {std::move(box), Parallel::AlgorithmExecution::Retry,
+              std::numeric_limits<size_t>::max()};
+    }
+
+    const auto orthogonalizations = std::move(
+        inbox
+            .extract(db::get<Convergence::Tags::IterationId<OptionsGroup>>(box))
+            .mapped());
+
+    db::mutate<operand_tag, orthogonalization_pass_tag>(
+        make_not_null(&box),
+        [&orthogonalizations](
+            const auto operand,
+            const gsl::not_null<size_t*> orthogonalization_pass,
+            const auto& basis_history) noexcept {
+          for (size_t j = 0; j < orthogonalizations.size(); ++j) {
+            *operand -= orthogonalizations[j] * gsl::at(basis_history, j);
+          }
+          ++(*orthogonalization_pass);
+        },
+        get<basis_history_tag>(box));
+
+    // Start the second pass, or proceed once it is complete
+    const bool orthogonalization_complete =
+        get<orthogonalization_pass_tag>(box) == 2;
+    if (not orthogonalization_complete) {
+      contribute_orthogonalizations<FieldsTag, OptionsGroup, ParallelComponent>(
+          box, cache, array_index, get<orthogonalization_pass_tag>(box));
+    }
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, OrthogonalizeOperandTwice>::value;
+    return {std::move(box), Parallel::AlgorithmExecution::Continue,
+            orthogonalization_complete ? (this_action_index + 1)
+                                       : this_action_index};
+  }
+};
+
 template <typename FieldsTag, typename OptionsGroup, bool Preconditioned,
           typename Label>
 struct NormalizeOperandAndUpdateField {
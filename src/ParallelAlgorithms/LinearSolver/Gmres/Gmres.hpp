@@ -8,6 +8,7 @@
 #include "IO/Observer/Helpers.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ElementActions.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/InitializeElement.hpp"
+#include "ParallelAlgorithms/LinearSolver/Gmres/OrthogonalizationMethod.hpp"
 #include "ParallelAlgorithms/LinearSolver/Gmres/ResidualMonitor.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
@@ -79,18 +80,32 @@ namespace LinearSolver::gmres {
  * the new orthogonal vector and normalize. Use the residual vector and the set
  * of orthogonal vectors to determine the solution \f$x\f$.
  *
+ * The steps above use the `OrthogonalizationMethod::ModifiedGramSchmidt`,
+ * which is the default. To reduce the number of global synchronization points
+ * per iteration from \f$k+2\f$ to two, select the
+ * `OrthogonalizationMethod::ClassicalGramSchmidtTwice` with the `Method`
+ * template parameter. Then `PerformStep` computes the inner products with all
+ * orthogonal vectors at once and reduces them together to
+ * `StoreOrthogonalizations`, and `OrthogonalizeOperandTwice` replaces
+ * `OrthogonalizeOperand` to subtract all projections at once. It repeats this
+ * procedure a second time to restore orthogonality, reducing the magnitude of
+ * the new orthogonal vector along with the second set of inner products.
+ *
  * \see ConjugateGradient for a linear solver that is more efficient when the
  * linear operator \f$A\f$ is symmetric.
  */
 template <typename Metavariables, typename FieldsTag, typename OptionsGroup,
           bool Preconditioned,
           typename SourceTag =
-              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>,
+          OrthogonalizationMethod Method =
+              OrthogonalizationMethod::ModifiedGramSchmidt>
 struct Gmres {
   using fields_tag = FieldsTag;
   using options_group = OptionsGroup;
   using source_tag = SourceTag;
   static constexpr bool preconditioned = Preconditioned;
+  static constexpr OrthogonalizationMethod orthogonalization_method = Method;
 
   /// Apply the linear operator to this tag in each iteration
   using operand_tag = std::conditional_t<
@@ -127,9 +142,14 @@ struct Gmres {
                                       Label>,
       detail::PrepareStep<FieldsTag, OptionsGroup, Preconditioned, Label>,
       ApplyOperatorActions,
-      detail::PerformStep<FieldsTag, OptionsGroup, Preconditioned, Label>,
-      detail::OrthogonalizeOperand<FieldsTag, OptionsGroup, Preconditioned,
-                                   Label>,
+      detail::PerformStep<FieldsTag, OptionsGroup, Preconditioned, Label,
+                          Method>,
+      tmpl::conditional_t<
+          Method == OrthogonalizationMethod::ModifiedGramSchmidt,
+          detail::OrthogonalizeOperand<FieldsTag, OptionsGroup, Preconditioned,
+                                       Label>,
+          detail::OrthogonalizeOperandTwice<FieldsTag, OptionsGroup,
+                                            Preconditioned, Label>>,
       detail::NormalizeOperandAndUpdateField<FieldsTag, OptionsGroup,
                                              Preconditioned, Label>>;
 };
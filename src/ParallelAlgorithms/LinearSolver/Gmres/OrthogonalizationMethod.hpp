@@ -0,0 +1,30 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+namespace LinearSolver::gmres {
+
+/*!
+ * \brief The Gram-Schmidt procedure that constructs each new Krylov-subspace
+ * basis vector in the `LinearSolver::gmres::Gmres` algorithm
+ *
+ * - `ModifiedGramSchmidt`: Orthogonalize against one basis vector at a time.
+ *   This is numerically robust but needs one global reduction per basis vector,
+ *   so iteration \f$k\f$ waits on \f$k+2\f$ sequential reductions.
+ * - `ClassicalGramSchmidtTwice`: Orthogonalize against all basis vectors at
+ *   once and repeat the procedure a second time to recover the numerical
+ *   orthogonality of the modified procedure (CGS2, see e.g. \cite Giraud2005).
+ *   The inner products with all basis vectors are reduced together, and the
+ *   magnitude of the new basis vector is reduced along with the second pass,
+ *   so every iteration waits on only two reductions. Prefer this method when
+ *   the latency of global reductions dominates the cost of an iteration, i.e.
+ *   on many cores. It computes twice as many inner products as the modified
+ *   procedure.
+ */
+enum class OrthogonalizationMethod {
+  ModifiedGramSchmidt,
+  ClassicalGramSchmidtTwice
+};
+
+}  // namespace LinearSolver::gmres
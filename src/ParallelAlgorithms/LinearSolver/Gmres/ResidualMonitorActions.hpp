@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
@@ -20,7 +23,9 @@
 #include "ParallelAlgorithms/LinearSolver/Gmres/Tags/InboxTags.hpp"
 #include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 
@@ -90,9 +95,15 @@ struct InitializeResidualMagnitude {
   }
 };
 
-template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
-struct StoreOrthogonalization {
- private:
+// Store the magnitude of the new basis vector in the Hessenberg matrix, solve
+// the least-squares problem for the residual, observe and check convergence,
+// then broadcast the result to the elements to complete the iteration
+template <typename FieldsTag, typename OptionsGroup, typename ParallelComponent,
+          typename BroadcastTarget, typename DbTagsList, typename Metavariables>
+void complete_iteration(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                        Parallel::GlobalCache<Metavariables>& cache,
+                        const size_t iteration_id,
+                        const double normalization) noexcept {
   using fields_tag = FieldsTag;
   using initial_residual_magnitude_tag =
       ::Tags::Initial<LinearSolver::Tags::Magnitude<
@@ -100,6 +111,70 @@ struct StoreOrthogonalization {
   using orthogonalization_history_tag =
       LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
 
+  db::mutate<orthogonalization_history_tag>(
+      box, [normalization, iteration_id](
+               const auto orthogonalization_history) noexcept {
+        (*orthogonalization_history)(iteration_id + 1, iteration_id) =
+            normalization;
+      });
+
+  // Perform a QR decomposition of the Hessenberg matrix that was built during
+  // the orthogonalization
+  const auto& orthogonalization_history =
+      get<orthogonalization_history_tag>(*box);
+  const auto num_rows = iteration_id + 2;
+  DenseMatrix<double> qr_Q;
+  DenseMatrix<double> qr_R;
+  blaze::qr(orthogonalization_history, qr_Q, qr_R);
+  // Compute the residual vector from the QR decomposition
+  DenseVector<double> beta(num_rows, 0.);
+  beta[0] = get<initial_residual_magnitude_tag>(*box);
+  DenseVector<double> minres = blaze::inv(qr_R) * blaze::trans(qr_Q) * beta;
+  const double residual_magnitude =
+      blaze::length(beta - orthogonalization_history * minres);
+
+  // At this point, the iteration is complete. We proceed with observing,
+  // logging and checking convergence before broadcasting back to the elements.
+
+  const size_t completed_iterations = iteration_id + 1;
+  LinearSolver::observe_detail::contribute_to_reduction_observer<
+      OptionsGroup, ParallelComponent>(completed_iterations, residual_magnitude,
+                                       cache);
+
+  // Determine whether the linear solver has converged
+  Convergence::HasConverged has_converged{
+      get<Convergence::Tags::Criteria<OptionsGroup>>(*box),
+      completed_iterations, residual_magnitude,
+      get<initial_residual_magnitude_tag>(*box)};
+
+  // Do some logging
+  if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
+               ::Verbosity::Quiet)) {
+    Parallel::printf("%s(%zu) iteration complete. Remaining residual: %e\n",
+                     Options::name<OptionsGroup>(), completed_iterations,
+                     residual_magnitude);
+  }
+  if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
+                                     cache) >= ::Verbosity::Quiet)) {
+    Parallel::printf("%s has converged in %zu iterations: %s\n",
+                     Options::name<OptionsGroup>(), completed_iterations,
+                     has_converged);
+  }
+
+  Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
+      Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+      std::make_tuple(normalization, std::move(minres),
+                      // NOLINTNEXTLINE(performance-move-const-arg)
+                      std::move(has_converged)));
+}
+
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct StoreOrthogonalization {
+ private:
+  using fields_tag = FieldsTag;
+  using orthogonalization_history_tag =
+      LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+
  public:
   template <typename ParallelComponent, typename DbTagsList,
             typename Metavariables, typename ArrayIndex,
@@ -146,63 +221,88 @@ struct StoreOrthogonalization {
     }
 
     // At this point, the orthogonalization procedure is complete.
+    complete_iteration<FieldsTag, OptionsGroup, ParallelComponent,
+                       BroadcastTarget>(make_not_null(&box), cache,
+                                        iteration_id, sqrt(orthogonalization));
+  }
+};
+
+// Receives the inner products of the operand with all basis vectors at once,
+// for the `OrthogonalizationMethod::ClassicalGramSchmidtTwice`. The first pass
+// (`orthogonalization_pass == 0`) appends a column to the Hessenberg matrix,
+// and the second pass adds the re-orthogonalization corrections to it. The
+// second pass also receives the magnitude of the operand before its
+// re-orthogonalization, from which we compute the magnitude of the new basis
+// vector. Since the first pass already made the operand orthogonal up to
+// round-off, the correction is tiny and the Pythagorean theorem holds.
+template <typename FieldsTag, typename OptionsGroup, typename BroadcastTarget>
+struct StoreOrthogonalizations {
+ private:
+  using fields_tag = FieldsTag;
+  using orthogonalization_history_tag =
+      LinearSolver::Tags::OrthogonalizationHistory<fields_tag>;
+
+ public:
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DataBox = db::DataBox<DbTagsList>,
+            Requires<db::tag_is_retrievable_v<orthogonalization_history_tag,
+                                              DataBox>> = nullptr>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const size_t iteration_id,
+                    const size_t orthogonalization_pass,
+                    const std::vector<double>& orthogonalizations,
+                    const double operand_magnitude_square) noexcept {
+    ASSERT(orthogonalizations.size() == iteration_id + 1,
+           "Expected " << iteration_id + 1
+                       << " orthogonalizations, one for each basis vector, "
+                          "but received "
+                       << orthogonalizations.size() << ".");
     db::mutate<orthogonalization_history_tag>(
         make_not_null(&box),
-        [orthogonalization, iteration_id, orthogonalization_iteration_id](
+        [&orthogonalizations, iteration_id, orthogonalization_pass](
             const auto orthogonalization_history) noexcept {
-          (*orthogonalization_history)(orthogonalization_iteration_id,
-                                       iteration_id) = sqrt(orthogonalization);
+          if (orthogonalization_pass == 0) {
+            // Append a row and a column to the orthogonalization history. Zero
+            // the entries that won't be set below.
+            orthogonalization_history->resize(iteration_id + 2,
+                                              iteration_id + 1);
+            for (size_t j = 0; j < iteration_id; ++j) {
+              (*orthogonalization_history)(iteration_id + 1, j) = 0.;
+            }
+            for (size_t j = 0; j <= iteration_id; ++j) {
+              (*orthogonalization_history)(j, iteration_id) =
+                  orthogonalizations[j];
+            }
+          } else {
+            for (size_t j = 0; j <= iteration_id; ++j) {
+              (*orthogonalization_history)(j, iteration_id) +=
+                  orthogonalizations[j];
+            }
+          }
         });
 
-    // Perform a QR decomposition of the Hessenberg matrix that was built during
-    // the orthogonalization
-    const auto& orthogonalization_history =
-        get<orthogonalization_history_tag>(box);
-    const auto num_rows = orthogonalization_iteration_id + 1;
-    DenseMatrix<double> qr_Q;
-    DenseMatrix<double> qr_R;
-    blaze::qr(orthogonalization_history, qr_Q, qr_R);
-    // Compute the residual vector from the QR decomposition
-    DenseVector<double> beta(num_rows, 0.);
-    beta[0] = get<initial_residual_magnitude_tag>(box);
-    DenseVector<double> minres = blaze::inv(qr_R) * blaze::trans(qr_Q) * beta;
-    const double residual_magnitude =
-        blaze::length(beta - orthogonalization_history * minres);
-
-    // At this point, the iteration is complete. We proceed with observing,
-    // logging and checking convergence before broadcasting back to the
-    // elements.
-
-    const size_t completed_iterations = iteration_id + 1;
-    LinearSolver::observe_detail::contribute_to_reduction_observer<
-        OptionsGroup, ParallelComponent>(completed_iterations,
-                                         residual_magnitude, cache);
-
-    // Determine whether the linear solver has converged
-    Convergence::HasConverged has_converged{
-        get<Convergence::Tags::Criteria<OptionsGroup>>(box),
-        completed_iterations, residual_magnitude,
-        get<initial_residual_magnitude_tag>(box)};
-
-    // Do some logging
-    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(cache) >=
-                 ::Verbosity::Quiet)) {
-      Parallel::printf("%s(%zu) iteration complete. Remaining residual: %e\n",
-                       Options::name<OptionsGroup>(), completed_iterations,
-                       residual_magnitude);
-    }
-    if (UNLIKELY(has_converged and get<logging::Tags::Verbosity<OptionsGroup>>(
-                                       cache) >= ::Verbosity::Quiet)) {
-      Parallel::printf("%s has converged in %zu iterations: %s\n",
-                       Options::name<OptionsGroup>(), completed_iterations,
-                       has_converged);
+    Parallel::receive_data<Tags::Orthogonalizations<OptionsGroup>>(
+        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
+        orthogonalizations);
+    if (orthogonalization_pass == 0) {
+      return;
     }
 
-    Parallel::receive_data<Tags::FinalOrthogonalization<OptionsGroup>>(
-        Parallel::get_parallel_component<BroadcastTarget>(cache), iteration_id,
-        std::make_tuple(sqrt(orthogonalization), std::move(minres),
-                        // NOLINTNEXTLINE(performance-move-const-arg)
-                        std::move(has_converged)));
+    // At this point, the orthogonalization procedure is complete. Clip the
+    // magnitude at zero because round-off can make it slightly negative when
+    // the operand lies in the Krylov subspace, i.e. when the solve is done.
+    double correction_magnitude_square = 0.;
+    for (const double orthogonalization : orthogonalizations) {
+      correction_magnitude_square += square(orthogonalization);
+    }
+    complete_iteration<FieldsTag, OptionsGroup, ParallelComponent,
+                       BroadcastTarget>(
+        make_not_null(&box), cache, iteration_id,
+        sqrt(std::max(operand_magnitude_square - correction_magnitude_square,
+                      0.)));
   }
 };
 
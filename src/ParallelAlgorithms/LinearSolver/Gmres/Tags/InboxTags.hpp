@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <map>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DenseVector.hpp"
 #include "NumericalAlgorithms/Convergence/HasConverged.hpp"
@@ -29,6 +30,13 @@ struct Orthogonalization
   using type = std::map<temporal_id, double>;
 };
 
+template <typename OptionsGroup>
+struct Orthogonalizations
+    : Parallel::InboxInserters::Value<Orthogonalizations<OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, std::vector<double>>;
+};
+
 template <typename OptionsGroup>
 struct FinalOrthogonalization
     : Parallel::InboxInserters::Value<FinalOrthogonalization<OptionsGroup>> {
@@ -0,0 +1,471 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Convergence/HasConverged.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "NumericalAlgorithms/LinearSolver/InnerProduct.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Printf.hpp"
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace tuples {
+template <typename...>
+class TaggedTuple;
+}  // namespace tuples
+namespace LinearSolver::multigrid::detail {
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct CompleteStep;
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct SendCorrectionToFinerGrid;
+}  // namespace LinearSolver::multigrid::detail
+/// \endcond
+
+namespace LinearSolver::multigrid::detail {
+
+template <size_t Dim, typename OptionsGroup>
+struct InitializeElement {
+  using initialization_tags =
+      tmpl::list<domain::Tags::InitialRefinementLevels<Dim>,
+                 Tags::ChildrenRefinementLevels<Dim>,
+                 Tags::ParentRefinementLevels<Dim>>;
+  using simple_tags = tmpl::list<Tags::ParentId<Dim>, Tags::ChildIds<Dim>>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(db::DataBox<DbTagsList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ElementId<Dim>& element_id, const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    // The coarsest grid has no parent, which the `ElementsAllocator` signals
+    // by setting the parent refinement levels to those of the grid itself
+    std::optional<ElementId<Dim>> parent_element_id =
+        get<Tags::ParentRefinementLevels<Dim>>(box) ==
+                get<domain::Tags::InitialRefinementLevels<Dim>>(box)
+            ? std::nullopt
+            : std::make_optional(parent_id(element_id));
+    std::unordered_set<ElementId<Dim>> child_element_ids = child_ids(
+        element_id,
+        get<Tags::ChildrenRefinementLevels<Dim>>(box)[element_id.block_id()]);
+    Initialization::mutate_assign<simple_tags>(make_not_null(&box),
+                                               std::move(parent_element_id),
+                                               std::move(child_element_ids));
+    return std::make_tuple(std::move(box));
+  }
+};
+
+// Data sent from the children on the finer grid to their parent on the
+// coarser grid, i.e. the residual, on the mesh of the child
+template <size_t Dim, typename FieldsTag, typename OptionsGroup>
+struct DataFromChildrenInboxTag
+    : public Parallel::InboxInserters::Map<
+          DataFromChildrenInboxTag<Dim, FieldsTag, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type = std::map<
+      temporal_id,
+      std::unordered_map<ElementId<Dim>,
+                         std::pair<Mesh<Dim>, typename FieldsTag::type>>>;
+};
+
+// Data sent from the parent on the coarser grid to its children on the finer
+// grid, i.e. the correction, on the mesh of the parent
+template <size_t Dim, typename FieldsTag, typename OptionsGroup>
+struct DataFromParentInboxTag
+    : public Parallel::InboxInserters::Value<
+          DataFromParentInboxTag<Dim, FieldsTag, OptionsGroup>> {
+  using temporal_id = size_t;
+  using type =
+      std::map<temporal_id, std::pair<Mesh<Dim>, typename FieldsTag::type>>;
+};
+
+// Start the V-cycles. Only the finest grid observes the initial residual,
+// because the coarser grids receive their source only in the course of the
+// V-cycle.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct PrepareSolve {
+ private:
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool, size_t> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    constexpr size_t iteration_id = 0;
+
+    db::mutate<Convergence::Tags::IterationId<OptionsGroup>,
+               Convergence::Tags::HasConverged<OptionsGroup>>(
+        make_not_null(&box),
+        [](const gsl::not_null<size_t*> local_iteration_id,
+           const gsl::not_null<Convergence::HasConverged*> has_converged,
+           const size_t num_iterations) noexcept {
+          *local_iteration_id = iteration_id;
+          *has_converged =
+              Convergence::HasConverged{num_iterations, iteration_id};
+        },
+        get<Convergence::Tags::Iterations<OptionsGroup>>(box));
+
+    if (element_id.grid_index() == 0) {
+      const auto& residual = get<residual_tag>(box);
+      const double residual_magnitude_square =
+          inner_product(residual, residual);
+      async_solvers::contribute_to_residual_observation<OptionsGroup,
+                                                        ParallelComponent>(
+          iteration_id,
+          get<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(box),
+          residual_magnitude_square, cache, element_id);
+    }
+
+    // Skip the V-cycles entirely if the solve has already converged. All grids
+    // perform the same number of V-cycles.
+    constexpr size_t step_end_index =
+        tmpl::index_of<ActionList, CompleteStep<Dim, FieldsTag, OptionsGroup,
+                                                SourceTag, Label>>::value;
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, PrepareSolve>::value;
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+      db::mutate<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(
+          make_not_null(&box),
+          [](const gsl::not_null<size_t*> observation_id_offset) noexcept {
+            ++(*observation_id_offset);
+          });
+      return {std::move(box), false, step_end_index + 1};
+    }
+    return {std::move(box), false, this_action_index + 1};
+  }
+};
+
+// Wait for the residual of all children on the finer grid, restrict it to this
+// element and use it as the source on this grid. The coarse-grid problem is
+// solved for a correction, so the fields start at zero. Does nothing on the
+// finest grid.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, bool ResidualIsMassive>
+struct ReceiveResidualFromFinerGrid {
+ private:
+  using operator_applied_to_fields_tag =
+      db::add_tag_prefix<LinearSolver::Tags::OperatorAppliedTo, FieldsTag>;
+  using inbox_tag = DataFromChildrenInboxTag<Dim, FieldsTag, OptionsGroup>;
+
+ public:
+  using inbox_tags = tmpl::list<inbox_tag>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, Parallel::AlgorithmExecution>
+  apply(db::DataBox<DbTagsList>& box,
+        tuples::TaggedTuple<InboxTags...>& inboxes,
+        const Parallel::GlobalCache<Metavariables>& /*cache*/,
+        const ElementId<Dim>& element_id, const ActionList /*meta*/,
+        const ParallelComponent* const /*meta*/) noexcept {
+    const auto& child_element_ids = get<Tags::ChildIds<Dim>>(box);
+    if (child_element_ids.empty()) {
+      return {std::move(box), Parallel::AlgorithmExecution::Continue};
+    }
+
+    const size_t iteration_id =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    auto& inbox = tuples::get<inbox_tag>(inboxes);
+    const auto received_this_iteration = inbox.find(iteration_id);
+    if (received_this_iteration == inbox.end() or
+        received_this_iteration->second.size() != child_element_ids.size()) {
+      return {std::move(box), Parallel::AlgorithmExecution::Retry};
+    }
+
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Receive residual from finer grid\n",
+                       element_id, Options::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    auto children_data = std::move(inbox.extract(iteration_id).mapped());
+    const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
+    typename FieldsTag::type restricted_residual{mesh.number_of_grid_points(),
+                                                 0.};
+    for (const auto& [child_id, child_mesh_and_residual] : children_data) {
+      const auto& [child_mesh, child_residual] = child_mesh_and_residual;
+      const auto child_sizes =
+          child_size(child_id.segment_ids(), element_id.segment_ids());
+      if (Spectral::needs_projection(child_mesh, mesh, child_sizes)) {
+        restricted_residual += apply_matrices(
+            Spectral::projection_matrix_child_to_parent(
+                child_mesh, mesh, child_sizes, ResidualIsMassive),
+            child_residual, child_mesh.extents());
+      } else {
+        restricted_residual += child_residual;
+      }
+    }
+
+    db::mutate<SourceTag, FieldsTag, operator_applied_to_fields_tag>(
+        make_not_null(&box),
+        [&restricted_residual](const auto source, const auto fields,
+                               const auto operator_applied_to_fields) noexcept {
+          *source = std::move(restricted_residual);
+          fields->initialize(source->number_of_grid_points(), 0.);
+          operator_applied_to_fields->initialize(
+              source->number_of_grid_points(), 0.);
+        });
+    return {std::move(box), Parallel::AlgorithmExecution::Continue};
+  }
+};
+
+// Send the residual after pre-smoothing to the parent on the coarser grid. On
+// the coarsest grid the pre-smoothing is the coarse-grid solve, so skip
+// directly to sending the correction to the finer grid.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct SendResidualToCoarserGrid {
+ private:
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>;
+
+ public:
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool, size_t> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& parent_element_id = get<Tags::ParentId<Dim>>(box);
+    if (not parent_element_id.has_value()) {
+      constexpr size_t send_correction_index =
+          tmpl::index_of<ActionList,
+                         SendCorrectionToFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                                   SourceTag, Label>>::value;
+      return {std::move(box), false, send_correction_index};
+    }
+
+    const size_t iteration_id =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Send residual to coarser grid\n",
+                       element_id, Options::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    // The parent restricts the residual to its mesh, so it can combine the
+    // data from all its children without further communication
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::receive_data<
+        DataFromChildrenInboxTag<Dim, FieldsTag, OptionsGroup>>(
+        receiver_proxy[*parent_element_id], iteration_id,
+        std::make_pair(element_id,
+                       std::make_pair(get<domain::Tags::Mesh<Dim>>(box),
+                                      typename FieldsTag::type{
+                                          get<residual_tag>(box)})));
+
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, SendResidualToCoarserGrid>::value;
+    return {std::move(box), false, this_action_index + 1};
+  }
+};
+
+// Wait for the correction from the parent on the coarser grid, prolongate it
+// to this element and add it to the fields
+template <size_t Dim, typename FieldsTag, typename OptionsGroup>
+struct ReceiveCorrectionFromCoarserGrid {
+ private:
+  using inbox_tag = DataFromParentInboxTag<Dim, FieldsTag, OptionsGroup>;
+
+ public:
+  using inbox_tags = tmpl::list<inbox_tag>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, Parallel::AlgorithmExecution>
+  apply(db::DataBox<DbTagsList>& box,
+        tuples::TaggedTuple<InboxTags...>& inboxes,
+        const Parallel::GlobalCache<Metavariables>& /*cache*/,
+        const ElementId<Dim>& element_id, const ActionList /*meta*/,
+        const ParallelComponent* const /*meta*/) noexcept {
+    const size_t iteration_id =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    auto& inbox = tuples::get<inbox_tag>(inboxes);
+    if (inbox.find(iteration_id) == inbox.end()) {
+      return {std::move(box), Parallel::AlgorithmExecution::Retry};
+    }
+
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Receive correction from coarser grid\n",
+                       element_id, Options::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    const auto parent_data = std::move(inbox.extract(iteration_id).mapped());
+    const auto& parent_mesh = parent_data.first;
+    const auto& parent_correction = parent_data.second;
+    const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
+    const auto child_sizes = child_size(
+        element_id.segment_ids(), get<Tags::ParentId<Dim>>(box)->segment_ids());
+    db::mutate<FieldsTag>(
+        make_not_null(&box),
+        [&parent_mesh, &parent_correction, &mesh,
+         &child_sizes](const auto fields) noexcept {
+          if (Spectral::needs_projection(parent_mesh, mesh, child_sizes)) {
+            *fields += apply_matrices(
+                Spectral::projection_matrix_parent_to_child(parent_mesh, mesh,
+                                                            child_sizes),
+                parent_correction, parent_mesh.extents());
+          } else {
+            *fields += parent_correction;
+          }
+        });
+    return {std::move(box), Parallel::AlgorithmExecution::Continue};
+  }
+};
+
+// Send the correction, i.e. the solution of the coarse-grid problem after
+// post-smoothing, to the children on the finer grid. Does nothing on the finest
+// grid.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct SendCorrectionToFinerGrid {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    const auto& child_element_ids = get<Tags::ChildIds<Dim>>(box);
+    if (child_element_ids.empty()) {
+      return {std::move(box)};
+    }
+
+    const size_t iteration_id =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                 ::Verbosity::Debug)) {
+      Parallel::printf("%s %s(%zu): Send correction to finer grid\n",
+                       element_id, Options::name<OptionsGroup>(),
+                       iteration_id);
+    }
+
+    // Each child prolongates the correction to its mesh
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
+    const auto& fields = get<FieldsTag>(box);
+    for (const auto& child_id : child_element_ids) {
+      Parallel::receive_data<
+          DataFromParentInboxTag<Dim, FieldsTag, OptionsGroup>>(
+          receiver_proxy[child_id], iteration_id,
+          std::make_pair(mesh, fields));
+    }
+    return {std::move(box)};
+  }
+};
+
+// Complete the V-cycle. All grids observe the residual that remains after the
+// V-cycle, each in their own subfile.
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          typename SourceTag, typename Label>
+struct CompleteStep {
+ private:
+  using residual_tag =
+      db::add_tag_prefix<LinearSolver::Tags::Residual, FieldsTag>;
+
+ public:
+  using const_global_cache_tags =
+      tmpl::list<logging::Tags::Verbosity<OptionsGroup>>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool, size_t> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<Convergence::Tags::IterationId<OptionsGroup>,
+               Convergence::Tags::HasConverged<OptionsGroup>>(
+        make_not_null(&box),
+        [](const gsl::not_null<size_t*> iteration_id,
+           const gsl::not_null<Convergence::HasConverged*> has_converged,
+           const size_t num_iterations) noexcept {
+          ++(*iteration_id);
+          *has_converged =
+              Convergence::HasConverged{num_iterations, *iteration_id};
+        },
+        get<Convergence::Tags::Iterations<OptionsGroup>>(box));
+
+    const size_t completed_iterations =
+        get<Convergence::Tags::IterationId<OptionsGroup>>(box);
+    const auto& residual = get<residual_tag>(box);
+    const double residual_magnitude_square = inner_product(residual, residual);
+    async_solvers::contribute_to_residual_observation<OptionsGroup,
+                                                      ParallelComponent>(
+        completed_iterations,
+        get<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(box),
+        residual_magnitude_square, cache, element_id);
+
+    // Repeat V-cycles until the solve has converged
+    constexpr size_t step_begin_index =
+        tmpl::index_of<ActionList, PrepareSolve<Dim, FieldsTag, OptionsGroup,
+                                                SourceTag, Label>>::value +
+        1;
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, CompleteStep>::value;
+    if (get<Convergence::Tags::HasConverged<OptionsGroup>>(box)) {
+      db::mutate<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(
+          make_not_null(&box),
+          [&completed_iterations](
+              const gsl::not_null<size_t*> observation_id_offset) noexcept {
+            *observation_id_offset += completed_iterations + 1;
+          });
+      return {std::move(box), false, this_action_index + 1};
+    }
+    return {std::move(box), false, step_begin_index};
+  }
+};
+
+}  // namespace LinearSolver::multigrid::detail
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace LinearSolver::multigrid {
+
+/*!
+ * \brief An `ElementsAllocator` for the `elliptic::DgElementArray` that creates
+ * the elements on all grids of a multigrid hierarchy
+ *
+ * The finest grid has the initial refinement levels of the domain. Each coarser
+ * grid is created by `LinearSolver::multigrid::coarsen` until either all blocks
+ * are fully coarsened or `LinearSolver::multigrid::Tags::MaxLevels` is
+ * reached. The elements on grid \f$l\f$ have the `ElementId::grid_index`
+ * \f$l\f$, so all grids share a single element array. Every element is
+ * initialized with the refinement levels of its own grid in
+ * `domain::Tags::InitialRefinementLevels`, and with those of the finer and
+ * coarser grids in `LinearSolver::multigrid::Tags::ChildrenRefinementLevels`
+ * and `LinearSolver::multigrid::Tags::ParentRefinementLevels`.
+ */
+template <size_t Dim, typename OptionsGroup>
+struct ElementsAllocator {
+  using array_allocation_tags =
+      tmpl::list<domain::Tags::InitialRefinementLevels<Dim>,
+                 Tags::ChildrenRefinementLevels<Dim>,
+                 Tags::ParentRefinementLevels<Dim>,
+                 Tags::MaxLevels<OptionsGroup>>;
+
+  template <typename ElementArray, typename Metavariables,
+            typename... InitializationTags>
+  static void apply(Parallel::CProxy_GlobalCache<Metavariables>& global_cache,
+                    const tuples::TaggedTuple<InitializationTags...>&
+                        initialization_items) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& element_array =
+        Parallel::get_parallel_component<ElementArray>(local_cache);
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(local_cache);
+    const auto& max_levels =
+        get<Tags::MaxLevels<OptionsGroup>>(initialization_items);
+    const int number_of_procs = sys::number_of_procs();
+    // Each grid gets a copy of the initialization items with its own
+    // refinement levels
+    tuples::TaggedTuple<InitializationTags...> grid_initialization_items =
+        initialization_items;
+    std::vector<std::array<size_t, Dim>> refinement_levels =
+        get<domain::Tags::InitialRefinementLevels<Dim>>(initialization_items);
+    std::vector<std::array<size_t, Dim>> children_refinement_levels =
+        refinement_levels;
+    size_t multigrid_level = 0;
+    int which_proc = 0;
+    while (true) {
+      std::vector<std::array<size_t, Dim>> parent_refinement_levels =
+          coarsen(refinement_levels);
+      const bool is_coarsest_grid =
+          parent_refinement_levels == refinement_levels or
+          (max_levels.has_value() and multigrid_level + 1 >= *max_levels);
+      if (is_coarsest_grid) {
+        parent_refinement_levels = refinement_levels;
+      }
+      get<domain::Tags::InitialRefinementLevels<Dim>>(
+          grid_initialization_items) = refinement_levels;
+      get<Tags::ChildrenRefinementLevels<Dim>>(grid_initialization_items) =
+          children_refinement_levels;
+      get<Tags::ParentRefinementLevels<Dim>>(grid_initialization_items) =
+          parent_refinement_levels;
+      for (const auto& block : domain.blocks()) {
+        const std::vector<ElementId<Dim>> element_ids = initial_element_ids(
+            block.id(), refinement_levels[block.id()], multigrid_level);
+        for (const auto& element_id : element_ids) {
+          element_array(element_id)
+              .insert(global_cache, grid_initialization_items, which_proc);
+          which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+        }
+      }
+      if (is_coarsest_grid) {
+        break;
+      }
+      children_refinement_levels = std::move(refinement_levels);
+      refinement_levels = std::move(parent_refinement_levels);
+      ++multigrid_level;
+    }
+    element_array.doneInserting();
+  }
+};
+
+}  // namespace LinearSolver::multigrid
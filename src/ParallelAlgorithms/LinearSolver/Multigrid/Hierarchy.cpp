@@ -11,6 +11,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
@@ -157,13 +158,47 @@ std::unordered_set<ElementId<3>> child_ids<3>(
   return child_ids;
 }
 
+template <size_t Dim>
+std::array<Spectral::ChildSize, Dim> child_size(
+    const std::array<SegmentId, Dim>& child_segment_ids,
+    const std::array<SegmentId, Dim>& parent_segment_ids) noexcept {
+  std::array<Spectral::ChildSize, Dim> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    const SegmentId& child_segment_id = gsl::at(child_segment_ids, d);
+    const SegmentId& parent_segment_id = gsl::at(parent_segment_ids, d);
+    if (child_segment_id.refinement_level() ==
+        parent_segment_id.refinement_level()) {
+      ASSERT(child_segment_id == parent_segment_id,
+             "Expected the child segment ID "
+                 << child_segment_id << " to equal the parent segment ID "
+                 << parent_segment_id << " in dimension " << d
+                 << " because they have the same refinement level.");
+      gsl::at(result, d) = Spectral::ChildSize::Full;
+    } else {
+      ASSERT(child_segment_id.id_of_parent() == parent_segment_id,
+             "The parent segment ID "
+                 << parent_segment_id
+                 << " does not cover the child segment ID " << child_segment_id
+                 << " in dimension " << d << ".");
+      gsl::at(result, d) =
+          child_segment_id.side_of_sibling() == Side::Lower
+              ? Spectral::ChildSize::UpperHalf
+              : Spectral::ChildSize::LowerHalf;
+    }
+  }
+  return result;
+}
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
-#define INSTANTIATE(r, data)                                   \
-  template std::vector<std::array<size_t, DIM(data)>> coarsen( \
-      std::vector<std::array<size_t, DIM(data)>>               \
-          initial_refinement_levels) noexcept;                 \
-  template ElementId<DIM(data)> parent_id(                     \
-      const ElementId<DIM(data)>& child_id) noexcept;
+#define INSTANTIATE(r, data)                                      \
+  template std::vector<std::array<size_t, DIM(data)>> coarsen(    \
+      std::vector<std::array<size_t, DIM(data)>>                  \
+          initial_refinement_levels) noexcept;                    \
+  template ElementId<DIM(data)> parent_id(                        \
+      const ElementId<DIM(data)>& child_id) noexcept;             \
+  template std::array<Spectral::ChildSize, DIM(data)> child_size( \
+      const std::array<SegmentId, DIM(data)>& child_segment_ids,  \
+      const std::array<SegmentId, DIM(data)>& parent_segment_ids) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
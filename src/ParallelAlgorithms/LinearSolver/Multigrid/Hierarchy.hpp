@@ -8,9 +8,12 @@
 #include <unordered_set>
 #include <vector>
 
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+
 /// \cond
 template <size_t Dim>
 struct ElementId;
+class SegmentId;
 /// \endcond
 
 namespace LinearSolver::multigrid {
@@ -65,4 +68,24 @@ std::unordered_set<ElementId<Dim>> child_ids(
     const ElementId<Dim>& parent_id,
     const std::array<size_t, Dim>& children_refinement_levels) noexcept;
 
+/*!
+ * \brief The part of the parent element that the child element covers.
+ *
+ * Use the result to project data between the child and the parent element,
+ * e.g. with `Spectral::projection_matrix_parent_to_child` and
+ * `Spectral::projection_matrix_child_to_parent`.
+ *
+ * \tparam Dim The spatial dimension of the domain
+ * \param child_segment_ids The segment IDs of an element on the finer grid
+ * \param parent_segment_ids The segment IDs of the element on the coarser grid
+ * that covers the child element (see `parent_id`)
+ * \return std::array<Spectral::ChildSize, Dim> `Spectral::ChildSize::Full` in
+ * dimensions where the child and the parent have the same refinement level,
+ * else the half of the parent segment that the child covers.
+ */
+template <size_t Dim>
+std::array<Spectral::ChildSize, Dim> child_size(
+    const std::array<SegmentId, Dim>& child_segment_ids,
+    const std::array<SegmentId, Dim>& parent_segment_ids) noexcept;
+
 }  // namespace LinearSolver::multigrid
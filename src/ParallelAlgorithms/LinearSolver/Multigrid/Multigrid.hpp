@@ -3,6 +3,131 @@
 
 #pragma once
 
+#include <cstddef>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/AsynchronousSolvers/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementActions.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/ElementsAllocator.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
 /// \ingroup LinearSolverGroup
 /// Items related to the multigrid linear solver
-namespace LinearSolver::multigrid {}
+///
+/// \see `LinearSolver::multigrid::Multigrid`
+namespace LinearSolver::multigrid {
+
+namespace detail {
+template <typename Label>
+struct PreSmoothingLabel {};
+template <typename Label>
+struct PostSmoothingLabel {};
+}  // namespace detail
+
+/*!
+ * \ingroup LinearSolverGroup
+ * \brief A geometric multigrid V-cycle for solving a system of linear equations
+ * \f$Ax=b\f$
+ *
+ * The multigrid hierarchy is created by the
+ * `LinearSolver::multigrid::ElementsAllocator`, which must be passed to the
+ * `elliptic::DgElementArray`. All grids share the element array and are
+ * distinguished by the `ElementId::grid_index`, which is zero on the finest
+ * grid. Each coarser grid combines two elements per dimension into one (see
+ * `LinearSolver::multigrid::coarsen`).
+ *
+ * Each iteration of the algorithm is one V-cycle, which proceeds as follows on
+ * every grid:
+ *
+ * 1. On all but the finest grid, wait for the residuals of the child elements
+ *    on the finer grid and restrict them to this element with
+ *    `Spectral::projection_matrix_child_to_parent`. They form the source
+ *    \f$b\f$ of a problem for the correction, so the fields start at zero.
+ * 2. Pre-smoothing: apply a few iterations of the `Smoother`.
+ * 3. Send the remaining residual to the parent element on the coarser grid.
+ *    On the coarsest grid the pre-smoothing serves as the coarse-grid solve,
+ *    so skip to step 6.
+ * 4. Wait for the correction from the parent element on the coarser grid,
+ *    prolongate it to this element with
+ *    `Spectral::projection_matrix_parent_to_child` and add it to the fields.
+ *    Then apply the operator to the corrected fields.
+ * 5. Post-smoothing: apply a few iterations of the `Smoother`.
+ * 6. Send the fields, i.e. the correction on this grid, to the child elements
+ *    on the finer grid.
+ *
+ * The `Smoother` is a linear solver without global synchronization points,
+ * i.e. `LinearSolver::Richardson::Richardson` or
+ * `LinearSolver::Schwarz::Schwarz`, that operates on the same `FieldsTag` and
+ * `SourceTag` as the multigrid solver. Its `initialize_element` and
+ * `register_element` actions must be added to the element array along with
+ * those of the multigrid solver. Because the smoother runs on all grids, it
+ * observes each coarser grid in a separate subfile.
+ *
+ * Since the coarse grids can resolve only the long-wavelength modes of the
+ * residual, and the smoother removes only the short-wavelength modes
+ * efficiently, the number of V-cycles needed to reach a given residual is
+ * nearly independent of the resolution. The algorithm is typically used as a
+ * preconditioner for a Krylov-subspace solver such as
+ * `LinearSolver::gmres::Gmres`.
+ *
+ * Set `ResidualIsMassive` to `true` if the operator \f$A\f$ includes the mass
+ * matrix, i.e. if the residual is a "massive" quantity (see
+ * `Spectral::projection_matrix_child_to_parent`).
+ *
+ * \par Combining with other linear solvers
+ * The operator applied on every grid is the one passed to `solve`. Operators
+ * that communicate between neighboring elements are unaffected by the other
+ * grids, since the neighbors of an element are on the same grid. However,
+ * other linear solvers in the action list that perform global reductions
+ * would reduce over all grids, so use this algorithm either as the outermost
+ * solver or as the preconditioner of a solver that runs only on the finest
+ * grid.
+ */
+template <size_t Dim, typename FieldsTag, typename OptionsGroup,
+          bool ResidualIsMassive,
+          typename SourceTag =
+              db::add_tag_prefix<::Tags::FixedSource, FieldsTag>>
+struct Multigrid {
+  using fields_tag = FieldsTag;
+  using options_group = OptionsGroup;
+  using source_tag = SourceTag;
+  using operand_tag = fields_tag;
+
+  using component_list = tmpl::list<>;
+  using observed_reduction_data_tags = observers::make_reduction_data_tags<
+      tmpl::list<async_solvers::reduction_data>>;
+
+  /// Pass this allocator to the `elliptic::DgElementArray`
+  using elements_allocator = ElementsAllocator<Dim, OptionsGroup>;
+
+  using initialize_element = tmpl::list<
+      async_solvers::InitializeElement<FieldsTag, OptionsGroup, SourceTag>,
+      detail::InitializeElement<Dim, OptionsGroup>>;
+
+  using register_element =
+      async_solvers::RegisterElement<FieldsTag, OptionsGroup, SourceTag>;
+
+  template <typename ApplyOperatorActions, typename Smoother,
+            typename Label = OptionsGroup>
+  using solve = tmpl::list<
+      detail::PrepareSolve<Dim, FieldsTag, OptionsGroup, SourceTag, Label>,
+      detail::ReceiveResidualFromFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                           SourceTag, ResidualIsMassive>,
+      typename Smoother::template solve<ApplyOperatorActions,
+                                        detail::PreSmoothingLabel<Label>>,
+      detail::SendResidualToCoarserGrid<Dim, FieldsTag, OptionsGroup,
+                                        SourceTag, Label>,
+      detail::ReceiveCorrectionFromCoarserGrid<Dim, FieldsTag, OptionsGroup>,
+      ApplyOperatorActions,
+      typename Smoother::template solve<ApplyOperatorActions,
+                                        detail::PostSmoothingLabel<Label>>,
+      detail::SendCorrectionToFinerGrid<Dim, FieldsTag, OptionsGroup,
+                                        SourceTag, Label>,
+      detail::CompleteStep<Dim, FieldsTag, OptionsGroup, SourceTag, Label>>;
+};
+
+}  // namespace LinearSolver::multigrid
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/OptionTags.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Options/Auto.hpp"
+#include "Options/Options.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace LinearSolver::multigrid {
+
+namespace OptionTags {
+
+template <typename OptionsGroup>
+struct MaxLevels {
+  using type = Options::Auto<size_t>;
+  static constexpr Options::String help =
+      "Maximum number of levels in the multigrid hierarchy. Includes the "
+      "finest grid, i.e. set to '1' to disable multigrid. Set to 'Auto' to "
+      "coarsen all the way up to single-element blocks.";
+  using group = OptionsGroup;
+};
+
+}  // namespace OptionTags
+
+/// DataBox tags for the `LinearSolver::multigrid::Multigrid` linear solver
+namespace Tags {
+
+/// Maximum number of multigrid levels. The coarsest grid is reached when this
+/// number of levels is reached, or when all blocks are fully coarsened.
+template <typename OptionsGroup>
+struct MaxLevels : db::SimpleTag {
+  static std::string name() noexcept {
+    return "MaxLevels(" + Options::name<OptionsGroup>() + ")";
+  }
+  using type = std::optional<size_t>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<OptionTags::MaxLevels<OptionsGroup>>;
+  static type create_from_options(const type value) noexcept { return value; }
+};
+
+/// The refinement levels of the next-finer grid in every block of the domain.
+/// On the finest grid these are the element's own refinement levels.
+///
+/// \note The option-created value applies to the finest grid. The
+/// `LinearSolver::multigrid::ElementsAllocator` sets the values for the
+/// coarser grids.
+template <size_t Dim>
+struct ChildrenRefinementLevels : db::SimpleTag {
+  using type = std::vector<std::array<size_t, Dim>>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<domain::OptionTags::DomainCreator<Dim>>;
+  static type create_from_options(
+      const std::unique_ptr<::DomainCreator<Dim>>& domain_creator) noexcept {
+    return domain_creator->initial_refinement_levels();
+  }
+};
+
+/// The refinement levels of the next-coarser grid in every block of the
+/// domain. On the coarsest grid these are the element's own refinement levels.
+///
+/// \note The option-created value applies to the finest grid. The
+/// `LinearSolver::multigrid::ElementsAllocator` sets the values for the
+/// coarser grids.
+template <size_t Dim>
+struct ParentRefinementLevels : db::SimpleTag {
+  using type = std::vector<std::array<size_t, Dim>>;
+  static constexpr bool pass_metavariables = false;
+  using option_tags = tmpl::list<domain::OptionTags::DomainCreator<Dim>>;
+  static type create_from_options(
+      const std::unique_ptr<::DomainCreator<Dim>>& domain_creator) noexcept {
+    return coarsen(domain_creator->initial_refinement_levels());
+  }
+};
+
+/// The ID of the element on the next-coarser grid that covers this element,
+/// or `std::nullopt` on the coarsest grid
+template <size_t Dim>
+struct ParentId : db::SimpleTag {
+  using type = std::optional<ElementId<Dim>>;
+};
+
+/// The IDs of the elements on the next-finer grid that cover this element.
+/// Empty on the finest grid.
+template <size_t Dim>
+struct ChildIds : db::SimpleTag {
+  using type = std::unordered_set<ElementId<Dim>>;
+};
+
+}  // namespace Tags
+}  // namespace LinearSolver::multigrid
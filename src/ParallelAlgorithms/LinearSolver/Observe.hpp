@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "Domain/Structure/ElementId.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/ReductionActions.hpp"
@@ -23,6 +24,29 @@
 namespace LinearSolver {
 namespace observe_detail {
 
+/// @{
+/*!
+ * \brief Distinguishes the observations of the grids in a multigrid hierarchy
+ *
+ * Solvers that run on all grids of a multigrid hierarchy (see
+ * `LinearSolver::multigrid::Multigrid`), e.g. its smoother, append this suffix
+ * to their observation keys and subfile names so the grids are reduced
+ * separately. The suffix is empty on the finest grid and for elements that
+ * are not indexed by an `ElementId`.
+ */
+template <typename ArrayIndex>
+std::string multigrid_level_suffix(const ArrayIndex& /*array_index*/) noexcept {
+  return "";
+}
+
+template <size_t Dim>
+std::string multigrid_level_suffix(const ElementId<Dim>& element_id) noexcept {
+  return element_id.grid_index() == 0
+             ? std::string{}
+             : "Level" + std::to_string(element_id.grid_index());
+}
+/// @}
+
 using reduction_data = Parallel::ReductionData<
     // Iteration
     Parallel::ReductionDatum<size_t, funcl::AssertEqual<>>,
@@ -46,6 +46,7 @@
 #include "Parallel/Reduction.hpp"
 #include "ParallelAlgorithms/Initialization/MergeIntoDataBox.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "ParallelAlgorithms/LinearSolver/Observe.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/Actions/CommunicateOverlapFields.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
@@ -98,10 +99,13 @@ struct RegisterObservers {
             typename ArrayIndex>
   static std::pair<observers::TypeOfObservation, observers::ObservationKey>
   register_info(const db::DataBox<DbTagsList>& /*box*/,
-                const ArrayIndex& /*array_index*/) noexcept {
+                const ArrayIndex& array_index) noexcept {
     return {observers::TypeOfObservation::Reduction,
-            observers::ObservationKey{pretty_type::get_name<OptionsGroup>() +
-                                      "SubdomainSolves"}};
+            observers::ObservationKey{
+                pretty_type::get_name<OptionsGroup>() +
+                LinearSolver::observe_detail::multigrid_level_suffix(
+                    array_index) +
+                "SubdomainSolves"}};
   }
 };
 
@@ -112,7 +116,8 @@ using RegisterElement =
 template <typename OptionsGroup, typename ParallelComponent,
           typename Metavariables, typename ArrayIndex>
 void contribute_to_subdomain_stats_observation(
-    const size_t iteration_id, const size_t subdomain_solve_num_iterations,
+    const size_t iteration_id, const size_t observation_id_offset,
+    const size_t subdomain_solve_num_iterations,
     Parallel::GlobalCache<Metavariables>& cache,
     const ArrayIndex& array_index) noexcept {
   auto& local_observer =
@@ -124,15 +129,18 @@ void contribute_to_subdomain_stats_observation(
                ::Verbosity::Verbose)
           ? std::make_optional(SubdomainStatsFormatter<OptionsGroup>{})
           : std::nullopt;
+  const std::string level_suffix =
+      LinearSolver::observe_detail::multigrid_level_suffix(array_index);
   Parallel::simple_action<observers::Actions::ContributeReductionData>(
       local_observer,
-      observers::ObservationId(
-          iteration_id,
-          pretty_type::get_name<OptionsGroup>() + "SubdomainSolves"),
+      observers::ObservationId(observation_id_offset + iteration_id,
+                               pretty_type::get_name<OptionsGroup>() +
+                                   level_suffix + "SubdomainSolves"),
       observers::ArrayComponentId{
           std::add_pointer_t<ParallelComponent>{nullptr},
           Parallel::ArrayIndex<ArrayIndex>(array_index)},
-      std::string{"/" + Options::name<OptionsGroup>() + "SubdomainSolves"},
+      std::string{"/" + Options::name<OptionsGroup>() + level_suffix +
+                  "SubdomainSolves"},
       std::vector<std::string>{"Iteration", "NumSubdomains", "AvgNumIterations",
                                "MinNumIterations", "MaxNumIterations"},
       reduction_data{iteration_id, 1, subdomain_solve_num_iterations,
@@ -390,8 +398,9 @@ struct SolveSubdomain {
       }
     }
     contribute_to_subdomain_stats_observation<OptionsGroup, ParallelComponent>(
-        iteration_id + 1, subdomain_solve_has_converged.num_iterations(), cache,
-        element_id);
+        iteration_id + 1,
+        get<LinearSolver::Tags::ObservationIdOffset<OptionsGroup>>(box),
+        subdomain_solve_has_converged.num_iterations(), cache, element_id);
 
     // Apply weighting
     if (LIKELY(max_overlap > 0)) {
@@ -16,6 +16,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DenseMatrix.hpp"
+#include "Options/Options.hpp"
 #include "Utilities/Gsl.hpp"
 
 /*!
@@ -119,6 +120,34 @@ struct Magnitude : db::PrefixTag, db::SimpleTag {
   using tag = Tag;
 };
 
+/*!
+ * \brief The direction along which a linear solver updates the solution in an
+ * iteration, e.g. \f$p\f$ in the conjugate gradient algorithm
+ */
+template <typename Tag>
+struct SearchDirection : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept {
+    // Add "Linear" prefix to abbreviate the namespace for uniqueness
+    return "LinearSearchDirection(" + db::tag_name<Tag>() + ")";
+  }
+  using type = typename Tag::type;
+  using tag = Tag;
+};
+
+/*!
+ * \brief The distance a linear solver moves along the `SearchDirection` in an
+ * iteration, e.g. \f$\alpha\f$ in the conjugate gradient algorithm
+ */
+template <typename Tag>
+struct StepLength : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept {
+    // Add "Linear" prefix to abbreviate the namespace for uniqueness
+    return "LinearStepLength(" + db::tag_name<Tag>() + ")";
+  }
+  using type = double;
+  using tag = Tag;
+};
+
 /*!
  * \brief The prefix for tags related to an orthogonalization procedure
  */
@@ -172,5 +201,22 @@ struct Preconditioned : db::PrefixTag, db::SimpleTag {
   using tag = Tag;
 };
 
+/*!
+ * \brief The number of residuals that the element observed in all previous
+ * solves with the `OptionsGroup`
+ *
+ * \details Solvers that run repeatedly, e.g. as the smoother on every grid of a
+ * multigrid V-cycle, add this offset to the iteration ID of their observations.
+ * Otherwise observations of different solves with the same iteration ID would
+ * be reduced together.
+ */
+template <typename OptionsGroup>
+struct ObservationIdOffset : db::SimpleTag {
+  static std::string name() noexcept {
+    return "ObservationIdOffset(" + Options::name<OptionsGroup>() + ")";
+  }
+  using type = size_t;
+};
+
 }  // namespace Tags
 }  // namespace LinearSolver
@@ -484,6 +484,14 @@ KerrSchild::IntermediateVars<DataType, Frame>::IntermediateVars(
     : CachedBuffer(get_size(::get<0>(x)), IntermediateComputer<DataType, Frame>(
                                               solution, x, null_vector_0_)) {}
 
+template <typename DataType, typename Frame>
+KerrSchild::IntermediateVars<DataType, Frame>::IntermediateVars(
+    const KerrSchild& solution, const tnsr::I<DataType, 3, Frame>& x,
+    const gsl::not_null<Arena*> arena) noexcept
+    : CachedBuffer(
+          get_size(::get<0>(x)), arena,
+          IntermediateComputer<DataType, Frame>(solution, x, null_vector_0_)) {}
+
 template <typename DataType, typename Frame>
 tnsr::i<DataType, 3, Frame>
 KerrSchild::IntermediateVars<DataType, Frame>::get_var(
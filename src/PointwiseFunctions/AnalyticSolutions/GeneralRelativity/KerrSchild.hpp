@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <pup.h>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/CachedTempBuffer.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -16,6 +17,7 @@
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/Solutions.hpp"
 #include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
 #include "Utilities/ForceInline.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -255,7 +257,12 @@ class KerrSchild : public AnalyticSolution<3_st>,
             tmpl::list_contains_v<tags<DataType, Frame>, Tags>...>,
         "At least one of the requested tags is not supported. The requested "
         "tags are listed as template parameters of the `variables` function.");
-    IntermediateVars<DataType, Frame> intermediate(*this, x);
+    // The intermediate variables are only needed to compute the requested
+    // tags, so their memory is taken from the arena of this thread
+    Arena& arena = Arena::local();
+    const ArenaScope arena_scope{make_not_null(&arena)};
+    IntermediateVars<DataType, Frame> intermediate(*this, x,
+                                                   make_not_null(&arena));
     return {intermediate.get_var(Tags{})...};
   }
 
@@ -500,6 +507,12 @@ class KerrSchild : public AnalyticSolution<3_st>,
     IntermediateVars(const KerrSchild& solution,
                      const tnsr::I<DataType, 3, Frame>& x) noexcept;
 
+    /// Take the memory of the buffer from the `arena`. The intermediate
+    /// variables must then not outlive the `ArenaScope` they were created in.
+    IntermediateVars(const KerrSchild& solution,
+                     const tnsr::I<DataType, 3, Frame>& x,
+                     gsl::not_null<Arena*> arena) noexcept;
+
     using CachedBuffer::get_var;
 
     tnsr::i<DataType, 3, Frame> get_var(
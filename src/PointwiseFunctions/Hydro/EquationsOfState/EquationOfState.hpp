@@ -24,6 +24,8 @@ template <bool IsRelativistic>
 class IdealFluid;
 template <bool IsRelativistic>
 class PolytropicFluid;
+template <bool IsRelativistic>
+class Tabulated3D;
 }  // namespace EquationsOfState
 /// \endcond
 
@@ -41,7 +43,8 @@ struct DerivedClasses<IsRelativistic, 1> {
 
 template <>
 struct DerivedClasses<true, 2> {
-  using type = tmpl::list<DarkEnergyFluid<true>, IdealFluid<true>>;
+  using type =
+      tmpl::list<DarkEnergyFluid<true>, IdealFluid<true>, Tabulated3D<true>>;
 };
 
 template <>
@@ -411,3 +414,4 @@ class EquationOfState<IsRelativistic, 2>
 #include "PointwiseFunctions/Hydro/EquationsOfState/DarkEnergyFluid.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
@@ -0,0 +1,593 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+#include "DataStructures/BoostMultiArray.hpp"  // IWYU pragma: keep
+#include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/StellarCollapseEos.hpp"
+#include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/MakeWithValue.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+// IWYU pragma: no_include <boost/multi_array.hpp>
+
+namespace EquationsOfState {
+namespace {
+// Factors that convert the CGS units of stellarcollapse.org tables to the
+// geometric units G = c = M_sun = 1
+constexpr double density_to_geometric_units = 1.619215954548962e-18;
+constexpr double pressure_to_geometric_units = 1.801620722591816e-39;
+constexpr double specific_energy_to_geometric_units = 1.1126500560536184e-21;
+
+constexpr double ln_ten = 2.302585092994045684;
+
+template <typename DataType>
+DataType power_of_ten(const DataType& x) noexcept {
+  using std::exp;
+  return DataType{exp(ln_ten * x)};
+}
+
+// d log10(p) / d log10(eps + eps_shift) at constant density, from the
+// temperature derivatives of both. Some cells of the tables have an energy
+// that is flat in the temperature, where the energy doesn't determine the
+// temperature. The pressure is then taken not to change with the energy.
+double d_log_pressure_d_log_energy(
+    const double d_log_pressure_d_log_temperature,
+    const double d_log_shifted_energy_d_log_temperature) noexcept {
+  return d_log_shifted_energy_d_log_temperature > 0.0
+             ? d_log_pressure_d_log_temperature /
+                   d_log_shifted_energy_d_log_temperature
+             : 0.0;
+}
+
+Tabulated3DTable read_table(const std::string& filename,
+                            const std::string& subgroup) noexcept {
+  h5::H5File<h5::AccessType::ReadOnly> file{filename};
+  const auto& eos_file = file.get<h5::StellarCollapseEos>(subgroup);
+
+  Tabulated3DTable table{};
+  table.log_rest_mass_density = eos_file.get_rank1_dataset("logrho");
+  for (double& log_density : table.log_rest_mass_density) {
+    log_density += std::log10(density_to_geometric_units);
+  }
+  table.log_temperature = eos_file.get_rank1_dataset("logtemp");
+  table.electron_fraction = eos_file.get_rank1_dataset("ye");
+
+  const auto read_rank3_dataset = [&eos_file, &table, &filename](
+                                      const std::string& dataset_name,
+                                      const double log_unit) noexcept {
+    const auto data = eos_file.get_rank3_dataset(dataset_name);
+    if (data.shape()[0] != table.electron_fraction.size() or
+        data.shape()[1] != table.log_temperature.size() or
+        data.shape()[2] != table.log_rest_mass_density.size()) {
+      ERROR("The dataset '" << dataset_name << "' in the table '" << filename
+                            << "' has extents (" << data.shape()[0] << ","
+                            << data.shape()[1] << "," << data.shape()[2]
+                            << ") but the table has "
+                            << table.electron_fraction.size()
+                            << " electron fractions, "
+                            << table.log_temperature.size()
+                            << " temperatures and "
+                            << table.log_rest_mass_density.size()
+                            << " densities.");
+    }
+    std::vector<double> result(data.data(), data.data() + data.num_elements());
+    for (double& value : result) {
+      value += log_unit;
+    }
+    return result;
+  };
+  table.log_pressure = read_rank3_dataset(
+      "logpress", std::log10(pressure_to_geometric_units));
+  table.log_shifted_specific_internal_energy = read_rank3_dataset(
+      "logenergy", std::log10(specific_energy_to_geometric_units));
+  table.energy_shift = eos_file.get_scalar_dataset<double>("energy_shift") *
+                       specific_energy_to_geometric_units;
+  return table;
+}
+}  // namespace
+
+void Tabulated3DTable::pup(PUP::er& p) noexcept {
+  p | log_rest_mass_density;
+  p | log_temperature;
+  p | electron_fraction;
+  p | log_pressure;
+  p | log_shifted_specific_internal_energy;
+  p | energy_shift;
+}
+
+std::shared_ptr<const Tabulated3DTable> read_stellar_collapse_table(
+    const std::string& filename, const std::string& subgroup) noexcept {
+  // Tables are large, so the cache only holds weak references and frees a
+  // table once no equation of state uses it anymore
+  static std::mutex cache_mutex{};
+  static std::map<std::pair<std::string, std::string>,
+                  std::weak_ptr<const Tabulated3DTable>>
+      cache{};
+  const std::lock_guard<std::mutex> lock{cache_mutex};
+  auto& cached_table = cache[std::make_pair(filename, subgroup)];
+  auto table = cached_table.lock();
+  if (table == nullptr) {
+    table = std::make_shared<const Tabulated3DTable>(
+        read_table(filename, subgroup));
+    cached_table = table;
+  }
+  return table;
+}
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(
+    std::string table_filename, std::string table_subgroup,
+    const double electron_fraction) noexcept
+    : table_filename_(std::move(table_filename)),
+      table_subgroup_(std::move(table_subgroup)),
+      electron_fraction_(electron_fraction),
+      table_(read_stellar_collapse_table(table_filename_, table_subgroup_)) {
+  initialize_interpolation();
+}
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(
+    std::shared_ptr<const Tabulated3DTable> table,
+    const double electron_fraction) noexcept
+    : electron_fraction_(electron_fraction), table_(std::move(table)) {
+  initialize_interpolation();
+}
+
+EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
+                                     Tabulated3D<IsRelativistic>, double, 2)
+EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
+                                     Tabulated3D<IsRelativistic>, DataVector, 2)
+
+template <bool IsRelativistic>
+Tabulated3D<IsRelativistic>::Tabulated3D(
+    CkMigrateMessage* /*unused*/) noexcept {}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::pup(PUP::er& p) noexcept {
+  EquationOfState<IsRelativistic, 2>::pup(p);
+  p | table_filename_;
+  p | table_subgroup_;
+  p | electron_fraction_;
+  if (table_filename_.empty()) {
+    // Tables that weren't read from a file are sent in full
+    auto table = p.isUnpacking() ? Tabulated3DTable{} : *table_;
+    p | table;
+    if (p.isUnpacking()) {
+      table_ = std::make_shared<const Tabulated3DTable>(std::move(table));
+    }
+  } else if (p.isUnpacking()) {
+    table_ = read_stellar_collapse_table(table_filename_, table_subgroup_);
+  }
+  if (p.isUnpacking()) {
+    initialize_interpolation();
+  }
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::initialize_interpolation() noexcept {
+  const auto& log_density = table_->log_rest_mass_density;
+  const auto& electron_fraction = table_->electron_fraction;
+  number_of_densities_ = log_density.size();
+  number_of_temperatures_ = table_->log_temperature.size();
+  if (number_of_densities_ < 2 or number_of_temperatures_ < 2 or
+      electron_fraction.size() < 2) {
+    ERROR("The table must have at least two points in each dimension, but has "
+          << number_of_densities_ << " densities, " << number_of_temperatures_
+          << " temperatures and " << electron_fraction.size()
+          << " electron fractions.");
+  }
+  const size_t table_size =
+      number_of_densities_ * number_of_temperatures_ * electron_fraction.size();
+  if (table_->log_pressure.size() != table_size or
+      table_->log_shifted_specific_internal_energy.size() != table_size) {
+    ERROR("The table should hold "
+          << table_size << " values of each quantity but holds "
+          << table_->log_pressure.size() << " pressures and "
+          << table_->log_shifted_specific_internal_energy.size()
+          << " specific internal energies.");
+  }
+
+  log_density_lower_bound_ = log_density.front();
+  const double log_density_spacing =
+      (log_density.back() - log_density.front()) /
+      static_cast<double>(number_of_densities_ - 1);
+  inverse_log_density_spacing_ = 1.0 / log_density_spacing;
+  for (size_t i = 0; i < number_of_densities_; ++i) {
+    if (std::abs(log_density[i] - log_density_lower_bound_ -
+                 static_cast<double>(i) * log_density_spacing) >
+        1.0e-10 * std::max(1.0, std::abs(log_density[i]))) {
+      ERROR("The density grid of the table must be uniformly spaced in "
+            "log10(rho).");
+    }
+  }
+
+  if (electron_fraction_ < electron_fraction.front() or
+      electron_fraction_ > electron_fraction.back()) {
+    ERROR("The electron fraction " << electron_fraction_
+                                   << " is outside of the table range ["
+                                   << electron_fraction.front() << ", "
+                                   << electron_fraction.back() << "].");
+  }
+  electron_fraction_index_ = std::min(
+      static_cast<size_t>(std::upper_bound(electron_fraction.begin(),
+                                           electron_fraction.end(),
+                                           electron_fraction_) -
+                          electron_fraction.begin() - 1),
+      electron_fraction.size() - 2);
+  electron_fraction_weight_ =
+      (electron_fraction_ - electron_fraction[electron_fraction_index_]) /
+      (electron_fraction[electron_fraction_index_ + 1] -
+       electron_fraction[electron_fraction_index_]);
+
+  // The specific enthalpy increases with the temperature, so its lower bound is
+  // at the lowest temperature of the table
+  specific_enthalpy_lower_bound_ = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < number_of_densities_; ++i) {
+    const auto cell = density_cell(log_density[i]);
+    const double specific_internal_energy =
+        power_of_ten(value_at_temperature(
+            table_->log_shifted_specific_internal_energy, cell, 0)) -
+        table_->energy_shift;
+    const double pressure =
+        power_of_ten(value_at_temperature(table_->log_pressure, cell, 0));
+    specific_enthalpy_lower_bound_ =
+        std::min(specific_enthalpy_lower_bound_,
+                 1.0 + specific_internal_energy +
+                     pressure / power_of_ten(log_density[i]));
+  }
+}
+
+template <bool IsRelativistic>
+std::pair<size_t, double> Tabulated3D<IsRelativistic>::density_cell(
+    const double log_density) const noexcept {
+  const double x =
+      (log_density - log_density_lower_bound_) * inverse_log_density_spacing_;
+  if (not(x > 0.0)) {
+    return {0, 0.0};
+  }
+  if (x >= static_cast<double>(number_of_densities_ - 1)) {
+    return {number_of_densities_ - 2, 1.0};
+  }
+  const auto index = static_cast<size_t>(x);
+  return {index, x - static_cast<double>(index)};
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::value_at_temperature(
+    const std::vector<double>& quantity,
+    const std::pair<size_t, double>& density_location,
+    const size_t temperature_index) const noexcept {
+  const size_t electron_fraction_stride =
+      number_of_densities_ * number_of_temperatures_;
+  const size_t lower =
+      density_location.first +
+      number_of_densities_ * temperature_index +
+      electron_fraction_stride * electron_fraction_index_;
+  const size_t upper = lower + electron_fraction_stride;
+  const double density_weight = density_location.second;
+  return (1.0 - electron_fraction_weight_) *
+             ((1.0 - density_weight) * quantity[lower] +
+              density_weight * quantity[lower + 1]) +
+         electron_fraction_weight_ * ((1.0 - density_weight) * quantity[upper] +
+                                      density_weight * quantity[upper + 1]);
+}
+
+template <bool IsRelativistic>
+template <typename ValueAtNode>
+size_t Tabulated3D<IsRelativistic>::temperature_cell(
+    const ValueAtNode& value_at_node, const double target,
+    const gsl::not_null<size_t*> cached_cell) const noexcept {
+  const size_t last_cell = number_of_temperatures_ - 2;
+  if (*cached_cell <= last_cell and value_at_node(*cached_cell) <= target and
+      target < value_at_node(*cached_cell + 1)) {
+    return *cached_cell;
+  }
+  // Find the last node whose value doesn't exceed the target, or the first
+  // (last) cell if the target is below (above) the table
+  size_t lower = 0;
+  size_t upper = number_of_temperatures_ - 1;
+  while (upper - lower > 1) {
+    const size_t middle = lower + (upper - lower) / 2;
+    if (value_at_node(middle) <= target) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+  *cached_cell = lower;
+  return lower;
+}
+
+template <bool IsRelativistic>
+std::pair<size_t, double> Tabulated3D<IsRelativistic>::invert_in_temperature(
+    const std::vector<double>& quantity,
+    const std::pair<size_t, double>& density_location, const double target,
+    const gsl::not_null<size_t*> cached_cell) const noexcept {
+  const size_t cell = temperature_cell(
+      [this, &quantity, &density_location](const size_t index) noexcept {
+        return value_at_temperature(quantity, density_location, index);
+      },
+      target, cached_cell);
+  const double lower_value =
+      value_at_temperature(quantity, density_location, cell);
+  const double upper_value =
+      value_at_temperature(quantity, density_location, cell + 1);
+  return {cell,
+          upper_value > lower_value
+              ? std::clamp((target - lower_value) / (upper_value - lower_value),
+                           0.0, 1.0)
+              : 0.0};
+}
+
+template <bool IsRelativistic>
+typename Tabulated3D<IsRelativistic>::State
+Tabulated3D<IsRelativistic>::interpolate(
+    const std::pair<size_t, double>& density_location,
+    const std::pair<size_t, double>& temperature_location) const noexcept {
+  const size_t electron_fraction_stride =
+      number_of_densities_ * number_of_temperatures_;
+  const size_t lower =
+      density_location.first +
+      number_of_densities_ * temperature_location.first +
+      electron_fraction_stride * electron_fraction_index_;
+  const double density_weight = density_location.second;
+  const double temperature_weight = temperature_location.second;
+  const double inverse_log_temperature_spacing =
+      1.0 / (table_->log_temperature[temperature_location.first + 1] -
+             table_->log_temperature[temperature_location.first]);
+
+  // The value and derivatives of a quantity that is bilinear in the density and
+  // temperature once interpolated to the electron fraction
+  const auto bilinear = [this, lower, electron_fraction_stride, density_weight,
+                         temperature_weight, inverse_log_temperature_spacing](
+                            const std::vector<double>& quantity) noexcept {
+    const auto corner = [this, &quantity, lower, electron_fraction_stride](
+                            const size_t offset) noexcept {
+      return (1.0 - electron_fraction_weight_) * quantity[lower + offset] +
+             electron_fraction_weight_ *
+                 quantity[lower + offset + electron_fraction_stride];
+    };
+    const double lower_lower = corner(0);
+    const double upper_lower = corner(1);
+    const double lower_upper = corner(number_of_densities_);
+    const double upper_upper = corner(number_of_densities_ + 1);
+    return std::array<double, 3>{
+        {(1.0 - temperature_weight) * ((1.0 - density_weight) * lower_lower +
+                                       density_weight * upper_lower) +
+             temperature_weight * ((1.0 - density_weight) * lower_upper +
+                                   density_weight * upper_upper),
+         ((1.0 - temperature_weight) * (upper_lower - lower_lower) +
+          temperature_weight * (upper_upper - lower_upper)) *
+             inverse_log_density_spacing_,
+         ((1.0 - density_weight) * (lower_upper - lower_lower) +
+          density_weight * (upper_upper - upper_lower)) *
+             inverse_log_temperature_spacing}};
+  };
+  const auto pressure = bilinear(table_->log_pressure);
+  const auto energy = bilinear(table_->log_shifted_specific_internal_energy);
+  return {pressure[0], energy[0], pressure[1],
+          pressure[2], energy[1], energy[2]};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::pressure_from_density_and_energy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_internal_energy) const noexcept {
+  using std::log10;
+  const DataType log_density{log10(get(rest_mass_density))};
+  const DataType log_shifted_energy{
+      log10(get(specific_internal_energy) + table_->energy_shift)};
+  auto log_pressure = make_with_value<DataType>(log_density, 0.0);
+  size_t cached_cell = 0;
+  for (size_t s = 0; s < get_size(log_density); ++s) {
+    const auto cell = density_cell(get_element(log_density, s));
+    get_element(log_pressure, s) =
+        interpolate(cell, invert_in_temperature(
+                              table_->log_shifted_specific_internal_energy,
+                              cell, get_element(log_shifted_energy, s),
+                              make_not_null(&cached_cell)))
+            .log_pressure;
+  }
+  return Scalar<DataType>{power_of_ten(log_pressure)};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::pressure_from_density_and_enthalpy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_enthalpy) const noexcept {
+  using std::log10;
+  const DataType log_density{log10(get(rest_mass_density))};
+  auto log_pressure = make_with_value<DataType>(log_density, 0.0);
+  size_t cached_cell = 0;
+  for (size_t s = 0; s < get_size(log_density); ++s) {
+    const double density = get_element(get(rest_mass_density), s);
+    const double target = get_element(get(specific_enthalpy), s);
+    const auto cell = density_cell(get_element(log_density, s));
+    const auto enthalpy = [this, density](const State& state) noexcept {
+      return 1.0 + power_of_ten(state.log_shifted_energy) -
+             table_->energy_shift +
+             power_of_ten(state.log_pressure) / density;
+    };
+    // The specific enthalpy increases with the temperature, but is not linear
+    // in log10(T) within a cell, so the cell is found from the values at the
+    // nodes and the weight by root finding
+    const size_t temperature_index = temperature_cell(
+        [this, &enthalpy, &cell](const size_t index) noexcept {
+          return index == number_of_temperatures_ - 1
+                     ? enthalpy(interpolate(cell, {index - 1, 1.0}))
+                     : enthalpy(interpolate(cell, {index, 0.0}));
+        },
+        target, make_not_null(&cached_cell));
+    const auto residual = [this, &enthalpy, &cell, temperature_index,
+                           target](const double weight) noexcept {
+      return enthalpy(interpolate(cell, {temperature_index, weight})) - target;
+    };
+    const double residual_at_lower = residual(0.0);
+    const double residual_at_upper = residual(1.0);
+    double temperature_weight = 0.0;
+    if (residual_at_lower >= 0.0) {
+      temperature_weight = 0.0;
+    } else if (residual_at_upper <= 0.0) {
+      temperature_weight = 1.0;
+    } else {
+      temperature_weight =
+          RootFinder::toms748(residual, 0.0, 1.0, residual_at_lower,
+                              residual_at_upper, 1.0e-14, 1.0e-14);
+    }
+    get_element(log_pressure, s) =
+        interpolate(cell, {temperature_index, temperature_weight})
+            .log_pressure;
+  }
+  return Scalar<DataType>{power_of_ten(log_pressure)};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType>
+Tabulated3D<IsRelativistic>::specific_enthalpy_from_density_and_energy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_internal_energy) const noexcept {
+  const auto pressure = pressure_from_density_and_energy_impl(
+      rest_mass_density, specific_internal_energy);
+  return Scalar<DataType>{1.0 + get(specific_internal_energy) +
+                          get(pressure) / get(rest_mass_density)};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType> Tabulated3D<IsRelativistic>::
+    specific_internal_energy_from_density_and_pressure_impl(
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& pressure) const noexcept {
+  using std::log10;
+  const DataType log_density{log10(get(rest_mass_density))};
+  const DataType log_pressure{log10(get(pressure))};
+  auto log_shifted_energy = make_with_value<DataType>(log_density, 0.0);
+  size_t cached_cell = 0;
+  for (size_t s = 0; s < get_size(log_density); ++s) {
+    const auto cell = density_cell(get_element(log_density, s));
+    get_element(log_shifted_energy, s) =
+        interpolate(cell, invert_in_temperature(table_->log_pressure, cell,
+                                                get_element(log_pressure, s),
+                                                make_not_null(&cached_cell)))
+            .log_shifted_energy;
+  }
+  return Scalar<DataType>{power_of_ten(log_shifted_energy) -
+                          table_->energy_shift};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType> Tabulated3D<IsRelativistic>::chi_from_density_and_energy_impl(
+    const Scalar<DataType>& rest_mass_density,
+    const Scalar<DataType>& specific_internal_energy) const noexcept {
+  using std::log10;
+  const DataType log_density{log10(get(rest_mass_density))};
+  const DataType log_shifted_energy{
+      log10(get(specific_internal_energy) + table_->energy_shift)};
+  auto log_pressure = make_with_value<DataType>(log_density, 0.0);
+  // d log10(p) / d log10(rho) at constant specific internal energy
+  auto d_log_pressure = make_with_value<DataType>(log_density, 0.0);
+  size_t cached_cell = 0;
+  for (size_t s = 0; s < get_size(log_density); ++s) {
+    const auto cell = density_cell(get_element(log_density, s));
+    const auto state = interpolate(
+        cell,
+        invert_in_temperature(table_->log_shifted_specific_internal_energy,
+                              cell, get_element(log_shifted_energy, s),
+                              make_not_null(&cached_cell)));
+    get_element(log_pressure, s) = state.log_pressure;
+    get_element(d_log_pressure, s) =
+        state.d_log_pressure_d_log_density -
+        d_log_pressure_d_log_energy(
+            state.d_log_pressure_d_log_temperature,
+            state.d_log_shifted_energy_d_log_temperature) *
+            state.d_log_shifted_energy_d_log_density;
+  }
+  return Scalar<DataType>{power_of_ten(log_pressure) * d_log_pressure /
+                          get(rest_mass_density)};
+}
+
+template <bool IsRelativistic>
+template <class DataType>
+Scalar<DataType> Tabulated3D<IsRelativistic>::
+    kappa_times_p_over_rho_squared_from_density_and_energy_impl(
+        const Scalar<DataType>& rest_mass_density,
+        const Scalar<DataType>& specific_internal_energy) const noexcept {
+  using std::log10;
+  const DataType log_density{log10(get(rest_mass_density))};
+  const DataType shifted_energy{get(specific_internal_energy) +
+                                table_->energy_shift};
+  const DataType log_shifted_energy{log10(shifted_energy)};
+  auto log_pressure = make_with_value<DataType>(log_density, 0.0);
+  // d log10(p) / d log10(eps + eps_shift) at constant density
+  auto d_log_pressure = make_with_value<DataType>(log_density, 0.0);
+  size_t cached_cell = 0;
+  for (size_t s = 0; s < get_size(log_density); ++s) {
+    const auto cell = density_cell(get_element(log_density, s));
+    const auto state = interpolate(
+        cell,
+        invert_in_temperature(table_->log_shifted_specific_internal_energy,
+                              cell, get_element(log_shifted_energy, s),
+                              make_not_null(&cached_cell)));
+    get_element(log_pressure, s) = state.log_pressure;
+    get_element(d_log_pressure, s) = d_log_pressure_d_log_energy(
+        state.d_log_pressure_d_log_temperature,
+        state.d_log_shifted_energy_d_log_temperature);
+  }
+  return Scalar<DataType>{square(power_of_ten(log_pressure)) * d_log_pressure /
+                          (shifted_energy * square(get(rest_mass_density)))};
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::rest_mass_density_lower_bound() const
+    noexcept {
+  return power_of_ten(table_->log_rest_mass_density.front());
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::rest_mass_density_upper_bound() const
+    noexcept {
+  return power_of_ten(table_->log_rest_mass_density.back());
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::specific_internal_energy_lower_bound(
+    const double rest_mass_density) const noexcept {
+  return power_of_ten(value_at_temperature(
+             table_->log_shifted_specific_internal_energy,
+             density_cell(std::log10(rest_mass_density)), 0)) -
+         table_->energy_shift;
+}
+
+template <bool IsRelativistic>
+double Tabulated3D<IsRelativistic>::specific_internal_energy_upper_bound(
+    const double rest_mass_density) const noexcept {
+  return power_of_ten(value_at_temperature(
+             table_->log_shifted_specific_internal_energy,
+             density_cell(std::log10(rest_mass_density)),
+             number_of_temperatures_ - 1)) -
+         table_->energy_shift;
+}
+}  // namespace EquationsOfState
+
+template class EquationsOfState::Tabulated3D<true>;
@@ -0,0 +1,257 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/preprocessor/arithmetic/dec.hpp>
+#include <boost/preprocessor/arithmetic/inc.hpp>
+#include <boost/preprocessor/control/expr_iif.hpp>
+#include <boost/preprocessor/list/adt.hpp>
+#include <boost/preprocessor/repetition/for.hpp>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/tuple/to_list.hpp>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <pup.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+/// \endcond
+
+namespace EquationsOfState {
+/*!
+ * \ingroup EquationsOfStateGroup
+ * \brief The data of a `Tabulated3D` equation of state.
+ *
+ * All quantities are in geometric units \f$G=c=M_\odot=1\f$, except for the
+ * temperature which is in MeV. The 3D datasets are stored with the density
+ * index running fastest, then the temperature index, then the electron
+ * fraction index, i.e. in the order of the datasets in the
+ * [stellarcollapse.org](https://stellarcollapse.org) tables.
+ */
+struct Tabulated3DTable {
+  /// \f$\log_{10}\rho\f$ on a uniformly spaced grid
+  std::vector<double> log_rest_mass_density{};
+  /// \f$\log_{10}T\f$, monotonically increasing
+  std::vector<double> log_temperature{};
+  /// \f$Y_e\f$, monotonically increasing
+  std::vector<double> electron_fraction{};
+  /// \f$\log_{10}p\f$
+  std::vector<double> log_pressure{};
+  /// \f$\log_{10}(\epsilon + \epsilon_\mathrm{shift})\f$
+  std::vector<double> log_shifted_specific_internal_energy{};
+  /// \f$\epsilon_\mathrm{shift}\f$, which makes the shifted specific internal
+  /// energy positive everywhere in the table
+  double energy_shift = std::numeric_limits<double>::signaling_NaN();
+
+  // clang-tidy: no non-const references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+};
+
+/*!
+ * \ingroup EquationsOfStateGroup
+ * \brief Read a table in the format of
+ * [stellarcollapse.org](https://stellarcollapse.org) (see
+ * `h5::StellarCollapseEos`) and convert it to geometric units.
+ *
+ * Tables are cached by file name and subgroup, so every `Tabulated3D` on a
+ * node that is constructed from the same file shares a single read-only copy
+ * of the table, which is read from disk only once and released when the last
+ * equation of state that uses it is destroyed.
+ */
+std::shared_ptr<const Tabulated3DTable> read_stellar_collapse_table(
+    const std::string& filename, const std::string& subgroup) noexcept;
+
+/*!
+ * \ingroup EquationsOfStateGroup
+ * \brief Tabulated equation of state depending on the rest mass density
+ * \f$\rho\f$, the temperature \f$T\f$, and the electron fraction \f$Y_e\f$.
+ *
+ * The pressure \f$p\f$ and the shifted specific internal energy
+ * \f$\epsilon+\epsilon_\mathrm{shift}\f$ are interpolated trilinearly in
+ * \f$(\log_{10}\rho, \log_{10}T, Y_e)\f$ from a `Tabulated3DTable`, in the log
+ * of the quantities. Since the `EquationOfState` interface takes the specific
+ * internal energy instead of the temperature, the temperature is found by
+ * inverting the interpolated \f$\epsilon(\log_{10}T)\f$, which is linear in
+ * each table cell and therefore inverted exactly. The same is done for the
+ * pressure when computing the specific internal energy from the pressure. The
+ * table must therefore be monotonically increasing in the temperature at
+ * fixed density and electron fraction.
+ *
+ * The electron fraction is held fixed at the value passed to the constructor
+ * for now, since the interface of a two-dimensional equation of state can't
+ * pass it. Values outside of the table are evaluated at the table boundary.
+ *
+ * To make the interpolation cheap:
+ * - The density grid must be uniformly spaced in \f$\log_{10}\rho\f$, so the
+ *   density cell of a point is computed directly rather than searched for.
+ * - The electron fraction cell and weight are computed once on construction.
+ * - Neighboring grid points tend to lie in the same temperature cell, so the
+ *   temperature cell of the previous point is tried before searching.
+ * - The logarithms and exponentials of all points are taken with vectorized
+ *   `DataVector` operations before and after the per-point table lookups.
+ *
+ * The table is held through a `std::shared_ptr` to const data. Copies of the
+ * equation of state share the table, and equations of state constructed from
+ * a file share it with all others on the node that read the same file (see
+ * `read_stellar_collapse_table`). When serialized, only the file name is
+ * sent for tables read from a file.
+ */
+template <bool IsRelativistic>
+class Tabulated3D : public EquationOfState<IsRelativistic, 2> {
+ public:
+  static constexpr size_t thermodynamic_dim = 2;
+  static constexpr bool is_relativistic = IsRelativistic;
+  static_assert(IsRelativistic,
+                "Tabulated equations of state are only supported in a "
+                "relativistic setting.");
+
+  struct TableFilename {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "Path to a table in the format of stellarcollapse.org"};
+  };
+
+  struct TableSubgroup {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "Group in the file that holds the table, e.g. '/'"};
+  };
+
+  struct ElectronFraction {
+    using type = double;
+    static constexpr Options::String help = {
+        "The electron fraction Y_e at which the table is evaluated"};
+    static double lower_bound() noexcept { return 0.0; }
+    static double upper_bound() noexcept { return 1.0; }
+  };
+
+  static constexpr Options::String help = {
+      "A tabulated equation of state.\n"
+      "The pressure and specific internal energy are interpolated trilinearly "
+      "in the log of the rest mass density, the log of the temperature, and "
+      "the electron fraction from a table in the format of "
+      "stellarcollapse.org. The electron fraction is held fixed."};
+
+  using options = tmpl::list<TableFilename, TableSubgroup, ElectronFraction>;
+
+  Tabulated3D() = default;
+  Tabulated3D(const Tabulated3D&) = default;
+  Tabulated3D& operator=(const Tabulated3D&) = default;
+  Tabulated3D(Tabulated3D&&) = default;
+  Tabulated3D& operator=(Tabulated3D&&) = default;
+  ~Tabulated3D() override = default;
+
+  Tabulated3D(std::string table_filename, std::string table_subgroup,
+              double electron_fraction) noexcept;
+
+  Tabulated3D(std::shared_ptr<const Tabulated3DTable> table,
+              double electron_fraction) noexcept;
+
+  EQUATION_OF_STATE_FORWARD_DECLARE_MEMBERS(Tabulated3D, 2)
+
+  WRAPPED_PUPable_decl_base_template(  // NOLINT
+      SINGLE_ARG(EquationOfState<IsRelativistic, 2>), Tabulated3D);
+
+  /// The lower bound of the rest mass density that is valid for this EOS
+  double rest_mass_density_lower_bound() const noexcept override;
+
+  /// The upper bound of the rest mass density that is valid for this EOS
+  double rest_mass_density_upper_bound() const noexcept override;
+
+  /// The lower bound of the specific internal energy that is valid for this EOS
+  /// at the given rest mass density \f$\rho\f$
+  double specific_internal_energy_lower_bound(double rest_mass_density) const
+      noexcept override;
+
+  /// The upper bound of the specific internal energy that is valid for this EOS
+  /// at the given rest mass density \f$\rho\f$
+  double specific_internal_energy_upper_bound(double rest_mass_density) const
+      noexcept override;
+
+  /// The lower bound of the specific enthalpy that is valid for this EOS
+  double specific_enthalpy_lower_bound() const noexcept override {
+    return specific_enthalpy_lower_bound_;
+  }
+
+ private:
+  EQUATION_OF_STATE_FORWARD_DECLARE_MEMBER_IMPLS(2)
+
+  // The interpolated state within a cell of the table at the electron
+  // fraction `electron_fraction_`. The derivatives are with respect to
+  // log10(rho) and log10(T).
+  struct State {
+    double log_pressure;
+    double log_shifted_energy;
+    double d_log_pressure_d_log_density;
+    double d_log_pressure_d_log_temperature;
+    double d_log_shifted_energy_d_log_density;
+    double d_log_shifted_energy_d_log_temperature;
+  };
+
+  void initialize_interpolation() noexcept;
+
+  // The density cell and the weight of its upper neighbor
+  std::pair<size_t, double> density_cell(double log_density) const noexcept;
+
+  // The quantity interpolated in density and electron fraction at the
+  // temperature index `temperature_index`
+  double value_at_temperature(
+      const std::vector<double>& quantity,
+      const std::pair<size_t, double>& density_location,
+      size_t temperature_index) const noexcept;
+
+  // The temperature cell in which `value_at_node(index)` brackets `target`.
+  // The values must increase with the index. `cached_cell` is tried first and
+  // is updated to the cell that was found.
+  template <typename ValueAtNode>
+  size_t temperature_cell(const ValueAtNode& value_at_node, double target,
+                          gsl::not_null<size_t*> cached_cell) const noexcept;
+
+  // The temperature cell and weight of its upper neighbor at which the
+  // `quantity`, which must be linear in log10(T) within each cell, is
+  // `target`
+  std::pair<size_t, double> invert_in_temperature(
+      const std::vector<double>& quantity,
+      const std::pair<size_t, double>& density_location, double target,
+      gsl::not_null<size_t*> cached_cell) const noexcept;
+
+  State interpolate(
+      const std::pair<size_t, double>& density_location,
+      const std::pair<size_t, double>& temperature_location) const noexcept;
+
+  std::string table_filename_{};
+  std::string table_subgroup_{};
+  double electron_fraction_ = std::numeric_limits<double>::signaling_NaN();
+  std::shared_ptr<const Tabulated3DTable> table_{};
+
+  // Derived from the table and the electron fraction
+  size_t number_of_densities_ = 0;
+  size_t number_of_temperatures_ = 0;
+  double log_density_lower_bound_ =
+      std::numeric_limits<double>::signaling_NaN();
+  double inverse_log_density_spacing_ =
+      std::numeric_limits<double>::signaling_NaN();
+  size_t electron_fraction_index_ = 0;
+  double electron_fraction_weight_ =
+      std::numeric_limits<double>::signaling_NaN();
+  double specific_enthalpy_lower_bound_ =
+      std::numeric_limits<double>::signaling_NaN();
+};
+
+/// \cond
+template <bool IsRelativistic>
+PUP::able::PUP_ID EquationsOfState::Tabulated3D<IsRelativistic>::my_PUP_ID = 0;
+/// \endcond
+}  // namespace EquationsOfState
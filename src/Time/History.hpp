@@ -3,11 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-#include <deque>
 #include <iterator>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
@@ -27,6 +28,11 @@ class HistoryIterator;
 
 /// \ingroup TimeSteppersGroup
 /// History data used by a TimeStepper.
+///
+/// The entries are held in a ring buffer. Entries that are marked as unneeded
+/// are kept, and their storage is reused by later insertions, so once the
+/// history has reached the size needed by the time stepper, inserting a new
+/// entry neither allocates nor moves entries.
 /// \tparam Vars type of variables being integrated
 /// \tparam DerivVars type of derivative variables
 template <typename Vars, typename DerivVars>
@@ -73,11 +79,11 @@ class History {
   /// HistoryIterator::derivative().
   /// @{
   const_iterator begin() const noexcept {
-    return data_.begin() +
-           static_cast<typename decltype(data_.begin())::difference_type>(
-               first_needed_entry_);
+    return {&data_, start_, static_cast<difference_type>(first_needed_entry_)};
+  }
+  const_iterator end() const noexcept {
+    return {&data_, start_, static_cast<difference_type>(data_.size())};
   }
-  const_iterator end() const noexcept { return data_.end(); }
   const_iterator cbegin() const noexcept { return begin(); }
   const_iterator cend() const noexcept { return end(); }
   /// @}
@@ -94,9 +100,7 @@ class History {
   }
 
   const_reference front() const noexcept { return *begin(); }
-  const_reference back() const noexcept {
-    return std::get<0>(data_.back()).substep_time();
-  }
+  const_reference back() const noexcept { return *(end() - 1); }
   /// @}
 
   /// Get or set the current order of integration.  TimeSteppers may
@@ -120,8 +124,13 @@ class History {
   }
 
  private:
+  // Rotate the entries so the oldest one is at the start of `data_`
+  void linearize() noexcept;
+
   Vars most_recent_value_{};
-  std::deque<std::tuple<TimeStepId, DerivVars>> data_;
+  // The oldest entry is at `start_`
+  std::vector<std::tuple<TimeStepId, DerivVars>> data_;
+  size_t start_{0};
   size_t first_needed_entry_{0};
   size_t integration_order_{0};
 };
@@ -131,58 +140,66 @@ class History {
 /// details.
 template <typename Vars, typename DerivVars>
 class HistoryIterator {
-  using Base =
-      typename std::deque<std::tuple<TimeStepId, DerivVars>>::const_iterator;
+  using Entry = std::tuple<TimeStepId, DerivVars>;
 
  public:
-  using iterator_category =
-      typename std::iterator_traits<Base>::iterator_category;
+  using iterator_category = std::random_access_iterator_tag;
   using value_type = Time;
-  using difference_type = typename std::iterator_traits<Base>::difference_type;
+  using difference_type = std::ptrdiff_t;
   using pointer = const value_type*;
   using reference = const value_type&;
 
   HistoryIterator() = default;
 
   reference operator*() const noexcept {
-    return std::get<0>(*base_).substep_time();
+    return std::get<0>(entry(index_)).substep_time();
   }
   pointer operator->() const noexcept { return &**this; }
   reference operator[](const difference_type n) const noexcept {
-    return std::get<0>(base_[n]).substep_time();
+    return std::get<0>(entry(index_ + n)).substep_time();
   }
-  HistoryIterator& operator++() noexcept { ++base_; return *this; }
+  HistoryIterator& operator++() noexcept { ++index_; return *this; }
   // clang-tidy: return const... Really? What?
-  HistoryIterator operator++(int) noexcept { return base_++; }  // NOLINT
-  HistoryIterator& operator--() noexcept { --base_; return *this; }
+  HistoryIterator operator++(int) noexcept {  // NOLINT
+    auto result = *this;
+    ++index_;
+    return result;
+  }
+  HistoryIterator& operator--() noexcept { --index_; return *this; }
   // clang-tidy: return const... Really? What?
-  HistoryIterator operator--(int) noexcept { return base_--; }  // NOLINT
+  HistoryIterator operator--(int) noexcept {  // NOLINT
+    auto result = *this;
+    --index_;
+    return result;
+  }
   HistoryIterator& operator+=(difference_type n) noexcept {
-    base_ += n;
+    index_ += n;
     return *this;
   }
   HistoryIterator& operator-=(difference_type n) noexcept {
-    base_ -= n;
+    index_ -= n;
     return *this;
   }
 
   const TimeStepId& time_step_id() const noexcept {
-    return std::get<0>(*base_);
+    return std::get<0>(entry(index_));
+  }
+  const DerivVars& derivative() const noexcept {
+    return std::get<1>(entry(index_));
   }
-  const DerivVars& derivative() const noexcept { return std::get<1>(*base_); }
 
  private:
   friend class History<Vars, DerivVars>;
 
   friend difference_type operator-(const HistoryIterator& a,
                                    const HistoryIterator& b) noexcept {
-    return a.base_ - b.base_;
+    return a.index_ - b.index_;
   }
 
 #define FORWARD_HISTORY_ITERATOR_OP(op)                        \
   friend bool operator op(const HistoryIterator& a,            \
                           const HistoryIterator& b) noexcept { \
-    return a.base_ op b.base_;                                 \
+    return a.index_ op b.index_;                               \
   }
   FORWARD_HISTORY_ITERATOR_OP(==)
   FORWARD_HISTORY_ITERATOR_OP(!=)
@@ -192,10 +209,19 @@ class HistoryIterator {
   FORWARD_HISTORY_ITERATOR_OP(>=)
 #undef FORWARD_HISTORY_ITERATOR_OP
 
-  // clang-tidy: google-explicit-constructor - private
-  HistoryIterator(Base base) noexcept : base_(std::move(base)) {}  // NOLINT
+  HistoryIterator(const std::vector<Entry>* const data, const size_t start,
+                  const difference_type index) noexcept
+      : data_(data), start_(start), index_(index) {}
 
-  Base base_{};
+  // The entry `index` entries after the oldest one in the ring buffer
+  const Entry& entry(const difference_type index) const noexcept {
+    return (*data_)[(start_ + static_cast<size_t>(index)) % data_->size()];
+  }
+
+  const std::vector<Entry>* data_{nullptr};
+  size_t start_{0};
+  // Index relative to the oldest entry
+  difference_type index_{0};
 };
 
 // ================================================================
@@ -204,15 +230,14 @@ template <typename Vars, typename DerivVars>
 void History<Vars, DerivVars>::insert(const TimeStepId& time_step_id,
                                       const DerivVars& deriv) noexcept {
   if (first_needed_entry_ == 0) {
+    linearize();
     data_.emplace_back(time_step_id, deriv);
   } else {
-    // Reuse resources from an old entry.
-    auto& old_entry = data_.front();
-    // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+    // Reuse resources from the oldest entry, which becomes the newest.
+    auto& old_entry = data_[start_];
     std::get<0>(old_entry) = time_step_id;
     std::get<1>(old_entry) = deriv;
-    data_.push_back(std::move(old_entry));
-    data_.pop_front();
+    start_ = (start_ + 1) % data_.size();
     --first_needed_entry_;
   }
 }
@@ -220,18 +245,20 @@ void History<Vars, DerivVars>::insert(const TimeStepId& time_step_id,
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::insert_initial(TimeStepId time_step_id,
                                                      DerivVars deriv) noexcept {
+  linearize();
   // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
-  data_.emplace_front(std::move(time_step_id), std::move(deriv));
+  data_.emplace(data_.begin(), std::move(time_step_id), std::move(deriv));
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::mark_unneeded(
     const const_iterator& first_needed) noexcept {
-  first_needed_entry_ = static_cast<size_t>(first_needed.base_ - data_.begin());
+  first_needed_entry_ = static_cast<size_t>(first_needed.index_);
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::shrink_to_fit() noexcept {
+  linearize();
   data_.erase(
       data_.begin(),
       data_.begin() +
@@ -240,6 +267,16 @@ inline void History<Vars, DerivVars>::shrink_to_fit() noexcept {
   first_needed_entry_ = 0;
 }
 
+template <typename Vars, typename DerivVars>
+inline void History<Vars, DerivVars>::linearize() noexcept {
+  if (start_ != 0) {
+    std::rotate(data_.begin(),
+                data_.begin() + static_cast<std::ptrdiff_t>(start_),
+                data_.end());
+    start_ = 0;
+  }
+}
+
 template <typename Vars, typename DerivVars>
 inline HistoryIterator<Vars, DerivVars> operator+(
     HistoryIterator<Vars, DerivVars> it,
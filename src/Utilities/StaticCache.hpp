@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <mutex>
 #include <utility>
 
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -187,3 +189,79 @@ auto make_static_cache(Generator&& generator) noexcept {
   return StaticCache<std::remove_cv_t<Generator>, CachedType, Ranges...>(
       std::forward<Generator>(generator));
 }
+
+/// \ingroup UtilitiesGroup
+/// A cache of objects keyed on values that are only known at runtime, intended
+/// to be stored in a static variable.
+///
+/// Objects are retrieved by passing a key, compared with `==`, and a generator
+/// that constructs the object if it is not in the cache yet. All threads of a
+/// process (i.e. of a node in SMP builds) share a static cache. Entries are
+/// prepended to a linked list and are never modified or removed, so lookups
+/// walk the list without locking and only the insertion of a missing entry is
+/// serialized. References to cached objects stay valid for the lifetime of the
+/// cache. Lookups are a linear search, so the cache is meant for the handful of
+/// distinct keys that occur in a run, e.g. the meshes of a domain.
+///
+/// \example
+/// \snippet Test_StaticCache.cpp keyed_static_cache
+///
+/// \see StaticCache
+template <typename Key, typename T>
+class KeyedStaticCache {
+ public:
+  KeyedStaticCache() = default;
+  KeyedStaticCache(const KeyedStaticCache&) = delete;
+  KeyedStaticCache& operator=(const KeyedStaticCache&) = delete;
+  KeyedStaticCache(KeyedStaticCache&&) = delete;
+  KeyedStaticCache& operator=(KeyedStaticCache&&) = delete;
+  ~KeyedStaticCache() noexcept {
+    const Entry* entry = head_.load(std::memory_order_acquire);
+    while (entry != nullptr) {
+      const Entry* const next = entry->next;
+      delete entry;  // NOLINT(cppcoreguidelines-owning-memory)
+      entry = next;
+    }
+  }
+
+  /// The cached object for the `key`, which is constructed by invoking the
+  /// `generator` without arguments if it is not in the cache yet
+  template <typename Generator>
+  const T& operator()(const Key& key, Generator&& generator) const noexcept {
+    if (const Entry* const entry = find(head_.load(std::memory_order_acquire),
+                                        key);
+        entry != nullptr) {
+      return entry->value;
+    }
+    const std::lock_guard<std::mutex> lock{insertion_mutex_};
+    // Another thread may have inserted the entry while we waited for the lock
+    const Entry* const head = head_.load(std::memory_order_acquire);
+    if (const Entry* const entry = find(head, key); entry != nullptr) {
+      return entry->value;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    const auto* const new_entry =
+        new Entry{key, std::forward<Generator>(generator)(), head};
+    head_.store(new_entry, std::memory_order_release);
+    return new_entry->value;
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    T value;
+    const Entry* next;
+  };
+
+  static const Entry* find(const Entry* entry, const Key& key) noexcept {
+    for (; entry != nullptr; entry = entry->next) {
+      if (entry->key == key) {
+        break;
+      }
+    }
+    return entry;
+  }
+
+  mutable std::atomic<const Entry*> head_{nullptr};
+  mutable std::mutex insertion_mutex_{};
+};
@@ -271,7 +271,7 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
   // The initial guess for the horizon search is a sphere of radius 2.8M.
   intrp::OptionHolders::ApparentHorizon<Frame::Inertial> apparent_horizon_opts(
       Strahlkorper<Frame::Inertial>{l_max, 2.8, {{0.0, 0.0, 0.0}}}, FastFlow{},
-      Verbosity::Verbose);
+      0, Verbosity::Verbose);
 
   std::unique_ptr<DomainCreator<3>> domain_creator;
   std::unique_ptr<ActionTesting::MockRuntimeSystem<metavars>> runner_ptr{};
@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <random>
+#include <utility>
+
+#include "ApparentHorizons/ExtrapolateStrahlkorperInTime.hpp"
+#include "ApparentHorizons/SpherepackIterator.hpp"
+#include "ApparentHorizons/Strahlkorper.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+
+void test_extrapolate_strahlkorper_in_time() noexcept {
+  const std::array<double, 3> center{{0.1, 0.2, 0.3}};
+  const size_t l_max = 8;
+  std::uniform_real_distribution<double> interval_dis(-1.0, 1.0);
+  MAKE_GENERATOR(gen);
+
+  // The coefficients of the surface are a quadratic function of time.
+  const Strahlkorper<Frame::Inertial> sphere(l_max, l_max, 2.0, center);
+  std::array<DataVector, 3> coefs_derivs{};
+  for (size_t deriv = 0; deriv < 3; ++deriv) {
+    gsl::at(coefs_derivs, deriv) =
+        deriv == 0 ? sphere.coefficients()
+                   : DataVector(sphere.coefficients().size(), 0.0);
+    for (SpherepackIterator it(l_max, l_max); it; ++it) {
+      gsl::at(coefs_derivs, deriv)[it()] +=
+          0.1 * interval_dis(gen) * exp(-static_cast<double>(it.l()));
+    }
+  }
+  const auto surface_at = [&coefs_derivs, &sphere](
+                              const double time,
+                              const size_t derivs) noexcept {
+    DataVector coefs = gsl::at(coefs_derivs, 0);
+    for (size_t deriv = 1; deriv <= derivs; ++deriv) {
+      coefs += pow(time, static_cast<double>(deriv)) *
+               gsl::at(coefs_derivs, deriv);
+    }
+    return Strahlkorper<Frame::Inertial>(coefs, sphere);
+  };
+
+  for (size_t derivs = 0; derivs < 3; ++derivs) {
+    std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>
+        previous_strahlkorpers{};
+    for (const double time : {1.0, 1.5, 2.5}) {
+      if (previous_strahlkorpers.size() == derivs + 1) {
+        break;
+      }
+      previous_strahlkorpers.emplace_front(time, surface_at(time, derivs));
+    }
+    const auto expected = surface_at(3.0, derivs);
+    const auto extrapolated =
+        extrapolate_strahlkorper_in_time(previous_strahlkorpers, 3.0);
+    CHECK(extrapolated.l_max() == l_max);
+    CHECK(extrapolated.center() == center);
+    CHECK_ITERABLE_APPROX(extrapolated.coefficients(), expected.coefficients());
+
+    // Older surfaces at a different resolution are prolonged or restricted
+    // to the resolution of the newest one.
+    previous_strahlkorpers.back().second = Strahlkorper<Frame::Inertial>(
+        l_max + 4, l_max + 4, previous_strahlkorpers.back().second);
+    const auto extrapolated_from_mixed_resolutions =
+        extrapolate_strahlkorper_in_time(previous_strahlkorpers, 3.0);
+    CHECK(extrapolated_from_mixed_resolutions.l_max() ==
+          previous_strahlkorpers.front().second.l_max());
+    CHECK_ITERABLE_APPROX(
+        Strahlkorper<Frame::Inertial>(
+            l_max, l_max, extrapolated_from_mixed_resolutions)
+            .coefficients(),
+        expected.coefficients());
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.ApparentHorizons.ExtrapolateStrahlkorperInTime",
+                  "[ApparentHorizons][Unit]") {
+  test_extrapolate_strahlkorper_in_time();
+}
+}  // namespace
@@ -7,6 +7,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <random>
 #include <string>
 #include <utility>
@@ -95,9 +96,10 @@ void test_construct_from_options_fast() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
-  CHECK(created ==
-        FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6, 200));
+      "MaxIts: 200\n"
+      "InitialLMax: 4");
+  CHECK(created == FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3,
+                            1.1, 6, 200, 4));
 }
 
 void test_construct_from_options_jacobi() {
@@ -109,7 +111,8 @@ void test_construct_from_options_jacobi() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3,
                             1.1, 6, 200));
 }
@@ -123,14 +126,15 @@ void test_construct_from_options_curvature() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Curvature, 1.1, 0.6, 1e-10,
                             1e-3, 1.1, 6, 200));
 }
 
 void test_serialize() noexcept {
   FastFlow fastflow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6,
-                    200);
+                    200, 4);
   test_serialization(fastflow);
 }
 
@@ -231,15 +235,25 @@ void test_schwarzschild(FastFlow::Flow::type type_of_flow,
 }
 
 void test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
-               const size_t max_iterations) {
+               const size_t max_iterations,
+               const std::optional<size_t> initial_l_max = std::nullopt) {
   Strahlkorper<Frame::Inertial> strahlkorper(8, 8, 2.0 * mass, {{0, 0, 0}});
-  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations);
+  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations,
+                initial_l_max);
 
   const std::array<double, 3> spin = {{0.1, 0.2, 0.3}};
   const gr::Solutions::KerrSchild solution(mass, spin, {{0., 0., 0.}});
 
+  CHECK(flow.current_l_surface(strahlkorper) == initial_l_max.value_or(8));
   const auto status = do_iteration(&strahlkorper, &flow, solution);
   CHECK(converged(status));
+  // The horizon is found at full resolution even if the finder started
+  // at a lower resolution.
+  CHECK(strahlkorper.l_max() == 8);
+  CHECK(flow.current_l_surface(strahlkorper) == 8);
+  CHECK(flow.current_l_mesh(strahlkorper) == 12);
+  flow.reset_for_next_find();
+  CHECK(flow.current_l_surface(strahlkorper) == initial_l_max.value_or(8));
 
   const double spin_magnitude =
       sqrt(square(spin[0]) + square(spin[1]) + square(spin[2]));
@@ -291,6 +305,11 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowKerr", "[Utilities][Unit]") {
   test_kerr(FastFlow::FlowType::Fast, 2.0, 100);
 }
 
+SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowKerrInitialLMax",
+                  "[Utilities][Unit]") {
+  test_kerr(FastFlow::FlowType::Fast, 2.0, 100, 4);
+}
+
 SPECTRE_TEST_CASE("Unit.ApparentHorizons.JacobiKerr", "[Utilities][Unit]") {
   // Keep mass at 1.0 so test doesn't timeout.
   test_kerr(FastFlow::FlowType::Jacobi, 1.0, 200);
@@ -324,7 +343,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowOptFail",
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 0.5\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
 }
 
 // [[OutputRegex, Failed to convert "Crud" to FastFlow::FlowType]]
@@ -339,5 +359,6 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.FastFlowOptFail2",
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
 }
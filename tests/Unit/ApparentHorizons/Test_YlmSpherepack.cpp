@@ -13,6 +13,7 @@
 #include "ApparentHorizons/YlmSpherepack.hpp"
 #include "ApparentHorizons/YlmSpherepackHelper.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/ApparentHorizons/YlmTestFunctions.hpp"
 #include "Utilities/Gsl.hpp"
@@ -150,6 +151,68 @@ void test_loop_over_offset(
   }
 }
 
+void test_batch(const size_t l_max, const size_t m_max) {
+  const YlmSpherepack ylm_spherepack(l_max, m_max);
+  const size_t physical_size = ylm_spherepack.physical_size();
+  const size_t spectral_size = ylm_spherepack.spectral_size();
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+  const std::array<DataVector, 3> fields{
+      {YlmTestFunctions::FuncA{}.func(theta, phi),
+       YlmTestFunctions::FuncB{}.func(theta, phi),
+       YlmTestFunctions::FuncC{}.func(theta, phi)}};
+
+  for (size_t number_of_fields = 1; number_of_fields <= 3;
+       ++number_of_fields) {
+    DataVector u(number_of_fields * physical_size);
+    for (size_t k = 0; k < number_of_fields; ++k) {
+      for (size_t s = 0; s < physical_size; ++s) {
+        u[s + k * physical_size] = gsl::at(fields, k)[s];
+      }
+    }
+
+    const auto u_spec = ylm_spherepack.phys_to_spec_batch(u, number_of_fields);
+    const auto u_test =
+        ylm_spherepack.spec_to_phys_batch(u_spec, number_of_fields);
+    const auto du = ylm_spherepack.gradient_batch(u, number_of_fields);
+    CHECK(u_spec.size() == number_of_fields * spectral_size);
+    CHECK(u_test.size() == number_of_fields * physical_size);
+    CHECK(get<0>(du).size() == number_of_fields * physical_size);
+
+    // Each field of the batch agrees with the single-field transforms.
+    for (size_t k = 0; k < number_of_fields; ++k) {
+      const auto expected_spec =
+          ylm_spherepack.phys_to_spec(gsl::at(fields, k));
+      const auto expected_phys = ylm_spherepack.spec_to_phys(expected_spec);
+      const auto expected_du = ylm_spherepack.gradient(gsl::at(fields, k));
+      for (size_t s = 0; s < spectral_size; ++s) {
+        CHECK(u_spec[s + k * spectral_size] == approx(expected_spec[s]));
+      }
+      for (size_t s = 0; s < physical_size; ++s) {
+        CHECK(u_test[s + k * physical_size] == approx(expected_phys[s]));
+        CHECK(get<0>(du)[s + k * physical_size] ==
+              approx(get<0>(expected_du)[s]));
+        CHECK(get<1>(du)[s + k * physical_size] ==
+              approx(get<1>(expected_du)[s]));
+      }
+    }
+  }
+}
+
+void test_shared_storage() {
+  // The work arrays depend only on the resolution, so they are shared
+  // between all instances with the same l_max and m_max.
+  const YlmSpherepack ylm_a(6, 4);
+  const YlmSpherepack ylm_b(6, 4);
+  const YlmSpherepack ylm_c(6, 5);
+  const auto ylm_a_copy = ylm_a;
+  CHECK(&ylm_a.integration_weights() == &ylm_b.integration_weights());
+  CHECK(&ylm_a.theta_points() == &ylm_a_copy.theta_points());
+  CHECK(&ylm_a.integration_weights() != &ylm_c.integration_weights());
+  CHECK(YlmSpherepack_detail::cached_storage(6, 4) ==
+        YlmSpherepack_detail::cached_storage(6, 4));
+}
+
 void test_theta_phi_points(
     const size_t l_max, const size_t m_max,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -656,7 +719,14 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizons.YlmSpherepack",
     }
   }
 
+  for (size_t l_max = 3; l_max < 5; ++l_max) {
+    for (size_t m_max = 2; m_max <= l_max; ++m_max) {
+      test_batch(l_max, m_max);
+    }
+  }
+
   test_prolong_restrict();
+  test_shared_storage();
 
   YlmSpherepack s(4, 4);
   test_copy_semantics(s);
@@ -198,6 +198,57 @@ void test_interpolation() noexcept {
     }
   }
 }
+
+// Compare against a direct evaluation of the tensor product for extents on
+// both sides of the size at which the sum-factorization kernels hand off to
+// the BLAS implementation.
+template <typename DataType>
+void test_sum_factorization_threshold() noexcept {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  constexpr size_t max_extent =
+      apply_matrices_detail::max_sum_factorization_extent;
+  const size_t number_of_components = 2;
+  for (const size_t extent_0 : {max_extent - 1, max_extent, max_extent + 2}) {
+    for (const bool identity_in_second_dim : {true, false}) {
+      CAPTURE(extent_0);
+      CAPTURE(identity_in_second_dim);
+      const Index<2> extents{extent_0, 3};
+      std::array<Matrix, 2> matrices{
+          {Matrix(5, extent_0),
+           identity_in_second_dim ? Matrix{} : Matrix(4, 3)}};
+      for (auto& matrix : matrices) {
+        for (size_t i = 0; i < matrix.rows(); ++i) {
+          for (size_t j = 0; j < matrix.columns(); ++j) {
+            matrix(i, j) = dist(gen);
+          }
+        }
+      }
+      const Index<2> result_extents{
+          5, identity_in_second_dim ? extents[1] : matrices[1].rows()};
+      const auto source = make_with_random_values<DataType>(
+          make_not_null(&gen), make_not_null(&dist),
+          DataType(number_of_components * extents.product()));
+
+      DataType expected(number_of_components * result_extents.product(), 0.0);
+      for (size_t c = 0; c < number_of_components; ++c) {
+        for (IndexIterator<2> out(result_extents); out; ++out) {
+          for (IndexIterator<2> in(extents); in; ++in) {
+            const double second_dim_factor =
+                identity_in_second_dim
+                    ? ((*out)[1] == (*in)[1] ? 1.0 : 0.0)
+                    : matrices[1]((*out)[1], (*in)[1]);
+            expected[c * result_extents.product() + out.collapsed_index()] +=
+                matrices[0]((*out)[0], (*in)[0]) * second_dim_factor *
+                source[c * extents.product() + in.collapsed_index()];
+          }
+        }
+      }
+      CHECK_ITERABLE_APPROX(apply_matrices(matrices, source, extents),
+                            expected);
+    }
+  }
+}
 }  // namespace
 
 // [[Timeout, 8]]
@@ -215,6 +266,8 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 2>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 3>();
   }
+  test_sum_factorization_threshold<DataVector>();
+  test_sum_factorization_threshold<ComplexDataVector>();
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
   const Index<0> extents{};
@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/Arena.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+bool is_aligned(const void* const pointer) noexcept {
+  return reinterpret_cast<std::uintptr_t>(pointer) % Arena::alignment == 0;
+}
+
+void test_allocate_and_rewind() noexcept {
+  CHECK(Arena{}.capacity() == 0);
+  Arena arena{4096};
+  CHECK(arena.capacity() == 4096);
+  CHECK(arena.bytes_in_use() == 0);
+
+  double* const first = arena.allocate<double>(10);
+  CHECK(is_aligned(first));
+  CHECK(arena.bytes_in_use() == 2 * Arena::alignment);
+  for (size_t i = 0; i < 10; ++i) {
+    first[i] = static_cast<double>(i);
+  }
+  const auto marker = arena.marker();
+  auto* const second = arena.allocate<std::complex<double>>(3);
+  CHECK(is_aligned(second));
+  CHECK(reinterpret_cast<std::byte*>(second) ==
+        reinterpret_cast<std::byte*>(first) + 2 * Arena::alignment);
+
+  // Memory allocated after the marker is reused after rewinding
+  arena.rewind(marker);
+  CHECK(arena.bytes_in_use() == 2 * Arena::alignment);
+  CHECK(static_cast<void*>(arena.allocate<double>(1)) ==
+        static_cast<void*>(second));
+  for (size_t i = 0; i < 10; ++i) {
+    CHECK(first[i] == static_cast<double>(i));
+  }
+
+  arena.reset();
+  CHECK(arena.bytes_in_use() == 0);
+  CHECK(arena.allocate<double>(1) == first);
+}
+
+void test_growth() noexcept {
+  Arena arena{1024};
+  CHECK(arena.capacity() == 1024);
+  CHECK(arena.number_of_blocks() == 1);
+  {
+    const ArenaScope outer_scope{make_not_null(&arena)};
+    double* const small = arena.allocate<double>(100);
+    {
+      const ArenaScope inner_scope{make_not_null(&arena)};
+      // Doesn't fit into the first block anymore
+      double* const large = arena.allocate<double>(1000);
+      CHECK(is_aligned(large));
+      CHECK(arena.number_of_blocks() == 2);
+      large[999] = 1.0;
+    }
+    CHECK(arena.bytes_in_use() == 832);
+    CHECK(arena.allocate<double>(1) == small + 104);
+  }
+  // The blocks are merged once the arena is empty
+  CHECK(arena.bytes_in_use() == 0);
+  CHECK(arena.number_of_blocks() == 1);
+  const size_t capacity = arena.capacity();
+  CHECK(capacity >= 1024 + 8000);
+  {
+    const ArenaScope scope{make_not_null(&arena)};
+    arena.allocate<double>(100);
+    arena.allocate<double>(1000);
+    CHECK(arena.number_of_blocks() == 1);
+  }
+  CHECK(arena.capacity() == capacity);
+}
+
+void test_local() noexcept {
+  Arena& arena = Arena::local();
+  CHECK(&arena == &Arena::local());
+  const size_t bytes_in_use = arena.bytes_in_use();
+  {
+    const ArenaScope scope{make_not_null(&arena)};
+    arena.allocate<double>(10);
+    CHECK(arena.bytes_in_use() > bytes_in_use);
+  }
+  CHECK(arena.bytes_in_use() == bytes_in_use);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Arena", "[DataStructures][Unit]") {
+  test_allocate_and_rewind();
+  test_growth();
+  test_local();
+}
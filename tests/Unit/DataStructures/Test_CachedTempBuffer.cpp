@@ -5,7 +5,9 @@
 
 #include <cstddef>
 #include <limits>
+#include <type_traits>
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/CachedTempBuffer.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -136,6 +138,23 @@ void test_cached_temp_buffer(const DataType& used_for_size) noexcept {
 
   CHECK(get_size(get(cache.get_var(Tags::Scalar1<DataType>{}))) ==
         get_size(used_for_size));
+
+  {
+    INFO("Memory from an arena");
+    Arena arena{};
+    const ArenaScope arena_scope{make_not_null(&arena)};
+    Cache<DataType> arena_cache(get_size(used_for_size), make_not_null(&arena),
+                                Computer<DataType>(&counter));
+    CHECK(get<0>(arena_cache.get_var(Tags::Vector2<DataType>{})) == 110.0);
+    check_counts(1, 2, 2, 2);
+    if constexpr (std::is_same_v<DataType, DataVector>) {
+      // The buffer holds six components
+      CHECK(arena.bytes_in_use() >=
+            6 * get_size(used_for_size) * sizeof(double));
+    } else {
+      CHECK(arena.bytes_in_use() == 0);
+    }
+  }
 }
 }  // namespace
 
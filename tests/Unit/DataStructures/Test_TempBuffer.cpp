@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include "DataStructures/Arena.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
@@ -10,16 +11,17 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace {
-template <typename DataType>
-void test_temp_buffer(const DataType& x) {
+template <typename DataType, typename... ArenaArgs>
+void test_temp_buffer(const DataType& x, const ArenaArgs&... arena) {
   TempBuffer<tmpl::list<::Tags::TempI<0, 3, Frame::Inertial, DataType>,
                         ::Tags::TempScalar<1, DataType>>>
-      buffer(get_size(x));
+      buffer(get_size(x), arena...);
 
   auto& vec = get<::Tags::TempI<0, 3, Frame::Inertial, DataType>>(buffer);
   auto& scalar = get<::Tags::TempScalar<1, DataType>>(buffer);
@@ -43,4 +45,13 @@ void test_temp_buffer(const DataType& x) {
 SPECTRE_TEST_CASE("Unit.DataStructures.TempBuffer", "[DataStructures][Unit]") {
   test_temp_buffer(2.0);
   test_temp_buffer(DataVector(5, 2.0));
+  Arena arena{};
+  {
+    const ArenaScope scope{make_not_null(&arena)};
+    test_temp_buffer(2.0, make_not_null(&arena));
+    CHECK(arena.bytes_in_use() == 0);
+    test_temp_buffer(DataVector(5, 2.0), make_not_null(&arena));
+    CHECK(arena.bytes_in_use() > 0);
+  }
+  CHECK(arena.bytes_in_use() == 0);
 }
@@ -323,6 +323,72 @@ void test_variables_move() noexcept {
   }
 }
 
+template <typename VectorType>
+void test_variables_non_owning() noexcept {
+  using value_type = typename VectorType::value_type;
+  using TestVariables =
+      Variables<tmpl::list<TestHelpers::Tags::Scalar<VectorType>,
+                           TestHelpers::Tags::Vector<VectorType>>>;
+  const size_t number_of_grid_points = 4;
+  std::array<value_type,
+             4 * TestVariables::number_of_independent_components>
+      memory{};
+  TestVariables vars{memory.data(), number_of_grid_points};
+  CHECK_FALSE(vars.is_owning());
+  CHECK(vars.data() == memory.data());
+  CHECK(vars.number_of_grid_points() == number_of_grid_points);
+  CHECK(vars.size() == memory.size());
+  get(get<TestHelpers::Tags::Scalar<VectorType>>(vars)) = value_type{2.0};
+  CHECK(memory[0] == value_type{2.0});
+  CHECK(get<0>(get<TestHelpers::Tags::Vector<VectorType>>(vars)).data() ==
+        memory.data() + number_of_grid_points);
+
+  // Copying or moving into a non-owning Variables copies into its memory
+  const TestVariables owning{number_of_grid_points, value_type{3.0}};
+  vars = owning;
+  CHECK(vars.data() == memory.data());
+  CHECK(memory[5] == value_type{3.0});
+  vars = TestVariables{number_of_grid_points, value_type{4.0}};
+  CHECK_FALSE(vars.is_owning());
+  CHECK(vars.data() == memory.data());
+  CHECK(memory[5] == value_type{4.0});
+
+  // Copies own their memory
+  const TestVariables copy = vars;
+  CHECK(copy.is_owning());
+  CHECK(copy == vars);
+  CHECK(copy.data() != memory.data());
+
+  // Moving out of a non-owning Variables keeps pointing to the same memory
+  TestVariables moved_to{std::move(vars)};
+  CHECK_FALSE(moved_to.is_owning());
+  CHECK(moved_to.data() == memory.data());
+  CHECK(get<0>(get<TestHelpers::Tags::Vector<VectorType>>(moved_to)).data() ==
+        memory.data() + number_of_grid_points);
+  // Move-assigning a non-owning Variables to an owning one copies the data,
+  // so the owning Variables doesn't point into memory it doesn't own
+  TestVariables move_assigned{};
+  move_assigned = std::move(moved_to);
+  CHECK(move_assigned.is_owning());
+  CHECK(move_assigned.data() != memory.data());
+  CHECK(move_assigned == copy);
+  TestVariables owning_move_assigned{number_of_grid_points, value_type{5.0}};
+  const auto* const owned_data = owning_move_assigned.data();
+  owning_move_assigned = TestVariables{memory.data(), number_of_grid_points};
+  CHECK(owning_move_assigned.is_owning());
+  CHECK(owning_move_assigned.data() == owned_data);
+  CHECK(owning_move_assigned == copy);
+
+  // The memory can be set after construction
+  std::array<value_type,
+             4 * TestVariables::number_of_independent_components>
+      other_memory{};
+  move_assigned.set_data_ref(other_memory.data(), number_of_grid_points);
+  CHECK(move_assigned.data() == other_memory.data());
+  CHECK(get(get<TestHelpers::Tags::Scalar<VectorType>>(move_assigned))
+            .data() == other_memory.data());
+}
+
 template <typename VectorType>
 void test_variables_math() noexcept {
   using value_type = typename VectorType::value_type;
@@ -908,6 +974,14 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
     test_variables_move<ModalVector>();
   }
 
+  {
+    INFO("Test non-owning Variables");
+    test_variables_non_owning<ComplexDataVector>();
+    test_variables_non_owning<ComplexModalVector>();
+    test_variables_non_owning<DataVector>();
+    test_variables_non_owning<ModalVector>();
+  }
+
   {
     INFO("Test Variables arithmetic operations");
     test_variables_math<DataVector>();
@@ -999,3 +1073,17 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
   ERROR("Failed to trigger ASSERT in an assertion test");
 #endif
 }
+
+// clang-format off
+// [[OutputRegex, non-owning Variables with 2 grid points can't be resized]]
+[[noreturn]] SPECTRE_TEST_CASE(
+    "Unit.DataStructures.Variables.resize_non_owning",
+    "[DataStructures][Unit]") {
+  // clang-format on
+  ERROR_TEST();
+  std::array<double, 2> memory{};
+  Variables<tmpl::list<TestHelpers::Tags::Scalar<DataVector>>> vars{
+      memory.data(), 2};
+  vars.initialize(3);
+  ERROR("Failed to trigger ERROR in an error test");
+}
@@ -707,6 +707,18 @@ void test_coordinate_map_with_rotation_wedge() {
         composed_map.jacobian(test_point_vector));
   CHECK(std::get<3>(coords_jacs_velocity) ==
         tnsr::I<double, 2, Frame::Grid>{0.0});
+
+  // The second point is on the wrong side of the wedge
+  const tnsr::I<DataVector, 2, Frame::Grid> mapped_points{
+      {{DataVector{mapped_point_array[0], -mapped_point_array[0]},
+        DataVector{mapped_point_array[1], -mapped_point_array[1]}}}};
+  tnsr::I<DataVector, 2, Frame::Logical> source_points{};
+  std::vector<bool> is_invertible{};
+  composed_map.inverse(make_not_null(&source_points),
+                       make_not_null(&is_invertible), mapped_points);
+  CHECK(is_invertible == std::vector<bool>{true, false});
+  CHECK(get<0>(source_points)[0] == approx(test_point_array[0]));
+  CHECK(get<1>(source_points)[0] == approx(test_point_array[1]));
 }
 
 void test_make_vector_coordinate_map_base() {
@@ -1132,6 +1144,15 @@ void test_time_dependent_map() {
       *(time_dependent_map_second.inverse(tnsr_double_inertial_2, final_time,
                                           functions_of_time)),
       tnsr_double_logical);
+  {
+    tnsr::I<DataVector, 1, Frame::Logical> source_points{};
+    std::vector<bool> is_invertible{};
+    time_dependent_map_first.inverse(
+        make_not_null(&source_points), make_not_null(&is_invertible),
+        tnsr_datavector_inertial_1, final_time, functions_of_time);
+    CHECK(is_invertible == std::vector<bool>(3, true));
+    CHECK_ITERABLE_APPROX(source_points, tnsr_datavector_logical);
+  }
 
   CHECK(time_dependent_map_first
             .jacobian(tnsr_double_logical, final_time, functions_of_time)
@@ -8,6 +8,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -17,6 +18,8 @@
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/Domain/CoordinateMaps/TestMapHelpers.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -214,6 +217,41 @@ void test(const bool linear_expansion) {
         }
       }
 
+      {
+        INFO("Inverse of all points at once");
+        std::array<double, Dim> bad_mapped_point = make_array<Dim>(0.0);
+        bad_mapped_point[0] = 1.1 * outer_boundary * b;
+        const std::array<std::array<double, Dim>, 4> points{
+            {mapped_point, bad_mapped_point, 0.5 * mapped_point,
+             make_array<Dim>(0.0)}};
+        std::array<DataVector, Dim> coords = make_array<Dim>(DataVector{4});
+        for (size_t s = 0; s < 4; ++s) {
+          for (size_t d = 0; d < Dim; ++d) {
+            gsl::at(coords, d)[s] = gsl::at(gsl::at(points, s), d);
+          }
+        }
+        // The third point is masked out
+        std::vector<bool> is_invertible{true, true, false, true};
+        scale_map.inverse(make_not_null(&coords),
+                          make_not_null(&is_invertible), t, f_of_t_list);
+        CHECK(is_invertible[0]);
+        CHECK(is_invertible[1] == linear_expansion);
+        CHECK_FALSE(is_invertible[2]);
+        CHECK(is_invertible[3]);
+        for (size_t s = 0; s < 4; ++s) {
+          if (not is_invertible[s]) {
+            continue;
+          }
+          std::array<double, Dim> source_point{};
+          for (size_t d = 0; d < Dim; ++d) {
+            gsl::at(source_point, d) = gsl::at(coords, d)[s];
+          }
+          CHECK_ITERABLE_APPROX(
+              source_point,
+              scale_map.inverse(gsl::at(points, s), t, f_of_t_list).value());
+        }
+      }
+
       test_jacobian(scale_map, point_xi, t, f_of_t_list);
       test_inv_jacobian(scale_map, point_xi, t, f_of_t_list);
       test_frame_velocity(scale_map, point_xi, t, f_of_t_list);
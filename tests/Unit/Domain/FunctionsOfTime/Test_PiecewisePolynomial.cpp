@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -224,6 +226,81 @@ SPECTRE_TEST_CASE("Unit.Domain.FunctionsOfTime.PiecewisePolynomial",
     test_within_roundoff<deriv_order>(f_of_t);
     test_within_roundoff<deriv_order>(f_of_t2);
   }
+  {
+    INFO("Test cached evaluations.");
+    constexpr size_t deriv_order = 2;
+    // x**2 with a 2nd deriv that changes to 4 at t = 1
+    FunctionsOfTime::PiecewisePolynomial<deriv_order> f_of_t(
+        0.0, {{{0.0}, {0.0}, {2.0}}}, 1.0);
+    const auto check = [&f_of_t](const double t,
+                                 const double second_deriv) noexcept {
+      const auto func_and_2_derivs = f_of_t.func_and_2_derivs(t);
+      const auto func_and_deriv = f_of_t.func_and_deriv(t);
+      const auto func = f_of_t.func(t);
+      CHECK(approx(func_and_2_derivs[0][0]) == square(t));
+      CHECK(approx(func_and_2_derivs[1][0]) == 2.0 * t);
+      CHECK(approx(func_and_2_derivs[2][0]) == second_deriv);
+      CHECK(func_and_deriv[0] == func_and_2_derivs[0]);
+      CHECK(func_and_deriv[1] == func_and_2_derivs[1]);
+      CHECK(func[0] == func_and_2_derivs[0]);
+    };
+    // Evaluate at more times than are cached, and repeat earlier times in
+    // between, so entries are both reused and evicted
+    constexpr size_t number_of_cached_times =
+        FunctionsOfTime::PiecewisePolynomial<
+            deriv_order>::number_of_cached_times;
+    for (size_t i = 0; i < 2 * number_of_cached_times + 1; ++i) {
+      const double t = 0.1 * static_cast<double>(i);
+      check(t, 2.0);
+      check(0.0, 2.0);
+      check(t, 2.0);
+    }
+    check(1.0, 2.0);
+
+    const auto f_of_t_copy = f_of_t;
+    CHECK(f_of_t_copy == f_of_t);
+    f_of_t.update(1.0, {4.0}, 2.0);
+    // The value cached at the update time before the update is outdated
+    check(1.0, 4.0);
+    check(0.5, 2.0);
+    CHECK(approx(f_of_t_copy.func_and_2_derivs(1.0)[2][0]) == 2.0);
+    CHECK(f_of_t_copy != f_of_t);
+  }
+  {
+    INFO("Test concurrent cached evaluations.");
+    // x**2, evaluated from several threads at more times than are cached so
+    // threads replace entries that others may be reading
+    const FunctionsOfTime::PiecewisePolynomial<2> f_of_t(
+        0.0, {{{0.0}, {0.0}, {2.0}}}, 10.0);
+    constexpr size_t number_of_threads = 4;
+    std::array<bool, number_of_threads> results_are_correct{};
+    const auto evaluate = [&f_of_t](
+                              const gsl::not_null<bool*> correct) noexcept {
+      *correct = true;
+      for (size_t repeat = 0; repeat < 100; ++repeat) {
+        for (size_t i = 0; i < 10; ++i) {
+          const double t = 0.1 * static_cast<double>(i);
+          const auto func_and_2_derivs = f_of_t.func_and_2_derivs(t);
+          const auto func = f_of_t.func(t);
+          *correct = *correct and func_and_2_derivs[0][0] == square(t) and
+                     func_and_2_derivs[1][0] == 2.0 * t and
+                     func_and_2_derivs[2][0] == 2.0 and
+                     func[0] == func_and_2_derivs[0];
+        }
+      }
+    };
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < number_of_threads; ++i) {
+      threads.emplace_back(evaluate,
+                           make_not_null(&gsl::at(results_are_correct, i)));
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (const bool correct : results_are_correct) {
+      CHECK(correct);
+    }
+  }
 }
 
 // [[OutputRegex, t must be increasing from call to call. Attempted to update at
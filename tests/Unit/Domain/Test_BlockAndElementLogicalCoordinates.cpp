@@ -496,6 +496,67 @@ void test_block_logical_coordinates1fail() noexcept {
   CHECK(block_logical_result[3]);
 }
 
+// The blocks whose maps are inverted at each point are chosen by bounding
+// boxes, so check points outside of all blocks but inside or outside of the
+// boxes, and points on boundaries shared by several blocks
+void test_block_logical_coordinates_bounding_boxes() noexcept {
+  Domain<3> domain(maps_for_rectilinear_domains<Frame::Inertial>(
+                       Index<3>{2, 2, 2},
+                       std::array<std::vector<double>, 3>{
+                           {{0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}}},
+                       {Index<3>{}}),
+                   corners_for_rectilinear_domains(Index<3>{2, 2, 2}));
+  const double eps = std::numeric_limits<double>::epsilon();
+  const std::vector<std::array<double, 3>> x_inertial{
+      // Outside of all blocks and all bounding boxes
+      {{2.0, 2.0, 2.0}},
+      {{-1.0, 0.25, 0.25}},
+      // Outside of all blocks, but inside the padded bounding box of block 1
+      {{1.01, 0.25, 0.25}},
+      // On the corner shared by all blocks
+      {{0.5, 0.5, 0.5}},
+      // On the edge shared by blocks 1, 3, 5 and 7
+      {{0.75, 0.5, 0.5}},
+      // On the face shared by blocks 6 and 7
+      {{0.5, 0.75, 0.75}},
+      // Just past the face shared by blocks 2 and 3, so only in block 3
+      {{0.5 + eps, 0.75, 0.25}},
+      // A point inside block 7, so the points above are not all handled in
+      // the same group
+      {{0.9, 0.9, 0.9}}};
+  tnsr::I<DataVector, 3, Frame::Inertial> inertial_coords(x_inertial.size());
+  for (size_t s = 0; s < x_inertial.size(); ++s) {
+    for (size_t d = 0; d < 3; ++d) {
+      inertial_coords.get(d)[s] = gsl::at(x_inertial[s], d);
+    }
+  }
+  const auto block_logical_result =
+      block_logical_coordinates(domain, inertial_coords);
+  REQUIRE(block_logical_result.size() == x_inertial.size());
+  for (size_t s = 0; s < 3; ++s) {
+    CAPTURE(s);
+    CHECK_FALSE(block_logical_result[s].has_value());
+  }
+  // Ties on shared boundaries go to the block with the smallest id
+  const std::vector<size_t> expected_block_ids{0, 1, 6, 3, 7};
+  const std::vector<std::array<double, 3>> expected_x_logical{
+      {{1.0, 1.0, 1.0}},
+      {{0.0, 1.0, 1.0}},
+      {{1.0, 0.0, 0.0}},
+      {{-1.0, 0.0, 0.0}},
+      {{0.6, 0.6, 0.6}}};
+  for (size_t i = 0; i < expected_block_ids.size(); ++i) {
+    const size_t s = i + 3;
+    CAPTURE(s);
+    REQUIRE(block_logical_result[s].has_value());
+    CHECK(block_logical_result[s]->id.get_index() == expected_block_ids[i]);
+    for (size_t d = 0; d < 3; ++d) {
+      CHECK(block_logical_result[s]->data.get(d) ==
+            approx(gsl::at(expected_x_logical[i], d)));
+    }
+  }
+}
+
 void test_block_and_element_logical_coordinates3() noexcept {
   Domain<3> domain(maps_for_rectilinear_domains<Frame::Inertial>(
                        Index<3>{2, 2, 2},
@@ -583,6 +644,8 @@ SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
   fuzzy_test_block_and_element_logical_coordinates1(20);
   fuzzy_test_block_and_element_logical_coordinates1(0);
   fuzzy_test_block_and_element_logical_coordinates_shell(20);
+  fuzzy_test_block_and_element_logical_coordinates_shell(500);
   fuzzy_test_block_and_element_logical_coordinates_time_dependent_brick(20);
   test_block_logical_coordinates1fail();
+  test_block_logical_coordinates_bounding_boxes();
 }
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <set>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/SegmentId.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/MakeArray.hpp"
 
 namespace {
 
@@ -55,14 +57,12 @@ size_t number_of_elements_in_block(
   return number_of_elements;
 }
 
-template <size_t Dim>
-std::vector<std::vector<size_t>> make_proc_map_for_domain(
-    const size_t number_of_blocks, const size_t number_of_procs,
+template <size_t Dim, typename Distribution>
+std::vector<std::vector<size_t>> make_proc_map(
+    const Distribution& distribution, const size_t number_of_blocks,
     const std::vector<std::array<size_t, Dim>>&
         refinement_levels_by_block) noexcept {
   std::vector<std::vector<size_t>> proc_map(number_of_blocks);
-  const domain::BlockZCurveProcDistribution distribution{
-      number_of_procs, refinement_levels_by_block};
   for (size_t block = 0; block < number_of_blocks; ++block) {
     const size_t number_of_elements =
         number_of_elements_in_block(gsl::at(refinement_levels_by_block, block));
@@ -80,6 +80,17 @@ std::vector<std::vector<size_t>> make_proc_map_for_domain(
   return proc_map;
 }
 
+template <size_t Dim>
+std::vector<std::vector<size_t>> make_proc_map_for_domain(
+    const size_t number_of_blocks, const size_t number_of_procs,
+    const std::vector<std::array<size_t, Dim>>&
+        refinement_levels_by_block) noexcept {
+  const domain::BlockZCurveProcDistribution distribution{
+      number_of_procs, refinement_levels_by_block};
+  return make_proc_map(distribution, number_of_blocks,
+                       refinement_levels_by_block);
+}
+
 // check that the distribution portions out the number of elements approximately
 // evenly (within 1 element) to each processor
 template <size_t Dim>
@@ -105,14 +116,16 @@ void check_element_distribution_uniformity(
   }
 }
 
-// check that, for each block, no processor appears in more than two connected
-// groups, and that each processor does not appear in too many blocks.
+// check that, for each block, no processor appears in more than
+// `maximum_number_of_clusters` connected groups, and that each processor does
+// not appear in too many blocks.
 template <size_t Dim>
 void check_element_distribution_cohesion(
     const std::vector<std::vector<size_t>>& proc_map,
     const size_t number_of_procs,
     const std::vector<std::array<size_t, Dim>>& refinement_levels_by_block,
-    const bool nonuniform_block = false) noexcept {
+    const bool nonuniform_block = false,
+    const size_t maximum_number_of_clusters = 2) noexcept {
   std::vector<std::set<size_t>> block_set_per_proc(number_of_procs);
   for (size_t block = 0; block < proc_map.size(); ++block) {
     std::array<size_t, Dim> strides{};
@@ -174,9 +187,10 @@ void check_element_distribution_cohesion(
       }
     }
     // verify that the distribution is well-clustered -- the Z-curve should
-    // ensure no more than 2 clusters for each core
+    // ensure no more than 2 clusters for each core, and the Hilbert curve no
+    // more than 1
     for (const size_t number_of_clusters : number_of_clusters_per_proc) {
-      CHECK(number_of_clusters < 3);
+      CHECK(number_of_clusters <= maximum_number_of_clusters);
     }
   }
   // verify that each processor has not been assigned to too many blocks -- the
@@ -273,6 +287,59 @@ void general_test(const size_t number_of_blocks, const size_t number_of_procs,
       proc_map, number_of_procs, refinement_levels_by_block, uneven_domain);
 }
 
+template <size_t Dim>
+void test_hilbert_curve_distribution(const size_t number_of_blocks,
+                                     const size_t number_of_procs) noexcept {
+  const std::vector<std::array<size_t, Dim>> refinement_levels_by_block(
+      number_of_blocks, make_array<Dim>(2_st));
+  {
+    INFO("Uniform cost");
+    const domain::WeightedHilbertCurveProcDistribution<Dim> distribution{
+        number_of_procs, refinement_levels_by_block};
+    const std::vector<std::vector<size_t>> proc_map = make_proc_map(
+        distribution, number_of_blocks, refinement_levels_by_block);
+    check_element_distribution_uniformity(proc_map, number_of_procs,
+                                          refinement_levels_by_block);
+    check_element_distribution_cohesion(proc_map, number_of_procs,
+                                        refinement_levels_by_block, false, 1);
+  }
+  {
+    INFO("Weighted cost");
+    // the elements of the first block and the lower half of each block are
+    // more expensive
+    const auto element_cost = [](const ElementId<Dim>& element_id) noexcept {
+      return (element_id.block_id() == 0 ? 4.0 : 1.0) *
+             (element_id.segment_id(0).index() < 2 ? 3.0 : 1.0);
+    };
+    const domain::WeightedHilbertCurveProcDistribution<Dim> distribution{
+        number_of_procs, refinement_levels_by_block, element_cost};
+    const std::vector<std::vector<size_t>> proc_map = make_proc_map(
+        distribution, number_of_blocks, refinement_levels_by_block);
+    check_element_distribution_cohesion(proc_map, number_of_procs,
+                                        refinement_levels_by_block, true, 1);
+    std::vector<double> cost_per_proc(number_of_procs, 0.0);
+    double total_cost = 0.0;
+    for (size_t block = 0; block < number_of_blocks; ++block) {
+      for (size_t element_index = 0;
+           element_index < proc_map.at(block).size(); ++element_index) {
+        const ElementId<Dim> element_id{
+            block,
+            element_index_to_segment_id(
+                gsl::at(refinement_levels_by_block, block), element_index)};
+        cost_per_proc.at(proc_map.at(block).at(element_index)) +=
+            element_cost(element_id);
+        total_cost += element_cost(element_id);
+      }
+    }
+    // each processor's cost is within the largest element cost of the average
+    const double average_cost =
+        total_cost / static_cast<double>(number_of_procs);
+    for (const double cost : cost_per_proc) {
+      CHECK(std::abs(cost - average_cost) <= 12.0);
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   {
     INFO("Single block domain");
@@ -287,6 +354,9 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
         general_test<2>(number_of_blocks, number_of_procs, uneven_domain);
         general_test<3>(number_of_blocks, number_of_procs, uneven_domain);
       }
+      test_hilbert_curve_distribution<1>(number_of_blocks, number_of_procs);
+      test_hilbert_curve_distribution<2>(number_of_blocks, number_of_procs);
+      test_hilbert_curve_distribution<3>(number_of_blocks, number_of_procs);
     }
   }
 }
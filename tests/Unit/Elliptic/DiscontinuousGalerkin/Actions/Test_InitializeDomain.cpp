@@ -24,6 +24,7 @@
 #include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Tags.hpp"
 #include "Elliptic/DiscontinuousGalerkin/Actions/InitializeDomain.hpp"
+#include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -124,6 +125,7 @@ SPECTRE_TEST_CASE("Unit.ParallelDG.InitializeDomain", "[Unit][Actions]") {
     const auto& det_inv_jacobian = get_tag(
         domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>{});
     CHECK(det_inv_jacobian == determinant(inverse_jacobian));
+    CHECK(get_tag(elliptic::dg::Tags::HasConstantJacobian{}));
   }
   {
     INFO("2D");
@@ -196,6 +198,7 @@ SPECTRE_TEST_CASE("Unit.ParallelDG.InitializeDomain", "[Unit][Actions]") {
     const auto& det_inv_jacobian = get_tag(
         domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>{});
     CHECK(det_inv_jacobian == determinant(inverse_jacobian));
+    CHECK(get_tag(elliptic::dg::Tags::HasConstantJacobian{}));
   }
   {
     INFO("3D");
@@ -281,5 +284,6 @@ SPECTRE_TEST_CASE("Unit.ParallelDG.InitializeDomain", "[Unit][Actions]") {
     const auto& det_inv_jacobian = get_tag(
         domain::Tags::DetInvJacobian<Frame::Logical, Frame::Inertial>{});
     CHECK(det_inv_jacobian == determinant(inverse_jacobian));
+    CHECK(get_tag(elliptic::dg::Tags::HasConstantJacobian{}));
   }
 }
@@ -181,6 +181,7 @@ void test_constrained_fit_1d(const Spectral::Quadrature quadrature =
     DataVector constrained_fit;
     Limiters::Weno_detail::solve_constrained_fit<ScalarTag>(
         make_not_null(&constrained_fit), local_data, 0, mesh, element,
+        Limiters::Weno_detail::constrained_fit_cache(mesh, element),
         neighbor_data, primary_neighbor, neighbors_to_exclude);
 
     // The expected coefficient values for the result of the constrained fit are
@@ -237,7 +238,10 @@ void test_constrained_fit_1d(const Spectral::Quadrature quadrature =
     DataVector constrained_fit;
     Limiters::Weno_detail::solve_constrained_fit<ScalarTag>(
         make_not_null(&constrained_fit), local_data, 0, mesh,
-        element_at_lower_xi_bdry, neighbor_data_at_lower_xi_bdry,
+        element_at_lower_xi_bdry,
+        Limiters::Weno_detail::constrained_fit_cache(mesh,
+                                                     element_at_lower_xi_bdry),
+        neighbor_data_at_lower_xi_bdry,
         primary_neighbor, neighbors_to_exclude);
 
     // Coefficients from Mathematica, using code similar to the one above.
@@ -283,7 +287,10 @@ void test_constrained_fit_1d(const Spectral::Quadrature quadrature =
     DataVector constrained_fit;
     Limiters::Weno_detail::solve_constrained_fit<ScalarTag>(
         make_not_null(&constrained_fit), local_data, 0, mesh,
-        element_at_upper_xi_bdry, neighbor_data_at_upper_xi_bdry,
+        element_at_upper_xi_bdry,
+        Limiters::Weno_detail::constrained_fit_cache(mesh,
+                                                     element_at_upper_xi_bdry),
+        neighbor_data_at_upper_xi_bdry,
         primary_neighbor, neighbors_to_exclude);
 
     // This test case should produce the same fit as the first test case above,
@@ -425,6 +432,7 @@ void test_constrained_fit_2d_vector(
       Limiters::Weno_detail::solve_constrained_fit<VectorTag<2>>(
           make_not_null(&(constrained_fit.get(tensor_index))),
           local_tensor.get(tensor_index), tensor_index, mesh, element,
+          Limiters::Weno_detail::constrained_fit_cache(mesh, element),
           neighbor_data, primary_neighbor, neighbors_to_exclude);
     }
 
@@ -554,7 +562,10 @@ void test_constrained_fit_2d_vector(
       Limiters::Weno_detail::solve_constrained_fit<VectorTag<2>>(
           make_not_null(&(constrained_fit.get(tensor_index))),
           local_tensor.get(tensor_index), tensor_index, mesh,
-          element_at_lower_eta_bdry, neighbor_data_at_lower_eta_bdry,
+          element_at_lower_eta_bdry,
+          Limiters::Weno_detail::constrained_fit_cache(
+              mesh, element_at_lower_eta_bdry),
+          neighbor_data_at_lower_eta_bdry,
           primary_neighbor, neighbors_to_exclude);
     }
 
@@ -720,6 +731,7 @@ void test_constrained_fit_3d(const Spectral::Quadrature quadrature =
     DataVector constrained_fit;
     Limiters::Weno_detail::solve_constrained_fit<ScalarTag>(
         make_not_null(&constrained_fit), local_data, 0, mesh, element,
+        Limiters::Weno_detail::constrained_fit_cache(mesh, element),
         neighbor_data, primary_neighbor, neighbors_to_exclude);
 
     // The expected coefficient values for the result of the constrained fit are
@@ -935,8 +947,9 @@ void test_constrained_fit_3d(const Spectral::Quadrature quadrature =
     DataVector constrained_fit;
     Limiters::Weno_detail::solve_constrained_fit<ScalarTag>(
         make_not_null(&constrained_fit), local_data, 0, mesh,
-        element_two_bdries, neighbor_data_two_bdries, primary_neighbor,
-        neighbors_to_exclude);
+        element_two_bdries,
+        Limiters::Weno_detail::constrained_fit_cache(mesh, element_two_bdries),
+        neighbor_data_two_bdries, primary_neighbor, neighbors_to_exclude);
 
     // Coefficients from Mathematica, using code similar to the one above.
     const auto expected = [&quadrature, &logical_coords]() noexcept {
@@ -1060,10 +1073,12 @@ void test_hweno_work(
 
   auto vector_to_limit = local_vector;
   const double neighbor_linear_weight = 0.001;
+  const auto& fit_cache =
+      Limiters::Weno_detail::constrained_fit_cache(mesh, element);
   Limiters::Weno_detail::hweno_impl<VectorTag<VolumeDim>>(
       make_not_null(&modified_neighbor_solution_buffer),
       make_not_null(&vector_to_limit), neighbor_linear_weight, mesh, element,
-      neighbor_data);
+      fit_cache, neighbor_data);
 
   // Check data mean was preserved
   for (size_t i = 0; i < VolumeDim; ++i) {
@@ -1088,7 +1103,8 @@ void test_hweno_work(
           expected_neighbor_polynomials[primary_neighbor];
       Limiters::Weno_detail::solve_constrained_fit<VectorTag<VolumeDim>>(
           make_not_null(&constrained_fit), local_vector.get(i), i, mesh,
-          element, neighbor_data, primary_neighbor, neighbors_to_exclude);
+          element, fit_cache, neighbor_data, primary_neighbor,
+          neighbors_to_exclude);
     }
     Limiters::Weno_detail::reconstruct_from_weighted_sum(
         make_not_null(&expected_hweno.get(i)), neighbor_linear_weight,
@@ -1367,10 +1383,42 @@ void test_hweno_impl_3d(const Spectral::Quadrature quadrature =
       local_approx);
 }
 
+void test_constrained_fit_cache() noexcept {
+  INFO("Testing Weno_detail::constrained_fit_cache");
+  const auto element = TestHelpers::Limiters::make_element<2>();
+  const auto element_with_boundary = TestHelpers::Limiters::make_element<2>(
+      std::unordered_set<Direction<2>>{{Direction<2>::upper_xi()}});
+  const Mesh<2> mesh({{3, 4}}, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  const Mesh<2> other_mesh({{4, 4}}, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto);
+
+  // Repeated calls share the same cache
+  const auto& cache =
+      Limiters::Weno_detail::constrained_fit_cache(mesh, element);
+  CHECK(&cache == &Limiters::Weno_detail::constrained_fit_cache(
+                      mesh, TestHelpers::Limiters::make_element<2>()));
+  CHECK(cache.quadrature_weights.size() == mesh.number_of_grid_points());
+  CHECK(cache.interpolation_matrices.size() == 4);
+
+  // Different boundary configurations and different meshes do not
+  const auto& cache_with_boundary =
+      Limiters::Weno_detail::constrained_fit_cache(mesh,
+                                                   element_with_boundary);
+  CHECK(&cache_with_boundary != &cache);
+  CHECK(cache_with_boundary.interpolation_matrices.size() == 3);
+  const auto& other_cache =
+      Limiters::Weno_detail::constrained_fit_cache(other_mesh, element);
+  CHECK(&other_cache != &cache);
+  CHECK(other_cache.quadrature_weights.size() ==
+        other_mesh.number_of_grid_points());
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.HwenoImpl", "[Limiters][Unit]") {
   test_secondary_neighbors_to_exclude_from_fit();
+  test_constrained_fit_cache();
 
   // These functions test the constrained fit algorithm.
   // In particular, each function tests:
@@ -1395,12 +1443,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.HwenoImpl", "[Limiters][Unit]") {
   test_hweno_impl_3d();
 }
 
-// Separate the Gauss quadrature tests for two reasons:
-// 1. Generalizing the Hweno matrix static caches to handle both LGL and LG
-//    points in the same run would be somewhat tedious. By testing each basis
-//    in a separate SPECTRE_TEST_CASE, run in separate calls to the test
-//    executable, the static cache clashes are avoided.
-// 2. To keep the test case duration comfortably under the 2s time limit
+// Separate the Gauss quadrature tests to keep the test case duration
+// comfortably under the 2s time limit
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.HwenoImpl.GaussQuadrature",
                   "[Limiters][Unit]") {
   const auto gauss = Spectral::Quadrature::Gauss;
@@ -22,10 +22,11 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Structure/Side.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/SimpleWenoImpl.hpp"
+#include "Evolution/DiscontinuousGalerkin/Limiters/WenoGridHelpers.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoHelpers.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoOscillationIndicator.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/Limiters/TestHelpers.hpp"
-#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/LinearOperators/MeanValue.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
@@ -136,9 +137,9 @@ void test_simple_weno_work(
   // Buffers for simple WENO implementation
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-      intrp::RegularGrid<VolumeDim>,
+      const intrp::RegularGrid<VolumeDim>*,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
-      interpolator_buffer{};
+      interpolant_buffer{};
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
@@ -163,11 +164,20 @@ void test_simple_weno_work(
   // The "tensor" interface is a thin wrapper around the "single component"
   // interface, so no need to test both overloads separately.
   Limiters::Weno_detail::simple_weno_impl<VectorTag<VolumeDim>>(
-      make_not_null(&interpolator_buffer),
+      make_not_null(&interpolant_buffer),
       make_not_null(&modified_neighbor_solution_buffer),
       make_not_null(&vector_to_limit), neighbor_linear_weight, mesh, element,
       neighbor_data);
 
+  // The shared interpolant of each neighbor was retrieved once and reused for
+  // all components
+  CHECK(interpolant_buffer.size() == neighbor_data.size());
+  for (const auto& [neighbor, data] : neighbor_data) {
+    CHECK(interpolant_buffer.at(neighbor) ==
+          &Limiters::Weno_detail::neighbor_to_local_interpolant(
+              mesh, data.mesh, element, neighbor.first));
+  }
+
   for (size_t d = 0; d < VolumeDim; ++d) {
     CHECK(mean_value(vector_to_limit.get(d), mesh) ==
           approx(gsl::at(expected_vector_means, d)));
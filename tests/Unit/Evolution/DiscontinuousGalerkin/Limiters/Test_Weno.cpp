@@ -555,9 +555,9 @@ void test_simple_weno(const std::array<size_t, VolumeDim>& extents) noexcept {
   auto expected_vector = get<VectorTag<VolumeDim>>(local_vars);
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>,
-      intrp::RegularGrid<VolumeDim>,
+      const intrp::RegularGrid<VolumeDim>*,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
-      interpolator_buffer{};
+      interpolant_buffer{};
   std::unordered_map<
       std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>, DataVector,
       boost::hash<std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>>>
@@ -568,7 +568,7 @@ void test_simple_weno(const std::array<size_t, VolumeDim>& extents) noexcept {
         make_pair(neighbor, DataVector(mesh.number_of_grid_points())));
   }
   Limiters::Weno_detail::simple_weno_impl<VectorTag<VolumeDim>>(
-      make_not_null(&interpolator_buffer),
+      make_not_null(&interpolant_buffer),
       make_not_null(&modified_neighbor_solution_buffer),
       make_not_null(&expected_vector), neighbor_linear_weight,
       0,  // the x-component
@@ -636,14 +636,16 @@ void test_hweno(const std::array<size_t, VolumeDim>& extents) noexcept {
     modified_neighbor_solution_buffer.insert(
         make_pair(neighbor, DataVector(mesh.number_of_grid_points())));
   }
+  const auto& fit_cache =
+      Limiters::Weno_detail::constrained_fit_cache(mesh, element);
   Limiters::Weno_detail::hweno_impl<ScalarTag>(
       make_not_null(&modified_neighbor_solution_buffer),
       make_not_null(&expected_scalar), neighbor_linear_weight, mesh, element,
-      neighbor_data);
+      fit_cache, neighbor_data);
   Limiters::Weno_detail::hweno_impl<VectorTag<VolumeDim>>(
       make_not_null(&modified_neighbor_solution_buffer),
       make_not_null(&expected_vector), neighbor_linear_weight, mesh, element,
-      neighbor_data);
+      fit_cache, neighbor_data);
 
   CHECK(activated);
   CHECK_ITERABLE_CUSTOM_APPROX(expected_scalar, scalar, approx);
@@ -6,6 +6,8 @@
 #include <array>
 #include <cstddef>
 #include <functional>
+#include <thread>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -18,6 +20,7 @@
 #include "Domain/Structure/Side.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoGridHelpers.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/Limiters/TestHelpers.hpp"
+#include "NumericalAlgorithms/Interpolation/RegularGridInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
@@ -160,6 +163,52 @@ void test_grid_helpers_3d() {
   check_grid_point_transform_no_href(mesh, other_mesh, element);
 }
 
+void test_neighbor_to_local_interpolant() {
+  INFO("Testing WENO neighbor-to-local interpolant");
+  const auto element = TestHelpers::Limiters::make_element<2>();
+  const Mesh<2> mesh({{5, 6}}, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto);
+  const Mesh<2> other_mesh({{4, 6}}, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto);
+  const auto& interpolant =
+      Limiters::Weno_detail::neighbor_to_local_interpolant(
+          mesh, other_mesh, element, Direction<2>::lower_eta());
+  const auto target_coords =
+      Limiters::Weno_detail::local_grid_points_in_neighbor_logical_coords(
+          mesh, other_mesh, element, Direction<2>::lower_eta());
+  CHECK(interpolant == intrp::RegularGrid<2>(other_mesh, mesh, target_coords));
+
+  // The interpolant is computed once and then shared
+  CHECK(&interpolant == &Limiters::Weno_detail::neighbor_to_local_interpolant(
+                            mesh, other_mesh, element,
+                            Direction<2>::lower_eta()));
+  CHECK(&interpolant != &Limiters::Weno_detail::neighbor_to_local_interpolant(
+                            mesh, other_mesh, element,
+                            Direction<2>::upper_eta()));
+  CHECK(&interpolant != &Limiters::Weno_detail::neighbor_to_local_interpolant(
+                            mesh, mesh, element, Direction<2>::lower_eta()));
+
+  // Concurrent lookups of a new interpolant all share one instance
+  const Mesh<2> new_mesh({{3, 6}}, Spectral::Basis::Legendre,
+                         Spectral::Quadrature::GaussLobatto);
+  std::vector<const intrp::RegularGrid<2>*> concurrent_interpolants(4);
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < concurrent_interpolants.size(); ++i) {
+    threads.emplace_back([&concurrent_interpolants, &element, &mesh, &new_mesh,
+                          i]() noexcept {
+      concurrent_interpolants[i] =
+          &Limiters::Weno_detail::neighbor_to_local_interpolant(
+              mesh, new_mesh, element, Direction<2>::upper_xi());
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto* concurrent_interpolant : concurrent_interpolants) {
+    CHECK(concurrent_interpolant == concurrent_interpolants.front());
+  }
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.GridHelpers",
@@ -168,4 +217,5 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.Limiters.Weno.GridHelpers",
   test_grid_helpers_1d();
   test_grid_helpers_2d();
   test_grid_helpers_3d();
+  test_neighbor_to_local_interpolant();
 }
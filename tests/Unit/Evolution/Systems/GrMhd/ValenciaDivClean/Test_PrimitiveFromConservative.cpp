@@ -6,16 +6,20 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
 #include "Helpers/PointwiseFunctions/Hydro/TestHelpers.hpp"
@@ -228,6 +232,128 @@ void test_primitive_from_conservative_known(
                         divergence_cleaning_field);
 }
 
+template <size_t ThermodynamicDim>
+void test_newman_hamlin_batched(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& used_for_size) noexcept {
+  // In flat space the arguments of the recovery schemes follow directly from
+  // the primitives
+  const auto rest_mass_density =
+      TestHelpers::hydro::random_density(generator, used_for_size);
+  const auto lorentz_factor =
+      TestHelpers::hydro::random_lorentz_factor(generator, used_for_size);
+  auto spatial_metric =
+      make_with_value<tnsr::ii<DataVector, 3>>(used_for_size, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+  }
+  const auto spatial_velocity = TestHelpers::hydro::random_velocity(
+      generator, lorentz_factor, spatial_metric);
+  Scalar<DataVector> specific_internal_energy{};
+  Scalar<DataVector> pressure{};
+  if constexpr (ThermodynamicDim == 1) {
+    specific_internal_energy =
+        equation_of_state.specific_internal_energy_from_density(
+            rest_mass_density);
+    pressure = equation_of_state.pressure_from_density(rest_mass_density);
+  } else if constexpr (ThermodynamicDim == 2) {
+    specific_internal_energy =
+        TestHelpers::hydro::random_specific_internal_energy(generator,
+                                                            used_for_size);
+    pressure = equation_of_state.pressure_from_density_and_energy(
+        rest_mass_density, specific_internal_energy);
+  }
+  const auto magnetic_field = TestHelpers::hydro::random_magnetic_field(
+      generator, pressure, spatial_metric);
+
+  const DataVector expected_rho_h_w_squared =
+      get(rest_mass_density) *
+      get(hydro::relativistic_specific_enthalpy(
+          rest_mass_density, specific_internal_energy, pressure)) *
+      square(get(lorentz_factor));
+  const DataVector magnetic_field_squared =
+      get(dot_product(magnetic_field, magnetic_field, spatial_metric));
+  const DataVector velocity_dot_magnetic_field =
+      get(dot_product(spatial_velocity, magnetic_field, spatial_metric));
+  const DataVector total_energy_density =
+      expected_rho_h_w_squared - get(pressure) + magnetic_field_squared -
+      0.5 * (square(velocity_dot_magnetic_field) +
+             magnetic_field_squared / square(get(lorentz_factor)));
+  DataVector momentum_density_squared{used_for_size.size(), 0.0};
+  for (size_t i = 0; i < 3; ++i) {
+    momentum_density_squared +=
+        square((expected_rho_h_w_squared + magnetic_field_squared) *
+                   spatial_velocity.get(i) -
+               velocity_dot_magnetic_field * magnetic_field.get(i));
+  }
+  DataVector momentum_density_dot_magnetic_field =
+      expected_rho_h_w_squared * velocity_dot_magnetic_field;
+  const DataVector rest_mass_density_times_lorentz_factor =
+      get(rest_mass_density) * get(lorentz_factor);
+  // The recovery fails at the second point, since the momentum density and
+  // magnetic field can't satisfy the Cauchy-Schwarz inequality
+  momentum_density_dot_magnetic_field[1] =
+      2.0 * sqrt(momentum_density_squared[1] * magnetic_field_squared[1]) + 1.0;
+
+  const auto check = [&](const DataVector& initial_pressure) noexcept {
+    std::vector<size_t> points{};
+    for (size_t s = 0; s < used_for_size.size(); ++s) {
+      points.push_back(s);
+    }
+    DataVector recovered_rest_mass_density{used_for_size.size(), -1.0};
+    DataVector recovered_lorentz_factor{used_for_size.size(), -1.0};
+    DataVector recovered_pressure = initial_pressure;
+    DataVector recovered_rho_h_w_squared{used_for_size.size(), -1.0};
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin::apply(
+        make_not_null(&recovered_rest_mass_density),
+        make_not_null(&recovered_lorentz_factor),
+        make_not_null(&recovered_pressure),
+        make_not_null(&recovered_rho_h_w_squared), make_not_null(&points),
+        total_energy_density, momentum_density_squared,
+        momentum_density_dot_magnetic_field, magnetic_field_squared,
+        rest_mass_density_times_lorentz_factor, equation_of_state);
+    CHECK(points == std::vector<size_t>{1});
+    // Nothing is written at the point where the recovery failed
+    CHECK(recovered_rest_mass_density[1] == -1.0);
+    CHECK(recovered_pressure[1] == initial_pressure[1]);
+
+    Approx larger_approx =
+        Approx::custom().epsilon(std::numeric_limits<double>::epsilon() * 1.e8);
+    for (size_t s = 0; s < used_for_size.size(); ++s) {
+      const auto primitive_data = grmhd::ValenciaDivClean::
+          PrimitiveRecoverySchemes::NewmanHamlin::apply<ThermodynamicDim>(
+              initial_pressure[s], total_energy_density[s],
+              momentum_density_squared[s],
+              momentum_density_dot_magnetic_field[s],
+              magnetic_field_squared[s],
+              rest_mass_density_times_lorentz_factor[s], equation_of_state);
+      if (s == 1) {
+        CHECK_FALSE(primitive_data.has_value());
+        continue;
+      }
+      REQUIRE(primitive_data.has_value());
+      // The batched recovery does the same iteration at each point
+      CHECK(recovered_rest_mass_density[s] ==
+            approx(primitive_data->rest_mass_density));
+      CHECK(recovered_lorentz_factor[s] ==
+            approx(primitive_data->lorentz_factor));
+      CHECK(recovered_pressure[s] == approx(primitive_data->pressure));
+      CHECK(recovered_rho_h_w_squared[s] ==
+            approx(primitive_data->rho_h_w_squared));
+      CHECK(recovered_rest_mass_density[s] ==
+            larger_approx(get(rest_mass_density)[s]));
+      CHECK(recovered_lorentz_factor[s] ==
+            larger_approx(get(lorentz_factor)[s]));
+      CHECK(recovered_pressure[s] == larger_approx(get(pressure)[s]));
+    }
+  };
+  check(DataVector{used_for_size.size(), 0.0});
+  // Warm start from pressures close to the solution, as in an evolution
+  check(DataVector{1.01 * get(pressure)});
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -267,4 +393,13 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       tmpl::list<
           grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl>,
       2>(&generator, ideal_fluid, dv);
+
+  const DataVector larger_dv(20);
+  test_newman_hamlin_batched<1>(&generator, polytropic_fluid, larger_dv);
+  test_newman_hamlin_batched<2>(&generator, ideal_fluid, larger_dv);
+  test_primitive_from_conservative_random<
+      tmpl::list<
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+          grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl>,
+      2>(&generator, ideal_fluid, larger_dv);
 }
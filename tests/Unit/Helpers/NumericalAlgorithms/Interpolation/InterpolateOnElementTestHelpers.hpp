@@ -8,6 +8,7 @@
 #include <cmath>
 #include <cstddef>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -21,6 +22,7 @@
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/Interpolation/Actions/InterpolationTargetVarsFromElement.hpp"
+#include "NumericalAlgorithms/Interpolation/AddTemporalIdsToInterpolationTarget.hpp"
 #include "NumericalAlgorithms/Interpolation/InterpolationTarget.hpp"
 #include "NumericalAlgorithms/Interpolation/PointInfoTag.hpp"
 #include "NumericalAlgorithms/Interpolation/Tags.hpp"
@@ -34,6 +36,7 @@
 #include "Utilities/TMPL.hpp"
 
 /// Holds code that is shared between multiple tests. Currently used by
+/// - Test_InterpolateOnElements
 /// - Test_InterpolateToTarget
 /// - Test_InterpolateWithoutInterpolatorComponent.
 namespace InterpolateOnElementTestHelpers {
@@ -134,6 +137,18 @@ struct MockInterpolationTargetVarsFromElement {
   }
 };
 
+// Events that go through the InterpolationTarget's usual machinery also
+// tell it about the temporal_id; here there is nothing to do with it.
+template <typename InterpolationTargetTag>
+struct MockAddTemporalIdsToInterpolationTarget {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename TemporalId>
+  static void apply(db::DataBox<DbTags>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const std::vector<TemporalId>& /*temporal_ids*/) noexcept {}
+};
+
 template <typename Metavariables, typename InterpolationTargetTag>
 struct mock_interpolation_target {
   using metavariables = Metavariables;
@@ -145,11 +160,14 @@ struct mock_interpolation_target {
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       typename Metavariables::Phase, Metavariables::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
-  using replace_these_simple_actions =
-      tmpl::list<intrp::Actions::InterpolationTargetVarsFromElement<
+  using replace_these_simple_actions = tmpl::list<
+      intrp::Actions::InterpolationTargetVarsFromElement<
+          InterpolationTargetTag>,
+      intrp::Actions::AddTemporalIdsToInterpolationTarget<
           InterpolationTargetTag>>;
   using with_these_simple_actions = tmpl::list<
-      MockInterpolationTargetVarsFromElement<InterpolationTargetTag>>;
+      MockInterpolationTargetVarsFromElement<InterpolationTargetTag>,
+      MockAddTemporalIdsToInterpolationTarget<InterpolationTargetTag>>;
 };
 
 template <typename DomainCreator>
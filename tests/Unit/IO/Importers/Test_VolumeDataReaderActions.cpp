@@ -21,6 +21,7 @@
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
 #include "IO/Importers/Actions/ReadVolumeData.hpp"
 #include "IO/Importers/Actions/ReceiveVolumeData.hpp"
 #include "IO/Importers/Actions/RegisterWithElementDataReader.hpp"
@@ -92,9 +93,10 @@ struct Metavariables {
   enum class Phase { Initialization, Testing };
 };
 
-}  // namespace
-
-SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeDataReaderActions", "[Unit][IO]") {
+// When `use_index` is true the data is written to two shards and the reader is
+// given a file that holds an `h5::VolumeDataIndex` of the shards
+void test_read_volume_data(const bool use_index) noexcept {
+  CAPTURE(use_index);
   using reader_component = MockVolumeDataReader<Metavariables>;
   using element_array = MockElementArray<Metavariables>;
 
@@ -184,14 +186,44 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeDataReaderActions", "[Unit][IO]") {
                                 {2, Spectral::Basis::Legendre},
                                 {2, Spectral::Quadrature::GaussLobatto}});
   }
-  // Write the sample data into an H5 file
+  // Write the sample data into an H5 file, or split it between two shards and
+  // index them
   const std::string h5_file_name = "TestVolumeData.h5";
-  if (file_system::check_if_file_exists(h5_file_name)) {
-    file_system::rm(h5_file_name, true);
+  const std::vector<std::string> shard_file_names{"TestVolumeDataShard0.h5",
+                                                  "TestVolumeDataShard1.h5"};
+  const auto remove_files = [&h5_file_name, &shard_file_names]() noexcept {
+    for (const auto& file_name : shard_file_names) {
+      if (file_system::check_if_file_exists(file_name)) {
+        file_system::rm(file_name, true);
+      }
+    }
+    if (file_system::check_if_file_exists(h5_file_name)) {
+      file_system::rm(h5_file_name, true);
+    }
+  };
+  remove_files();
+  if (use_index) {
+    // The first shard holds the first two elements, the second shard holds
+    // the rest
+    const auto shard_boundary = all_element_data.begin() + 2;
+    for (size_t shard = 0; shard < 2; ++shard) {
+      h5::H5File<h5::AccessType::ReadWrite> shard_file{
+          shard_file_names[shard], false};
+      auto& volume_data = shard_file.insert<h5::VolumeData>("/element_data", 0);
+      volume_data.write_volume_data(
+          0, 0.,
+          shard == 0 ? std::vector<ElementVolumeData>{all_element_data.begin(),
+                                                      shard_boundary}
+                     : std::vector<ElementVolumeData>{shard_boundary,
+                                                      all_element_data.end()});
+    }
+    h5::write_volume_data_index(h5_file_name, shard_file_names,
+                                "/element_data");
+  } else {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_name, false};
+    auto& volume_data = h5_file.insert<h5::VolumeData>("/element_data", 0);
+    volume_data.write_volume_data(0, 0., all_element_data);
   }
-  h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_name, false};
-  auto& volume_data = h5_file.insert<h5::VolumeData>("/element_data", 0);
-  volume_data.write_volume_data(0, 0., all_element_data);
 
   ActionTesting::set_phase(make_not_null(&runner),
                            Metavariables::Phase::Testing);
@@ -222,7 +254,11 @@ SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeDataReaderActions", "[Unit][IO]") {
     first_invocation = false;
   }
 
-  if (file_system::check_if_file_exists(h5_file_name)) {
-    file_system::rm(h5_file_name, true);
-  }
+  remove_files();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Importers.VolumeDataReaderActions", "[Unit][IO]") {
+  test_read_volume_data(false);
+  test_read_volume_data(true);
 }
@@ -24,6 +24,10 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
       "ContributorsOfTensorData");
   TestHelpers::db::test_simple_tag<VolumeDataLock>("VolumeDataLock");
   TestHelpers::db::test_simple_tag<TensorData>("TensorData");
+  TestHelpers::db::test_simple_tag<VolumeDataWriteQueue>(
+      "VolumeDataWriteQueue");
+  TestHelpers::db::test_simple_tag<VolumeDataWriterIsActive>(
+      "VolumeDataWriterIsActive");
   TestHelpers::db::test_simple_tag<ReductionData<double>>("ReductionData");
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
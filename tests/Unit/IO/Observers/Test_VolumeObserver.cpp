@@ -4,11 +4,15 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/range/combine.hpp>
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -161,6 +165,15 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   // to move the volume data to the Writer parallel component.
   runner.invoke_queued_threaded_action<obs_writer>(0);
   CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
+  // The writer drains the queue of volume data completely.
+  CHECK(ActionTesting::get_databox_tag<obs_writer,
+                                       observers::Tags::VolumeDataWriteQueue>(
+            runner, 0)
+            .empty());
+  CHECK_FALSE(
+      ActionTesting::get_databox_tag<obs_writer,
+                                     observers::Tags::VolumeDataWriterIsActive>(
+          runner, 0));
 
   REQUIRE(file_system::check_if_file_exists(h5_file_name));
   // Check that the H5 file was written correctly.
@@ -261,3 +274,57 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
     file_system::rm(h5_file_name, true);
   }
 }
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver.WriteQueue",
+                  "[Unit][Observers]") {
+  // A producer that finds the write queue full waits until the writer frees a
+  // slot, not until the writer has drained the queue
+  constexpr size_t maximum_size = observers::ThreadedActions::
+      ContributeVolumeDataToWriter::maximum_queued_observations;
+  std::mutex volume_data_lock{};
+  observers::Tags::VolumeDataWriteQueue::type write_queue{};
+  for (size_t i = 0; i < maximum_size + 2; ++i) {
+    write_queue.emplace_back(
+        "/element_data",
+        observers::ObservationId{static_cast<double>(i), "ObservationType"},
+        std::vector<ElementVolumeData>{});
+  }
+  bool writer_is_active = true;
+  std::atomic<bool> producer_resumed{false};
+  std::thread producer{[&volume_data_lock, &write_queue, &writer_is_active,
+                        &producer_resumed]() noexcept {
+    observers::ThreadedActions::VolumeActions_detail::
+        wait_for_space_in_write_queue(
+            make_not_null(&volume_data_lock), make_not_null(&write_queue),
+            make_not_null(&writer_is_active), maximum_size);
+    producer_resumed = true;
+  }};
+  const auto pop_one_observation = [&volume_data_lock, &write_queue]() {
+    const std::lock_guard<std::mutex> lock{volume_data_lock};
+    write_queue.pop_front();
+  };
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK_FALSE(producer_resumed);
+  // The queue is still full after the writer takes the first observation
+  pop_one_observation();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  CHECK_FALSE(producer_resumed);
+  // Taking the second observation frees a slot
+  pop_one_observation();
+  producer.join();
+  CHECK(producer_resumed);
+  CHECK(write_queue.size() == maximum_size);
+
+  // A producer doesn't wait when no thread is writing
+  write_queue.emplace_back("/element_data",
+                           observers::ObservationId{-1., "ObservationType"},
+                           std::vector<ElementVolumeData>{});
+  write_queue.emplace_back("/element_data",
+                           observers::ObservationId{-2., "ObservationType"},
+                           std::vector<ElementVolumeData>{});
+  writer_is_active = false;
+  observers::ThreadedActions::VolumeActions_detail::
+      wait_for_space_in_write_queue(
+          make_not_null(&volume_data_lock), make_not_null(&write_queue),
+          make_not_null(&writer_is_active), maximum_size);
+}
@@ -282,6 +282,32 @@ void test() {
     CHECK(last_grid_offset_and_length.second == 8);
   }
 
+  {
+    INFO("offsets_and_lengths_for_grids");
+    const size_t observation_id = observation_ids.front();
+    const auto all_grid_names = volume_file.get_grid_names(observation_id);
+    const auto all_extents = volume_file.get_extents(observation_id);
+    const auto offsets_and_lengths =
+        h5::offsets_and_lengths_for_grids(all_grid_names, all_extents);
+    CHECK(offsets_and_lengths.size() == all_grid_names.size());
+    for (const auto& grid_name : all_grid_names) {
+      CHECK(offsets_and_lengths.at(grid_name) ==
+            h5::offset_and_length_for_grid(grid_name, all_grid_names,
+                                           all_extents));
+    }
+
+    INFO("Read part of a tensor component");
+    auto all_data = volume_file.get_tensor_component(observation_id, "S");
+    for (const auto& grid_name : all_grid_names) {
+      const auto& [offset, length] = offsets_and_lengths.at(grid_name);
+      CHECK(volume_file.get_tensor_component(observation_id, "S", offset,
+                                             length) ==
+            DataVector(&all_data[offset], length));
+    }
+    CHECK(volume_file.get_tensor_component(observation_id, "S", 3, 10) ==
+          DataVector(&all_data[3], 10));
+  }
+
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -0,0 +1,144 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/H5/VolumeDataIndex.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+ElementVolumeData make_element(const std::string& grid_name,
+                               const std::vector<size_t>& extents,
+                               const double value) noexcept {
+  size_t number_of_points = 1;
+  for (const size_t extent : extents) {
+    number_of_points *= extent;
+  }
+  return {extents,
+          {TensorComponent{grid_name + "/S", DataVector{number_of_points,
+                                                         value}}},
+          std::vector<Spectral::Basis>(extents.size(),
+                                       Spectral::Basis::Legendre),
+          std::vector<Spectral::Quadrature>(
+              extents.size(), Spectral::Quadrature::GaussLobatto)};
+}
+
+void remove_files(const std::vector<std::string>& file_names) noexcept {
+  for (const auto& file_name : file_names) {
+    if (file_system::check_if_file_exists(file_name)) {
+      file_system::rm(file_name, true);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeDataIndex", "[Unit][IO][H5]") {
+  const std::vector<std::string> shard_file_names{
+      "Unit.IO.H5.VolumeDataIndex0.h5", "Unit.IO.H5.VolumeDataIndex1.h5"};
+  const std::string index_file_name{"Unit.IO.H5.VolumeDataIndex.h5"};
+  remove_files(shard_file_names);
+  remove_files({index_file_name});
+
+  // The first shard holds two grids at both observations, the second shard
+  // holds one grid at the first observation only
+  const size_t first_observation_id = 4444;
+  const size_t second_observation_id = 5555;
+  {
+    h5::H5File<h5::AccessType::ReadWrite> shard_file{shard_file_names[0]};
+    auto& volume_file = shard_file.insert<h5::VolumeData>("/element_data");
+    for (const auto& [observation_id, observation_value] :
+         {std::make_pair(first_observation_id, 1.0),
+          std::make_pair(second_observation_id, 2.0)}) {
+      volume_file.write_volume_data(
+          observation_id, observation_value,
+          {make_element("[[0]]", {2, 3}, 1.0),
+           make_element("[[1]]", {4, 4}, 2.0)});
+    }
+  }
+  {
+    h5::H5File<h5::AccessType::ReadWrite> shard_file{shard_file_names[1]};
+    auto& volume_file = shard_file.insert<h5::VolumeData>("/element_data");
+    volume_file.write_volume_data(first_observation_id, 1.0,
+                                  {make_element("[[2]]", {3, 3}, 3.0)});
+  }
+
+  h5::write_volume_data_index(index_file_name, shard_file_names,
+                              "/element_data");
+
+  h5::H5File<h5::AccessType::ReadOnly> index_file{index_file_name};
+  const auto& index = index_file.get<h5::VolumeDataIndex>("/element_data");
+  CHECK(index.get_version() == 1);
+  CHECK(index.get_header().substr(0, 20) == "#\n# File created on ");
+  CHECK(index.list_observation_ids() ==
+        std::vector<size_t>{first_observation_id, second_observation_id});
+  CHECK(index.get_observation_value(first_observation_id) == 1.0);
+  CHECK(index.get_observation_value(second_observation_id) == 2.0);
+  CHECK(index.find_observation_id(1.0) == first_observation_id);
+  CHECK(index.find_observation_id(2.0) == second_observation_id);
+  CHECK(index.get_shard_file_names(first_observation_id) == shard_file_names);
+  CHECK(index.get_shard_file_names(second_observation_id) == shard_file_names);
+
+  const auto check_location = [](const h5::GridLocation& location,
+                                 const size_t shard, const size_t offset,
+                                 const size_t length) noexcept {
+    CHECK(location.shard == shard);
+    CHECK(location.offset == offset);
+    CHECK(location.length == length);
+  };
+  {
+    INFO("First observation");
+    const auto grid_locations = index.get_grid_locations(first_observation_id);
+    REQUIRE(grid_locations.size() == 3);
+    check_location(grid_locations.at("[[0]]"), 0, 0, 6);
+    check_location(grid_locations.at("[[1]]"), 0, 6, 16);
+    check_location(grid_locations.at("[[2]]"), 1, 0, 9);
+  }
+  {
+    INFO("Second observation");
+    const auto grid_locations =
+        index.get_grid_locations(second_observation_id);
+    REQUIRE(grid_locations.size() == 2);
+    check_location(grid_locations.at("[[0]]"), 0, 0, 6);
+    check_location(grid_locations.at("[[1]]"), 0, 6, 16);
+  }
+  {
+    INFO("Consistent with offset_and_length_for_grid");
+    h5::H5File<h5::AccessType::ReadOnly> shard_file{shard_file_names[0]};
+    const auto& volume_file = shard_file.get<h5::VolumeData>("/element_data");
+    const auto all_grid_names =
+        volume_file.get_grid_names(first_observation_id);
+    const auto all_extents = volume_file.get_extents(first_observation_id);
+    const auto grid_locations = index.get_grid_locations(first_observation_id);
+    for (const auto& grid_name : all_grid_names) {
+      const auto [offset, length] = h5::offset_and_length_for_grid(
+          grid_name, all_grid_names, all_extents);
+      CHECK(grid_locations.at(grid_name).offset == offset);
+      CHECK(grid_locations.at(grid_name).length == length);
+    }
+  }
+
+  {
+    INFO("Shard file paths are relative to the index file");
+    CHECK(h5::shard_file_path(index_file_name, shard_file_names[0]) ==
+          "./" + shard_file_names[0]);
+    CHECK(h5::shard_file_path("Dir/Index.h5", "Shard0.h5") ==
+          "Dir/Shard0.h5");
+    CHECK(h5::shard_file_path("Dir/Index.h5", "/Data/Shard0.h5") ==
+          "/Data/Shard0.h5");
+  }
+
+  remove_files(shard_file_names);
+  remove_files({index_file_name});
+}
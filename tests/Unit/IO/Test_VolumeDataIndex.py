@@ -0,0 +1,111 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+from spectre import DataStructures as ds
+from spectre.Spectral import Basis, Quadrature
+import spectre.IO.H5 as spectre_h5
+from spectre.IO.H5.WriteVolumeDataIndex import write_index
+from spectre import Informer
+import unittest
+import numpy as np
+import os
+
+
+class TestVolumeDataIndex(unittest.TestCase):
+    # Test Fixtures
+    def setUp(self):
+        # Two shards of volume data, as written by two nodes. The first shard
+        # holds two grids at both observations, the second shard holds one
+        # grid at the first observation only.
+        self.test_dir = os.path.join(Informer.unit_test_build_path(), "IO")
+        self.file_prefix = os.path.join(self.test_dir, "TestVolumeDataIndex")
+        self.shard_file_names = [
+            self.file_prefix + str(i) + ".h5" for i in range(2)
+        ]
+        self.index_file_name = os.path.join(self.test_dir,
+                                            "TestVolumeDataIndex.h5")
+        self.remove_files()
+
+        def element(grid_name, extents, value):
+            number_of_points = int(np.prod(extents))
+            return ds.ElementVolumeData(
+                extents, [
+                    ds.TensorComponent(grid_name + "/S",
+                                       ds.DataVector(number_of_points, value))
+                ],
+                len(extents) * [Basis.Legendre],
+                len(extents) * [Quadrature.GaussLobatto])
+
+        # The shard files are closed when the `H5File` objects are deleted
+        shard_file = spectre_h5.H5File(file_name=self.shard_file_names[0],
+                                       mode="a")
+        shard_file.insert_vol("/element_data", version=0)
+        vol_file = shard_file.get_vol(path="/element_data")
+        for observation_id, observation_value in [(4, 1.), (5, 2.)]:
+            vol_file.write_volume_data(
+                observation_id, observation_value,
+                [element("[[0]]", [2, 3], 1.),
+                 element("[[1]]", [4, 4], 2.)])
+        shard_file.close()
+        del shard_file
+        shard_file = spectre_h5.H5File(file_name=self.shard_file_names[1],
+                                       mode="a")
+        shard_file.insert_vol("/element_data", version=0)
+        vol_file = shard_file.get_vol(path="/element_data")
+        vol_file.write_volume_data(4, 1., [element("[[2]]", [3, 3], 3.)])
+        shard_file.close()
+        del shard_file
+
+    def tearDown(self):
+        self.remove_files()
+
+    def remove_files(self):
+        for file_name in self.shard_file_names + [self.index_file_name]:
+            if os.path.isfile(file_name):
+                os.remove(file_name)
+
+    def check_index(self, expected_shard_file_names):
+        index_file = spectre_h5.H5File(file_name=self.index_file_name,
+                                       mode="r")
+        index = index_file.get_vol_index(path="/element_data")
+        self.assertEqual(index.get_header()[0:20], "#\n# File created on ")
+        self.assertEqual(index.list_observation_ids(), [4, 5])
+        self.assertEqual(index.get_observation_value(observation_id=5), 2.)
+        self.assertEqual(index.find_observation_id(observation_value=1.), 4)
+        self.assertEqual(index.get_shard_file_names(observation_id=4),
+                         expected_shard_file_names)
+        grid_locations = index.get_grid_locations(observation_id=4)
+        self.assertEqual(
+            {
+                name: (location.shard, location.offset, location.length)
+                for name, location in grid_locations.items()
+            }, {
+                "[[0]]": (0, 0, 6),
+                "[[1]]": (0, 6, 16),
+                "[[2]]": (1, 0, 9)
+            })
+        self.assertEqual(
+            set(index.get_grid_locations(observation_id=5).keys()),
+            {"[[0]]", "[[1]]"})
+        index_file.close()
+
+    def test_write_volume_data_index(self):
+        spectre_h5.write_volume_data_index(
+            index_file_name=self.index_file_name,
+            shard_file_names=self.shard_file_names,
+            subfile_name="/element_data")
+        self.check_index(self.shard_file_names)
+
+    def test_write_index_script(self):
+        # The index file matches the prefix of the shards, but is not indexed
+        # itself because its name is not followed by a number
+        write_index(file_prefix=self.file_prefix,
+                    index_file=self.index_file_name,
+                    subfile_name="/element_data")
+        self.check_index([
+            os.path.basename(file_name) for file_name in self.shard_file_names
+        ])
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,400 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/Shell.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/NumericalAlgorithms/Interpolation/InterpolateOnElementTestHelpers.hpp"
+#include "Helpers/NumericalAlgorithms/Interpolation/InterpolationTargetTestHelpers.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/ElementReceiveInterpPointsAtTemporalId.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/ElementReceiveVolumeVars.hpp"
+#include "NumericalAlgorithms/Interpolation/Actions/SendPointsToInterpolator.hpp"
+#include "NumericalAlgorithms/Interpolation/ElementInterpolationInfo.hpp"
+#include "NumericalAlgorithms/Interpolation/Events/InterpolateOnElements.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
+#include "NumericalAlgorithms/Interpolation/InterpolationTargetLineSegment.hpp"
+#include "NumericalAlgorithms/Interpolation/PointInfoTag.hpp"
+#include "NumericalAlgorithms/Interpolation/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+
+template <typename Metavariables>
+struct mock_element {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<Metavariables::volume_dim>;
+  using simple_tags =
+      tmpl::list<intrp::Tags::ElementInterpolationInfos<Metavariables>>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<typename Metavariables::Phase,
+                             Metavariables::Phase::Initialization,
+                             tmpl::list<ActionTesting::InitializeDataBox<
+                                 simple_tags>>>>;
+};
+
+template <typename Metavariables, typename ElemComponent>
+struct initialize_elements_and_queue_simple_actions {
+  template <typename InterpPointInfo, typename Runner, typename TemporalId>
+  void operator()(const DomainCreator<3>& domain_creator,
+                  const Domain<3>& domain,
+                  const std::vector<ElementId<3>>& element_ids,
+                  const InterpPointInfo& interp_point_info, Runner& runner,
+                  const TemporalId& temporal_id) noexcept {
+    using metavars = Metavariables;
+    using elem_component = ElemComponent;
+    using target_tag = typename metavars::InterpolationTargetA;
+    using infos_tag = intrp::Tags::ElementInterpolationInfos<metavars>;
+    using info_tag =
+        intrp::Vars::ElementInterpolationInfoTag<target_tag, metavars>;
+
+    // Emplace elements.
+    for (const auto& element_id : element_ids) {
+      ActionTesting::emplace_component_and_initialize<elem_component>(
+          &runner, element_id, {typename infos_tag::type{}});
+    }
+    ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
+
+    // Create event.
+    typename metavars::event event{};
+
+    CHECK(event.needs_evolved_variables());
+
+    // These are what the InterpolationTarget would send to every Element.
+    const auto& block_logical_coords =
+        get<intrp::Vars::PointInfoTag<target_tag, metavars::volume_dim>>(
+            interp_point_info);
+
+    // Run event on all elements.  Alternate whether the points or the
+    // volume data arrive first, since both orders are possible.
+    bool points_arrive_first = true;
+    for (const auto& element_id : element_ids) {
+      const auto& info = get<info_tag>(
+          ActionTesting::get_databox_tag<elem_component, infos_tag>(
+              runner, element_id));
+
+      if (points_arrive_first) {
+        ActionTesting::simple_action<
+            elem_component,
+            intrp::Actions::ElementReceiveInterpPointsAtTemporalId<
+                target_tag>>(make_not_null(&runner), element_id, temporal_id,
+                             block_logical_coords);
+        CHECK(info.points.size() == 1);
+        CHECK(info.volume_vars.empty());
+      }
+
+      // 1. Get vars and mesh
+      const auto& [vars, mesh] =
+          InterpolateOnElementTestHelpers::make_volume_data_and_mesh(
+              domain_creator, domain, element_id);
+
+      // 2. Make a box
+      const auto box = db::create<
+          db::AddSimpleTags<Parallel::Tags::MetavariablesImpl<metavars>,
+                            typename metavars::temporal_id,
+                            domain::Tags::Mesh<metavars::volume_dim>,
+                            ::Tags::Variables<typename std::remove_reference_t<
+                                decltype(vars)>::tags_list>>>(
+          metavars{}, temporal_id, mesh, vars);
+
+      // 3. Run the event.  This will invoke a simple action on the
+      // element itself, and one on the InterpolationTarget.
+      event.run(box,
+                ActionTesting::cache<elem_component>(runner, element_id),
+                element_id, std::add_pointer_t<elem_component>{});
+      runner.template invoke_queued_simple_action<elem_component>(element_id);
+
+      if (not points_arrive_first) {
+        CHECK(info.points.empty());
+        CHECK(info.volume_vars.size() == 1);
+        ActionTesting::simple_action<
+            elem_component,
+            intrp::Actions::ElementReceiveInterpPointsAtTemporalId<
+                target_tag>>(make_not_null(&runner), element_id, temporal_id,
+                             block_logical_coords);
+      }
+
+      // Once both have arrived, nothing is held on the element.
+      CHECK(info.points.empty());
+      CHECK(info.volume_vars.empty());
+      CHECK(ActionTesting::is_simple_action_queue_empty<elem_component>(
+          runner, element_id));
+      points_arrive_first = not points_arrive_first;
+    }
+  }
+};
+
+template <bool HaveComputeItemsOnSource>
+struct MockMetavariables {
+  struct InterpolationTargetA {
+    using vars_to_interpolate_to_target = tmpl::list<tmpl::conditional_t<
+        HaveComputeItemsOnSource,
+        InterpolateOnElementTestHelpers::Tags::MultiplyByTwo,
+        InterpolateOnElementTestHelpers::Tags::TestSolution>>;
+    using compute_items_on_source = tmpl::conditional_t<
+        HaveComputeItemsOnSource,
+        tmpl::list<InterpolateOnElementTestHelpers::Tags::MultiplyByTwoCompute>,
+        tmpl::list<>>;
+    struct compute_target_points {
+      using is_sequential = std::false_type;
+    };
+    using interpolating_component = mock_element<MockMetavariables>;
+    static constexpr bool interpolate_on_elements = true;
+  };
+  using temporal_id = ::Tags::TimeStepId;
+  static constexpr size_t volume_dim = 3;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+
+  using component_list =
+      tmpl::list<InterpolateOnElementTestHelpers::mock_interpolation_target<
+                     MockMetavariables, InterpolationTargetA>,
+                 mock_element<MockMetavariables>>;
+
+  using event = intrp::Events::InterpolateOnElements<
+      volume_dim, InterpolationTargetA, MockMetavariables,
+      tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<tmpl::pair<Event, tmpl::list<event>>>;
+  };
+
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+template <typename MockMetavariables>
+void run_test() noexcept {
+  using metavars = MockMetavariables;
+  using elem_component = mock_element<metavars>;
+  InterpolateOnElementTestHelpers::test_interpolate_on_element<metavars,
+                                                               elem_component>(
+      initialize_elements_and_queue_simple_actions<metavars, elem_component>{});
+}
+
+// The target sends its points to the elements of the interpolating_component
+// through `SendPointsToInterpolator`, instead of to the Interpolator.
+struct SendPointsMetavariables {
+  struct InterpolationTargetA {
+    using vars_to_interpolate_to_target =
+        tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
+    using compute_items_on_target = tmpl::list<>;
+    using compute_target_points =
+        ::intrp::TargetPoints::LineSegment<InterpolationTargetA, 3>;
+    using interpolating_component = mock_element<SendPointsMetavariables>;
+    static constexpr bool interpolate_on_elements = true;
+  };
+  using temporal_id = ::Tags::TimeStepId;
+  static constexpr size_t volume_dim = 3;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+
+  using component_list =
+      tmpl::list<InterpTargetTestHelpers::mock_interpolation_target<
+                     SendPointsMetavariables, InterpolationTargetA>,
+                 mock_element<SendPointsMetavariables>>;
+
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+void test_send_points_to_elements() noexcept {
+  domain::creators::register_derived_with_charm();
+  using metavars = SendPointsMetavariables;
+  using target_tag = typename metavars::InterpolationTargetA;
+  using target_component =
+      InterpTargetTestHelpers::mock_interpolation_target<metavars, target_tag>;
+  using elem_component = mock_element<metavars>;
+  using infos_tag = intrp::Tags::ElementInterpolationInfos<metavars>;
+  using info_tag =
+      intrp::Vars::ElementInterpolationInfoTag<target_tag, metavars>;
+
+  // The segment avoids the boundaries between blocks and elements, so every
+  // point lies in exactly one element
+  const size_t number_of_points = 10;
+  const auto domain_creator =
+      domain::creators::Shell(0.9, 4.9, 1, {{5, 5}}, false);
+  const auto domain = domain_creator.create_domain();
+  tuples::TaggedTuple<intrp::Tags::LineSegment<target_tag, 3>,
+                      domain::Tags::Domain<3>>
+      tuple_of_opts{intrp::OptionHolders::LineSegment<3>{{{1.0, 0.3, 0.25}},
+                                                         {{2.0, 1.5, -0.35}},
+                                                         number_of_points},
+                    domain_creator.create_domain()};
+  ActionTesting::MockRuntimeSystem<metavars> runner{std::move(tuple_of_opts)};
+  ActionTesting::set_phase(make_not_null(&runner),
+                           metavars::Phase::Initialization);
+  ActionTesting::emplace_component<target_component>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<target_component>(make_not_null(&runner), 0);
+  }
+  std::vector<ElementId<3>> element_ids{};
+  for (const auto& block : domain.blocks()) {
+    const auto block_element_ids = initial_element_ids(
+        block.id(), domain_creator.initial_refinement_levels()[block.id()]);
+    element_ids.insert(element_ids.end(), block_element_ids.begin(),
+                       block_element_ids.end());
+  }
+  for (const auto& element_id : element_ids) {
+    ActionTesting::emplace_component_and_initialize<elem_component>(
+        &runner, element_id, {typename infos_tag::type{}});
+  }
+  ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
+
+  const Slab slab(0.0, 1.0);
+  const TimeStepId temporal_id(true, 0, Time(slab, 0));
+  ActionTesting::simple_action<
+      target_component, intrp::Actions::SendPointsToInterpolator<target_tag>>(
+      make_not_null(&runner), 0, temporal_id);
+  CHECK(
+      ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
+
+  // Every element receives the points and keeps those that lie in it until
+  // its volume data arrive
+  std::vector<size_t> received_offsets{};
+  for (const auto& element_id : element_ids) {
+    ActionTesting::invoke_queued_simple_action<elem_component>(
+        make_not_null(&runner), element_id);
+    CHECK(ActionTesting::is_simple_action_queue_empty<elem_component>(
+        runner, element_id));
+    const auto& info =
+        get<info_tag>(ActionTesting::get_databox_tag<elem_component, infos_tag>(
+            runner, element_id));
+    CHECK(info.volume_vars.empty());
+    REQUIRE(info.points.count(temporal_id) == 1);
+    const auto& points = info.points.at(temporal_id);
+    CHECK(get<0>(points.element_logical_coords).size() ==
+          points.offsets.size());
+    received_offsets.insert(received_offsets.end(), points.offsets.begin(),
+                            points.offsets.end());
+  }
+  std::sort(received_offsets.begin(), received_offsets.end());
+  std::vector<size_t> expected_offsets(number_of_points);
+  std::iota(expected_offsets.begin(), expected_offsets.end(), 0_st);
+  CHECK(received_offsets == expected_offsets);
+}
+
+// A target with an `interpolating_component` that doesn't opt in to
+// interpolating on elements, like the `KerrHorizon` targets of the evolution
+// executables, still sends its points to the Interpolator.
+struct KeepInterpolatorMetavariables {
+  struct InterpolationTargetA {
+    using vars_to_interpolate_to_target =
+        tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
+    using compute_items_on_target = tmpl::list<>;
+    using compute_target_points =
+        ::intrp::TargetPoints::LineSegment<InterpolationTargetA, 3>;
+    using interpolating_component =
+        mock_element<KeepInterpolatorMetavariables>;
+  };
+  using temporal_id = ::Tags::TimeStepId;
+  static constexpr size_t volume_dim = 3;
+  using interpolator_source_vars =
+      tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
+  using interpolation_target_tags = tmpl::list<InterpolationTargetA>;
+
+  using component_list = tmpl::list<
+      InterpTargetTestHelpers::mock_interpolation_target<
+          KeepInterpolatorMetavariables, InterpolationTargetA>,
+      InterpTargetTestHelpers::mock_interpolator<KeepInterpolatorMetavariables>,
+      mock_element<KeepInterpolatorMetavariables>>;
+
+  enum class Phase { Initialization, Testing, Exit };
+};
+
+void test_send_points_to_interpolator() noexcept {
+  domain::creators::register_derived_with_charm();
+  using metavars = KeepInterpolatorMetavariables;
+  using target_tag = typename metavars::InterpolationTargetA;
+  static_assert(
+      not intrp::InterpolationTarget_detail::interpolates_on_elements<
+          target_tag>());
+  using target_component =
+      InterpTargetTestHelpers::mock_interpolation_target<metavars, target_tag>;
+  using interp_component = InterpTargetTestHelpers::mock_interpolator<metavars>;
+  using elem_component = mock_element<metavars>;
+  using infos_tag = intrp::Tags::ElementInterpolationInfos<metavars>;
+
+  const size_t number_of_points = 10;
+  const auto domain_creator =
+      domain::creators::Shell(0.9, 4.9, 1, {{5, 5}}, false);
+  tuples::TaggedTuple<intrp::Tags::LineSegment<target_tag, 3>,
+                      domain::Tags::Domain<3>>
+      tuple_of_opts{intrp::OptionHolders::LineSegment<3>{{{1.0, 0.3, 0.25}},
+                                                         {{2.0, 1.5, -0.35}},
+                                                         number_of_points},
+                    domain_creator.create_domain()};
+  ActionTesting::MockRuntimeSystem<metavars> runner{std::move(tuple_of_opts)};
+  ActionTesting::set_phase(make_not_null(&runner),
+                           metavars::Phase::Initialization);
+  ActionTesting::emplace_component<interp_component>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<interp_component>(make_not_null(&runner), 0);
+  }
+  ActionTesting::emplace_component<target_component>(&runner, 0);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<target_component>(make_not_null(&runner), 0);
+  }
+  const ElementId<3> element_id{0};
+  ActionTesting::emplace_component_and_initialize<elem_component>(
+      &runner, element_id, {typename infos_tag::type{}});
+  ActionTesting::set_phase(make_not_null(&runner), metavars::Phase::Testing);
+
+  const Slab slab(0.0, 1.0);
+  const TimeStepId temporal_id(true, 0, Time(slab, 0));
+  ActionTesting::simple_action<
+      target_component, intrp::Actions::SendPointsToInterpolator<target_tag>>(
+      make_not_null(&runner), 0, temporal_id);
+  CHECK(
+      ActionTesting::is_simple_action_queue_empty<target_component>(runner, 0));
+  // The points go to the Interpolator, not to the elements
+  CHECK(ActionTesting::is_simple_action_queue_empty<elem_component>(
+      runner, element_id));
+  ActionTesting::invoke_queued_simple_action<interp_component>(
+      make_not_null(&runner), 0);
+  CHECK(
+      ActionTesting::is_simple_action_queue_empty<interp_component>(runner, 0));
+  const auto& vars_infos =
+      get<intrp::Vars::HolderTag<target_tag, metavars>>(
+          ActionTesting::get_databox_tag<
+              interp_component, intrp::Tags::InterpolatedVarsHolders<metavars>>(
+              runner, 0))
+          .infos;
+  REQUIRE(vars_infos.count(temporal_id) == 1);
+  CHECK(vars_infos.at(temporal_id).block_coord_holders.size() ==
+        number_of_points);
+}
+
+SPECTRE_TEST_CASE(
+    "Unit.NumericalAlgorithms.Interpolator.InterpolateOnElements", "[Unit]") {
+  run_test<MockMetavariables<false>>();
+  run_test<MockMetavariables<true>>();
+  test_send_points_to_elements();
+  test_send_points_to_interpolator();
+}
+}  // namespace
@@ -67,7 +67,7 @@ SPECTRE_TEST_CASE(
 
   // Options for ApparentHorizon
   intrp::OptionHolders::ApparentHorizon<Frame::Inertial> apparent_horizon_opts(
-      Strahlkorper<Frame::Inertial>{l_max, radius, center}, FastFlow{},
+      Strahlkorper<Frame::Inertial>{l_max, radius, center}, FastFlow{}, 1,
       Verbosity::Verbose);
 
   // Test creation of options
@@ -82,6 +82,8 @@ SPECTRE_TEST_CASE(
       "  DivergenceTol: 1.2\n"
       "  DivergenceIter: 5\n"
       "  MaxIts: 100\n"
+      "  InitialLMax: None\n"
+      "ExtrapolationOrder: 1\n"
       "Verbosity: Verbose\n"
       "InitialGuess:\n"
       "  Center: [0.05, 0.06, 0.07]\n"
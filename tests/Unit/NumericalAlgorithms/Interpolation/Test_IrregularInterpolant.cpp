@@ -146,6 +146,49 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) noexcept {
     const intrp::Irregular<Dim> irregular_interpolant_new(mesh, target_x_new);
     CHECK(irregular_interpolant_new != irregular_interpolant);
   }
+  CHECK(irregular_interpolant.number_of_target_points() == number_of_points);
+  CHECK(irregular_interpolant.number_of_source_points() ==
+        mesh.number_of_grid_points());
+  {
+    INFO("Cached interpolants");
+    const size_t cache_key = 1;
+    const auto cached_interpolant =
+        intrp::cached_irregular(cache_key, mesh, target_x);
+    CHECK(*cached_interpolant == irregular_interpolant);
+    // Requesting the same interpolant again doesn't construct a new one
+    CHECK(intrp::cached_irregular(cache_key, mesh, target_x) ==
+          cached_interpolant);
+    // Another key with the same target points gets its own interpolant
+    const size_t other_cache_key = 2;
+    const auto other_cached_interpolant =
+        intrp::cached_irregular(other_cache_key, mesh, target_x);
+    CHECK(other_cached_interpolant != cached_interpolant);
+    CHECK(*other_cached_interpolant == irregular_interpolant);
+    // Moving the target points replaces the interpolant of the key
+    auto target_x_new = target_x;
+    target_x_new.get(0)[0] *= 0.98;
+    const auto cached_interpolant_new =
+        intrp::cached_irregular(cache_key, mesh, target_x_new);
+    CHECK(cached_interpolant_new != cached_interpolant);
+    CHECK(*cached_interpolant_new != irregular_interpolant);
+    CHECK(intrp::cached_irregular(cache_key, mesh, target_x_new) ==
+          cached_interpolant_new);
+    CHECK(*intrp::cached_irregular(cache_key, mesh, target_x) ==
+          irregular_interpolant);
+    CHECK(intrp::cached_irregular(other_cache_key, mesh, target_x) ==
+          other_cached_interpolant);
+  }
+  {
+    INFO("Cache keys");
+    struct TargetA {};
+    struct TargetB {};
+    CHECK(intrp::irregular_cache_key<TargetA>(size_t{1}) ==
+          intrp::irregular_cache_key<TargetA>(size_t{1}));
+    CHECK(intrp::irregular_cache_key<TargetA>(size_t{1}) !=
+          intrp::irregular_cache_key<TargetB>(size_t{1}));
+    CHECK(intrp::irregular_cache_key<TargetA>(size_t{1}) !=
+          intrp::irregular_cache_key<TargetA>(size_t{2}));
+  }
 
   // Coordinates on the grid
   const auto src_x = coordinate_map(logical_coordinates(mesh));
@@ -156,6 +156,22 @@ void test_divergence_impl(
   const auto div_vector =
       divergence(get<Flux1<Dim, Frame>>(fluxes), mesh, inv_jacobian);
   CHECK(get<Tags::div<Flux1<Dim, Frame>>>(div_fluxes) == div_vector);
+
+  // Test divergence on the element with an affine map, for which the inverse
+  // Jacobian is constant
+  CHECK(has_constant_jacobian(inv_jacobian));
+  Variables<db::wrap_tags_in<Tags::div, flux_tags>> affine_div_fluxes{};
+  divergence_with_constant_jacobian(make_not_null(&affine_div_fluxes), fluxes,
+                                    mesh, inv_jacobian);
+  CHECK(affine_div_fluxes.size() == expected_div_fluxes.size());
+  for (size_t n = 0; n < affine_div_fluxes.size(); ++n) {
+    // clang-tidy: pointer arithmetic
+    CHECK(affine_div_fluxes.data()[n] ==                           // NOLINT
+          approx(expected_div_fluxes.data()[n]).epsilon(1.e-11));  // NOLINT
+  }
+  auto perturbed_inv_jacobian = inv_jacobian;
+  get<0, 0>(perturbed_inv_jacobian)[num_grid_points / 2] *= 1. + 1.e-14;
+  CHECK_FALSE(has_constant_jacobian(perturbed_inv_jacobian));
 }
 
 void test_divergence() noexcept {
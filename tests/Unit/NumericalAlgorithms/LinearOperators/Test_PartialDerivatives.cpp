@@ -28,6 +28,7 @@
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Tags.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -450,6 +451,39 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+// Spectral meshes have at most `Spectral::maximum_number_of_points` points per
+// dimension, which the sum-factorized kernels cover, so the derivative
+// functions always take the fused path. Compare it to the BLAS-based
+// implementation that larger extents fall back to.
+template <size_t Dim, typename VariableTags>
+void test_fused_against_blas(const Mesh<Dim>& mesh) {
+  CHECK(partial_derivatives_detail::use_fused_logical_partial_derivatives(
+      mesh));
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  Variables<VariableTags> u(number_of_grid_points);
+  for (size_t i = 0; i < u.size(); ++i) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    u.data()[i] = std::sin(1.3 * static_cast<double>(i));
+  }
+  const auto fused_du = logical_partial_derivatives<VariableTags>(u, mesh);
+
+  auto blas_du =
+      make_array<Dim>(Variables<VariableTags>(number_of_grid_points));
+  std::array<double*, Dim> blas_du_pointers{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(blas_du_pointers, d) = gsl::at(blas_du, d).data();
+  }
+  Variables<VariableTags> temp(number_of_grid_points);
+  partial_derivatives_detail::LogicalImpl<Dim, VariableTags, VariableTags>::
+      apply(make_not_null(&blas_du_pointers), &temp, u, mesh);
+
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  for (size_t d = 0; d < Dim; ++d) {
+    CHECK_VARIABLES_CUSTOM_APPROX(gsl::at(fused_du, d), gsl::at(blas_du, d),
+                                  custom_approx);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs",
@@ -503,6 +537,15 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
                         Spectral::Quadrature::GaussLobatto};
   test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
   test_partial_derivatives_3d<two_vars<3>, one_var<3>>(mesh_3d);
+  // On a mesh this large the components are differentiated in several blocks
+  const Mesh<3> large_mesh_3d{
+      Spectral::maximum_number_of_points<Spectral::Basis::Legendre>,
+      Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto};
+  test_partial_derivatives_3d<two_vars<3>>(large_mesh_3d);
+  test_fused_against_blas<1, two_vars<1>>(mesh_1d);
+  test_fused_against_blas<2, two_vars<2>>(mesh_2d);
+  test_fused_against_blas<3, two_vars<3>>(mesh_3d);
+  test_fused_against_blas<3, two_vars<3>>(large_mesh_3d);
 
   TestHelpers::db::test_prefix_tag<
       Tags::deriv<Var1<3>, tmpl::size_t<3>, Frame::Grid>>("deriv(Var1)");
@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <utility>
 
@@ -14,11 +15,13 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/NumericalAlgorithms/LinearSolver/TestHelpers.hpp"
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -70,6 +73,169 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
       CHECK_ITERABLE_APPROX(solution, expected_solution);
     }
   }
+  {
+    INFO("LU factorization");
+    const DenseMatrix<double> matrix{{4., 1.}, {3., 1.}};
+    const helpers::ApplyMatrix linear_operator{matrix};
+    const DenseVector<double> source{1., 2.};
+    const DenseVector<double> expected_solution{-1., 5.};
+    DenseVector<double> solution(2);
+    const auto solver =
+        TestHelpers::test_creation<ExplicitInverse<>>("LuFactorization: True");
+    CHECK(solver.lu_factorization());
+    const auto has_converged =
+        solver.solve(make_not_null(&solution), linear_operator, source);
+    REQUIRE(has_converged);
+    CHECK_ITERABLE_APPROX(solution, expected_solution);
+    // Solve again with the stored factorization
+    const DenseVector<double> source2{0., 1.};
+    solver.solve(make_not_null(&solution), linear_operator, source2);
+    CHECK_ITERABLE_APPROX(solution, (DenseVector<double>{-1., 4.}));
+    {
+      INFO("Serialization");
+      const auto serialized_solver = serialize_and_deserialize(solver);
+      CHECK(serialized_solver.lu_factorization());
+      CHECK(serialized_solver.size() == 2);
+      CHECK(serialized_solver.matrix_representation() ==
+            solver.matrix_representation());
+      // The deserialized solver shares the factorization again
+      CHECK(&serialized_solver.matrix_representation() ==
+            &solver.matrix_representation());
+      serialized_solver.solve(make_not_null(&solution), linear_operator,
+                              source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+    }
+  }
+  {
+    INFO("Share inverse of identical operators");
+    const DenseMatrix<double> matrix{{2., 1.}, {1., 3.}};
+    const helpers::ApplyMatrix linear_operator{matrix};
+    const DenseMatrix<double> other_matrix{{2., 1.}, {1., 4.}};
+    const helpers::ApplyMatrix other_linear_operator{other_matrix};
+    // Same diagonal, so only the off-diagonal entries tell the operators apart
+    const DenseMatrix<double> same_diagonal_matrix{{2., 0.5}, {1., 3.}};
+    const helpers::ApplyMatrix same_diagonal_linear_operator{
+        same_diagonal_matrix};
+    const DenseVector<double> source{1., 2.};
+    DenseVector<double> solution(2);
+    const ExplicitInverse<> solver{};
+    const ExplicitInverse<> identical_solver{};
+    const ExplicitInverse<> other_solver{};
+    const ExplicitInverse<> same_diagonal_solver{};
+    const ExplicitInverse<> lu_solver{true};
+    solver.solve(make_not_null(&solution), linear_operator, source);
+    identical_solver.solve(make_not_null(&solution), linear_operator, source);
+    other_solver.solve(make_not_null(&solution), other_linear_operator,
+                       source);
+    same_diagonal_solver.solve(make_not_null(&solution),
+                               same_diagonal_linear_operator, source);
+    lu_solver.solve(make_not_null(&solution), linear_operator, source);
+    CHECK(&solver.matrix_representation() ==
+          &identical_solver.matrix_representation());
+    CHECK(&solver.matrix_representation() !=
+          &other_solver.matrix_representation());
+    CHECK(&solver.matrix_representation() !=
+          &same_diagonal_solver.matrix_representation());
+    CHECK(&solver.matrix_representation() !=
+          &lu_solver.matrix_representation());
+    CHECK_MATRIX_APPROX(same_diagonal_solver.matrix_representation(),
+                        blaze::inv(same_diagonal_matrix));
+    CHECK_MATRIX_APPROX(other_solver.matrix_representation(),
+                        blaze::inv(other_matrix));
+    CHECK_ITERABLE_APPROX(solution, (DenseVector<double>{0.2, 0.6}));
+    {
+      INFO("Operators that differ only in a row that isn't sampled");
+      // The fingerprint samples the first, middle and last rows, so only the
+      // product with the probe vector tells these operators apart
+      DenseMatrix<double> large_matrix(5, 5, 0.);
+      for (size_t i = 0; i < 5; ++i) {
+        large_matrix(i, i) = 4.;
+        if (i > 0) {
+          large_matrix(i, i - 1) = 1.;
+        }
+      }
+      DenseMatrix<double> perturbed_large_matrix = large_matrix;
+      perturbed_large_matrix(1, 3) = 1.e-8;
+      const helpers::ApplyMatrix large_operator{large_matrix};
+      const helpers::ApplyMatrix perturbed_large_operator{
+          perturbed_large_matrix};
+      const DenseVector<double> large_source{1., 2., 3., 4., 5.};
+      DenseVector<double> large_solution(5);
+      const ExplicitInverse<> large_solver{};
+      const ExplicitInverse<> perturbed_large_solver{};
+      large_solver.solve(make_not_null(&large_solution), large_operator,
+                         large_source);
+      perturbed_large_solver.solve(make_not_null(&large_solution),
+                                   perturbed_large_operator, large_source);
+      CHECK(&large_solver.matrix_representation() !=
+            &perturbed_large_solver.matrix_representation());
+      CHECK_MATRIX_APPROX(perturbed_large_solver.matrix_representation(),
+                          blaze::inv(perturbed_large_matrix));
+    }
+    {
+      INFO("Resetting a solver that shares its inverse");
+      ExplicitInverse<> resetting_solver{};
+      resetting_solver.solve(make_not_null(&solution), linear_operator,
+                             source);
+      CHECK(&resetting_solver.matrix_representation() ==
+            &solver.matrix_representation());
+      resetting_solver.reset();
+      resetting_solver.solve(make_not_null(&solution), other_linear_operator,
+                             source);
+      CHECK(&resetting_solver.matrix_representation() ==
+            &other_solver.matrix_representation());
+      CHECK_MATRIX_APPROX(solver.matrix_representation(), blaze::inv(matrix));
+    }
+  }
+  {
+    INFO("Share inverse across elements");
+    // The elements of a row of blocks with corners at multiples of 0.1 have
+    // the same size, but their Jacobians differ by roundoff
+    const size_t num_elements = 10;
+    const auto element_operator = [](const size_t element_index) noexcept {
+      const double jacobian = ((static_cast<double>(element_index) + 1.) * 0.1 -
+                               static_cast<double>(element_index) * 0.1) /
+                              2.;
+      // Identity plus a finite-difference Laplacian in the element
+      DenseMatrix<double> matrix(4, 4, 0.);
+      for (size_t i = 0; i < 4; ++i) {
+        matrix(i, i) = 1. + 2. / square(jacobian);
+        if (i > 0) {
+          matrix(i, i - 1) = -1. / square(jacobian);
+        }
+        if (i < 3) {
+          matrix(i, i + 1) = -1. / square(jacobian);
+        }
+      }
+      return helpers::ApplyMatrix{std::move(matrix)};
+    };
+    bool operators_differ_by_roundoff = false;
+    const DenseVector<double> source{1., 2., 3., 4.};
+    DenseVector<double> solution(4);
+    const auto first_operator = element_operator(0);
+    const ExplicitInverse<> first_solver{};
+    first_solver.solve(make_not_null(&solution), first_operator, source);
+    const DenseVector<double> expected_solution = solution;
+    for (size_t element_index = 1; element_index < num_elements;
+         ++element_index) {
+      CAPTURE(element_index);
+      const auto linear_operator = element_operator(element_index);
+      // Compare bitwise, since blaze compares matrices up to roundoff
+      for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+          if (linear_operator.matrix(i, j) != first_operator.matrix(i, j)) {
+            operators_differ_by_roundoff = true;
+          }
+        }
+      }
+      const ExplicitInverse<> solver{};
+      solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK(&solver.matrix_representation() ==
+            &first_solver.matrix_representation());
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+    }
+    CHECK(operators_differ_by_roundoff);
+  }
   {
     INFO("Solve a heterogeneous data structure");
     using SubdomainData = ::LinearSolver::Schwarz::ElementCenteredSubdomainData<
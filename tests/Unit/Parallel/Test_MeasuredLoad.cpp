@@ -0,0 +1,136 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/MeasuredLoad.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Contribution : db::SimpleTag {
+  using type = Parallel::detail::measured_load_reduction_data;
+};
+
+struct ContributeMeasuredLoad {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const double element_load,
+                    const size_t report_number,
+                    const bool after_load_balancing) noexcept {
+    const int proc = Parallel::my_proc(
+        *Parallel::get_parallel_component<ParallelComponent>(cache)[array_index]
+             .ckLocal());
+    db::mutate<Contribution>(
+        make_not_null(&box),
+        [&after_load_balancing, &element_load, &proc, &report_number](
+            const gsl::not_null<Parallel::detail::measured_load_reduction_data*>
+                contribution) noexcept {
+          *contribution =
+              Parallel::detail::measured_load_contribution<ParallelComponent>(
+                  element_load, report_number, proc, after_load_balancing);
+        });
+  }
+};
+
+template <typename Metavariables>
+struct Component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      typename Metavariables::Phase, Metavariables::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<
+          db::AddSimpleTags<Contribution>>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<Component<Metavariables>>;
+  enum class Phase { Initialization, Exit };
+};
+
+using component = Component<Metavariables>;
+
+// Contributes the load of each element in the given order and combines the
+// contributions, as Charm++ does in the reduction
+Parallel::detail::measured_load_reduction_data reduce_measured_load(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const std::vector<std::pair<size_t, double>>& element_loads,
+    const size_t report_number, const bool after_load_balancing) noexcept {
+  Parallel::detail::measured_load_reduction_data result{};
+  bool first_contribution = true;
+  for (const auto& [element, load] : element_loads) {
+    ActionTesting::simple_action<component, ContributeMeasuredLoad>(
+        runner, element, load, report_number, after_load_balancing);
+    auto contribution =
+        ActionTesting::get_databox_tag<component, Contribution>(*runner,
+                                                                element);
+    if (first_contribution) {
+      result = std::move(contribution);
+      first_contribution = false;
+    } else {
+      result.combine(std::move(contribution));
+    }
+  }
+  return result;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.MeasuredLoad", "[Unit][Parallel]") {
+  // Two nodes with two cores each. Processor 0 holds elements 0 and 1,
+  // processor 1 element 2, processor 2 element 3 and processor 3 no element.
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}, {}, {2, 2}};
+  const auto emplace = [&runner](const size_t node, const size_t core,
+                                 const size_t element) noexcept {
+    ActionTesting::emplace_array_component_and_initialize<component>(
+        &runner, ActionTesting::NodeId{node}, ActionTesting::LocalCoreId{core},
+        element, {Parallel::detail::measured_load_reduction_data{}});
+  };
+  emplace(0, 0, 0);
+  emplace(0, 0, 1);
+  emplace(0, 1, 2);
+  emplace(1, 0, 3);
+
+  {
+    INFO("Loads on the same processor are summed");
+    // Element 1 contributes last, so its processor's total is only complete
+    // at the end of the reduction
+    const auto reduced = reduce_measured_load(
+        make_not_null(&runner), {{0, 1.0}, {2, 0.5}, {3, 2.5}, {1, 2.0}}, 1,
+        false);
+    const auto& [name, after_load_balancing, total_load, max_load] =
+        reduced.data();
+    CHECK(name == pretty_type::short_name<component>());
+    CHECK_FALSE(after_load_balancing);
+    CHECK(total_load == 6.0);
+    CHECK(max_load == 3.0);
+  }
+  {
+    INFO("The processor loads are reset between reductions");
+    const auto reduced = reduce_measured_load(
+        make_not_null(&runner), {{3, 1.0}, {1, 1.0}, {0, 1.0}, {2, 1.0}}, 2,
+        true);
+    const auto& [name, after_load_balancing, total_load, max_load] =
+        reduced.data();
+    CHECK(name == pretty_type::short_name<component>());
+    CHECK(after_load_balancing);
+    CHECK(total_load == 4.0);
+    CHECK(max_load == 2.0);
+  }
+}
@@ -155,6 +155,7 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
     INFO("InitializeElement");
     CHECK(get_tag(Convergence::Tags::IterationId<TestSolver>{}) ==
           std::numeric_limits<size_t>::max());
+    CHECK(get_tag(LinearSolver::Tags::ObservationIdOffset<TestSolver>{}) == 0);
     tmpl::for_each<tmpl::list<operator_applied_to_fields_tag, residual_tag,
                               Convergence::Tags::HasConverged<TestSolver>>>(
         [&tag_is_retrievable](auto tag_v) {
@@ -172,6 +173,7 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
                                               element_id);
     CHECK(get_tag(Convergence::Tags::IterationId<TestSolver>{}) == 0);
     CHECK_FALSE(get_tag(Convergence::Tags::HasConverged<TestSolver>{}));
+    CHECK(get_tag(LinearSolver::Tags::ObservationIdOffset<TestSolver>{}) == 0);
     ActionTesting::invoke_queued_simple_action<obs_component>(
         make_not_null(&runner), 0);
     ActionTesting::invoke_queued_threaded_action<obs_writer>(
@@ -186,6 +188,8 @@ SPECTRE_TEST_CASE("Unit.ParallelLinearSolver.Asynchronous.ElementActions",
                                               element_id);
     CHECK(get_tag(Convergence::Tags::IterationId<TestSolver>{}) == 1);
     CHECK(get_tag(Convergence::Tags::HasConverged<TestSolver>{}));
+    // The next solve observes its residuals after the two of this solve
+    CHECK(get_tag(LinearSolver::Tags::ObservationIdOffset<TestSolver>{}) == 2);
     ActionTesting::invoke_queued_simple_action<obs_component>(
         make_not_null(&runner), 0);
     ActionTesting::invoke_queued_threaded_action<obs_writer>(
@@ -51,6 +51,7 @@ using residual_square_tag = LinearSolver::Tags::MagnitudeSquare<
     LinearSolver::Tags::Residual<fields_tag>>;
 using initial_residual_magnitude_tag = ::Tags::Initial<
     LinearSolver::Tags::Magnitude<LinearSolver::Tags::Residual<fields_tag>>>;
+using step_length_tag = LinearSolver::Tags::StepLength<fields_tag>;
 
 template <typename Metavariables>
 struct MockResidualMonitor {
@@ -85,6 +86,8 @@ struct MockElementArray {
       LinearSolver::cg::detail::Tags::InitialHasConverged<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::Alpha<TestLinearSolver>,
       LinearSolver::cg::detail::Tags::ResidualRatioAndHasConverged<
+          TestLinearSolver>,
+      LinearSolver::cg::detail::Tags::AlphaResidualRatioAndHasConverged<
           TestLinearSolver>>;
 };
 
@@ -312,4 +315,83 @@ SPECTRE_TEST_CASE(
     REQUIRE(has_converged);
     CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
   }
+
+  SECTION("UpdatePipelinedResidual") {
+    using update_pipelined_residual =
+        LinearSolver::cg::detail::UpdatePipelinedResidual<
+            fields_tag, TestLinearSolver, element_array>;
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 16.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Starting the pipeline only computes the first step length
+    ActionTesting::simple_action<residual_monitor, update_pipelined_residual>(
+        make_not_null(&runner), 0, 0_st, 16., 8.);
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 16.);
+    CHECK(get_residual_monitor_tag(step_length_tag{}) == 2.);
+    {
+      const auto& element_inbox =
+          get_element_inbox_tag(
+              LinearSolver::cg::detail::Tags::
+                  AlphaResidualRatioAndHasConverged<TestLinearSolver>{})
+              .at(0);
+      CHECK(get<0>(element_inbox) == 2.);
+      CHECK(get<1>(element_inbox) == 0.);
+      CHECK_FALSE(get<2>(element_inbox));
+    }
+    // The first iteration completes with the next reduction
+    ActionTesting::simple_action<residual_monitor, update_pipelined_residual>(
+        make_not_null(&runner), 0, 1_st, 9., 5.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 9.);
+    CHECK(get_residual_monitor_tag(initial_residual_magnitude_tag{}) == 4.);
+    CHECK(get_residual_monitor_tag(step_length_tag{}) == approx(288. / 79.));
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::cg::detail::Tags::AlphaResidualRatioAndHasConverged<
+                TestLinearSolver>{})
+            .at(1);
+    CHECK(get<0>(element_inbox) == approx(288. / 79.));
+    CHECK(get<1>(element_inbox) == approx(9. / 16.));
+    CHECK_FALSE(get<2>(element_inbox));
+    // Test observer writer state
+    CHECK(
+        get_observer_writer_tag(helpers::CheckObservationIdTag{}) ==
+        observers::ObservationId{1, "(anonymous namespace)::TestLinearSolver"});
+    CHECK(get<0>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          1);
+    CHECK(get<1>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(3.));
+  }
+
+  SECTION("UpdatePipelinedResidualAndConverge") {
+    using update_pipelined_residual =
+        LinearSolver::cg::detail::UpdatePipelinedResidual<
+            fields_tag, TestLinearSolver, element_array>;
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::cg::detail::InitializeResidual<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 16.);
+    ActionTesting::simple_action<residual_monitor, update_pipelined_residual>(
+        make_not_null(&runner), 0, 0_st, 16., 8.);
+    ActionTesting::simple_action<residual_monitor, update_pipelined_residual>(
+        make_not_null(&runner), 0, 1_st, 4., 2.);
+    // Test residual monitor state
+    CHECK(get_residual_monitor_tag(residual_square_tag{}) == 4.);
+    // Test element state
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::cg::detail::Tags::AlphaResidualRatioAndHasConverged<
+                TestLinearSolver>{})
+            .at(1);
+    CHECK(get<1>(element_inbox) == 0.25);
+    const auto& has_converged = get<2>(element_inbox);
+    REQUIRE(has_converged);
+    CHECK(has_converged.reason() == Convergence::Reason::RelativeResidual);
+  }
 }
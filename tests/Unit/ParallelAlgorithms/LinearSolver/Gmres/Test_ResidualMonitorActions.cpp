@@ -86,6 +86,7 @@ struct MockElementArray {
       LinearSolver::gmres::detail::Tags::InitialOrthogonalization<
           TestLinearSolver>,
       LinearSolver::gmres::detail::Tags::Orthogonalization<TestLinearSolver>,
+      LinearSolver::gmres::detail::Tags::Orthogonalizations<TestLinearSolver>,
       LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
           TestLinearSolver>>;
 };
@@ -273,6 +274,65 @@ SPECTRE_TEST_CASE(
           approx(residual_magnitude));
   }
 
+  SECTION("StoreOrthogonalizations") {
+    ActionTesting::simple_action<
+        residual_monitor,
+        LinearSolver::gmres::detail::InitializeResidualMagnitude<
+            fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 2.);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalizations<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 0_st, std::vector<double>{1.}, 0.);
+    // Test intermediate state
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{})(0, 0) ==
+          1.);
+    CHECK(get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::Orthogonalizations<
+                  TestLinearSolver>{})
+              .at(0) == std::vector<double>{1.});
+    CHECK(get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                  TestLinearSolver>{})
+              .empty());
+    // The second pass adds a correction and completes the iteration
+    ActionTesting::simple_action<
+        residual_monitor, LinearSolver::gmres::detail::StoreOrthogonalizations<
+                              fields_tag, TestLinearSolver, element_array>>(
+        make_not_null(&runner), 0, 0_st, 1_st, std::vector<double>{0.5}, 4.25);
+    ActionTesting::invoke_queued_threaded_action<observer_writer>(
+        make_not_null(&runner), 0);
+    // Test residual monitor state
+    // H = [[1. + 0.5], [sqrt(4.25 - 0.5^2)]]
+    CHECK(get_residual_monitor_tag(orthogonalization_history_tag{}) ==
+          DenseMatrix<double>({{1.5}, {2.}}));
+    // Test element state
+    CHECK(get_element_inbox_tag(
+              LinearSolver::gmres::detail::Tags::Orthogonalizations<
+                  TestLinearSolver>{})
+              .at(0) == std::vector<double>{0.5});
+    const auto& element_inbox =
+        get_element_inbox_tag(
+            LinearSolver::gmres::detail::Tags::FinalOrthogonalization<
+                TestLinearSolver>{})
+            .at(0);
+    CHECK(get<0>(element_inbox) == approx(2.));
+    // beta = [2., 0.]
+    // minres = inv(qr_R(H)) * trans(qr_Q(H)) * beta = [0.48]
+    const auto& minres = get<1>(element_inbox);
+    CHECK(minres.size() == 1);
+    CHECK_ITERABLE_APPROX(minres, DenseVector<double>({0.48}));
+    CHECK_FALSE(get<2>(element_inbox));
+    // r = beta - H * minres = [1.28, -0.96]
+    // |r| = 1.6
+    CHECK(get<0>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          1);
+    CHECK(get<1>(get_observer_writer_tag(helpers::CheckReductionDataTag{})) ==
+          approx(1.6));
+  }
+
   SECTION("ConvergeByAbsoluteResidual") {
     ActionTesting::simple_action<
         residual_monitor,
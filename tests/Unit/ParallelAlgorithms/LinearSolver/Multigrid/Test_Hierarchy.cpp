@@ -6,10 +6,13 @@
 #include <array>
 #include <cstddef>
 #include <ostream>
+#include <set>
 #include <unordered_set>
 #include <vector>
 
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "ParallelAlgorithms/LinearSolver/Multigrid/Hierarchy.hpp"
 #include "Utilities/StdHelpers.hpp"
 
@@ -99,6 +102,31 @@ SPECTRE_TEST_CASE("Unit.ParallelMultigrid.Hierarchy",
             {block_id, {{{1, 0}, {2, 3}, {3, 1}}}, 1},
             {block_id, {{{1, 1}, {2, 3}, {3, 1}}}, 1}});
   }
+  {
+    INFO("Child size");
+    using Spectral::ChildSize;
+    CHECK(child_size<1>({{{1, 0}}}, {{{0, 0}}}) ==
+          std::array<ChildSize, 1>{{ChildSize::LowerHalf}});
+    CHECK(child_size<1>({{{1, 1}}}, {{{0, 0}}}) ==
+          std::array<ChildSize, 1>{{ChildSize::UpperHalf}});
+    CHECK(child_size<1>({{{2, 1}}}, {{{2, 1}}}) ==
+          std::array<ChildSize, 1>{{ChildSize::Full}});
+    CHECK(child_size<2>({{{2, 3}, {1, 0}}}, {{{1, 1}, {1, 0}}}) ==
+          std::array<ChildSize, 2>{{ChildSize::UpperHalf, ChildSize::Full}});
+    CHECK(child_size<3>({{{1, 0}, {0, 0}, {3, 5}}},
+                        {{{0, 0}, {0, 0}, {2, 2}}}) ==
+          std::array<ChildSize, 3>{
+              {ChildSize::LowerHalf, ChildSize::Full, ChildSize::UpperHalf}});
+    // The children of a parent cover it entirely
+    const ElementId<2> parent{0, {{{1, 0}, {0, 0}}}, 1};
+    std::set<std::array<ChildSize, 2>> child_sizes{};
+    for (const auto& child_id : child_ids<2>(parent, {{2, 1}})) {
+      CHECK(parent_id(child_id) == parent);
+      child_sizes.insert(
+          child_size(child_id.segment_ids(), parent.segment_ids()));
+    }
+    CHECK(child_sizes.size() == 4);
+  }
 }
 
 }  // namespace LinearSolver::multigrid
@@ -0,0 +1,197 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#define CATCH_CONFIG_RUNNER
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/Creators/Interval.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Elliptic/DiscontinuousGalerkin/DgElementArray.hpp"
+#include "Helpers/Domain/BoundaryConditions/BoundaryCondition.hpp"
+#include "Helpers/ParallelAlgorithms/LinearSolver/DistributedLinearSolverAlgorithmTestHelpers.hpp"
+#include "Helpers/ParallelAlgorithms/LinearSolver/LinearSolverAlgorithmTestHelpers.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "NumericalAlgorithms/Convergence/Tags.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/Actions/SetupDataBox.hpp"
+#include "Parallel/Actions/TerminatePhase.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/Main.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Initialization/Actions/RemoveOptionsAndTerminatePhase.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Multigrid.hpp"
+#include "ParallelAlgorithms/LinearSolver/Richardson/Richardson.hpp"
+#include "ParallelAlgorithms/LinearSolver/Tags.hpp"
+#include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace PUP {
+class er;
+}  // namespace PUP
+
+namespace helpers = LinearSolverAlgorithmTestHelpers;
+namespace helpers_distributed = DistributedLinearSolverAlgorithmTestHelpers;
+
+namespace {
+
+struct MultigridSolver {
+  static constexpr Options::String help =
+      "Options for the multigrid linear solver";
+};
+
+struct RichardsonSmoother {
+  static constexpr Options::String help =
+      "Options for the Richardson smoother on every multigrid level";
+};
+
+// Applies the operator A = 2 * identity to the operand. The operator of the
+// distributed test helpers is a global matrix that couples the elements of the
+// finest grid, so it cannot be applied on the coarser grids of the multigrid
+// hierarchy. This operator is local to each element, so it applies on every
+// grid. With the smoother's relaxation parameter set to 0.25 every smoothing
+// iteration halves the error.
+template <typename OperandTag>
+struct ComputeOperatorAction {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<1>& /*element_id*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    using ScalarFieldOperandTag = tmpl::front<typename OperandTag::tags_list>;
+    db::mutate<LinearSolver::Tags::OperatorAppliedTo<OperandTag>>(
+        make_not_null(&box),
+        [](const auto operator_applied_to_operand,
+           const auto& operand) noexcept {
+          operator_applied_to_operand->initialize(
+              operand.number_of_grid_points());
+          get(get<LinearSolver::Tags::OperatorAppliedTo<ScalarFieldOperandTag>>(
+              *operator_applied_to_operand)) =
+              2. * get(get<ScalarFieldOperandTag>(operand));
+        },
+        get<OperandTag>(box));
+    return {std::move(box)};
+  }
+};
+
+// Checks the solution on the finest grid. The coarser grids hold the last
+// correction of the V-cycle, so they only check for convergence.
+struct TestResult {
+  using test_finest_grid = helpers_distributed::TestResult<MultigridSolver>;
+  using const_global_cache_tags = test_finest_grid::const_global_cache_tags;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTagsList>&&, bool> apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<1>& element_id, const ActionList meta,
+      const ParallelComponent* const component) noexcept {
+    if (element_id.grid_index() == 0) {
+      return test_finest_grid::apply(box, inboxes, cache, element_id, meta,
+                                     component);
+    }
+    SPECTRE_PARALLEL_REQUIRE(
+        get<Convergence::Tags::HasConverged<MultigridSolver>>(box));
+    return {std::move(box), true};
+  }
+};
+
+struct Metavariables {
+  static constexpr const char* const help{
+      "Test the multigrid linear solver algorithm"};
+  static constexpr size_t volume_dim = 1;
+  using system =
+      TestHelpers::domain::BoundaryConditions::SystemWithoutBoundaryConditions<
+          volume_dim>;
+
+  using linear_solver =
+      LinearSolver::multigrid::Multigrid<volume_dim,
+                                         helpers_distributed::fields_tag,
+                                         MultigridSolver, false>;
+  using smoother =
+      LinearSolver::Richardson::Richardson<helpers_distributed::fields_tag,
+                                           RichardsonSmoother>;
+  using preconditioner = void;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<DomainCreator<1>, tmpl::list<domain::creators::Interval>>>;
+  };
+
+  using Phase = helpers::Phase;
+
+  // The source that `helpers_distributed::InitializeElement` assigns to the
+  // elements on the coarser grids is never used, because they receive their
+  // source from the finer grid in every V-cycle
+  using element_array = elliptic::DgElementArray<
+      Metavariables,
+      tmpl::list<
+          Parallel::PhaseActions<
+              Phase, Phase::Initialization,
+              tmpl::list<Actions::SetupDataBox,
+                         helpers_distributed::InitializeElement,
+                         typename linear_solver::initialize_element,
+                         typename smoother::initialize_element,
+                         ComputeOperatorAction<helpers_distributed::fields_tag>,
+                         Initialization::Actions::
+                             RemoveOptionsAndTerminatePhase>>,
+          Parallel::PhaseActions<
+              Phase, Phase::RegisterWithObserver,
+              tmpl::list<typename linear_solver::register_element,
+                         typename smoother::register_element,
+                         Parallel::Actions::TerminatePhase>>,
+          Parallel::PhaseActions<
+              Phase, Phase::PerformLinearSolve,
+              tmpl::list<typename linear_solver::template solve<
+                             ComputeOperatorAction<
+                                 typename linear_solver::operand_tag>,
+                             smoother>,
+                         Parallel::Actions::TerminatePhase>>,
+          Parallel::PhaseActions<Phase, Phase::TestResult,
+                                 tmpl::list<TestResult>>>,
+      typename linear_solver::elements_allocator>;
+
+  using component_list =
+      tmpl::list<element_array, observers::Observer<Metavariables>,
+                 observers::ObserverWriter<Metavariables>,
+                 helpers::OutputCleaner<Metavariables>>;
+  using observed_reduction_data_tags =
+      observers::collect_reduction_data_tags<tmpl::list<linear_solver,
+                                                        smoother>>;
+  static constexpr bool ignore_unrecognized_command_line_options = false;
+  static constexpr auto determine_next_phase =
+      helpers::determine_next_phase<Metavariables>;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) noexcept {}
+};
+
+}  // namespace
+
+static const std::vector<void (*)()> charm_init_node_funcs{
+    &setup_error_handling, &setup_memory_allocation_failure_reporting,
+    &domain::creators::register_derived_with_charm,
+    &TestHelpers::domain::BoundaryConditions::register_derived_with_charm};
+static const std::vector<void (*)()> charm_init_proc_funcs{
+    &enable_floating_point_exceptions};
+
+using charmxx_main_component = Parallel::Main<Metavariables>;
+
+#include "Parallel/CharmMain.tpp"  // IWYU pragma: keep
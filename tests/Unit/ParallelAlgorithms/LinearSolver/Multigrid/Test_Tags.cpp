@@ -0,0 +1,30 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "ParallelAlgorithms/LinearSolver/Multigrid/Tags.hpp"
+
+namespace {
+struct TestSolver {};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelMultigrid.Tags",
+                  "[Unit][ParallelAlgorithms][LinearSolver]") {
+  TestHelpers::db::test_simple_tag<
+      LinearSolver::multigrid::Tags::MaxLevels<TestSolver>>(
+      "MaxLevels(TestSolver)");
+  TestHelpers::db::test_simple_tag<
+      LinearSolver::multigrid::Tags::ChildrenRefinementLevels<1>>(
+      "ChildrenRefinementLevels");
+  TestHelpers::db::test_simple_tag<
+      LinearSolver::multigrid::Tags::ParentRefinementLevels<1>>(
+      "ParentRefinementLevels");
+  TestHelpers::db::test_simple_tag<LinearSolver::multigrid::Tags::ParentId<1>>(
+      "ParentId");
+  TestHelpers::db::test_simple_tag<LinearSolver::multigrid::Tags::ChildIds<1>>(
+      "ChildIds");
+}
@@ -33,6 +33,10 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.LinearSolver.Tags",
       "LinearMagnitudeSquare(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Magnitude<Tag>>(
       "LinearMagnitude(Tag)");
+  TestHelpers::db::test_prefix_tag<LinearSolver::Tags::SearchDirection<Tag>>(
+      "LinearSearchDirection(Tag)");
+  TestHelpers::db::test_prefix_tag<LinearSolver::Tags::StepLength<Tag>>(
+      "LinearStepLength(Tag)");
   TestHelpers::db::test_prefix_tag<LinearSolver::Tags::Orthogonalization<Tag>>(
       "LinearOrthogonalization(Tag)");
   TestHelpers::db::test_prefix_tag<
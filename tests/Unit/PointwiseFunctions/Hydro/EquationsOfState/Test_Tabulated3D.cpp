@@ -0,0 +1,247 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Informer/InfoFromBuild.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3D.hpp"
+
+namespace {
+// The log of the pressure and of the shifted specific internal energy are
+// linear in log10(rho), log10(T) and Y_e, so the trilinear interpolation is
+// exact and the inversions in the temperature can be done analytically.
+double log_pressure(const double log_density, const double log_temperature,
+                    const double electron_fraction) noexcept {
+  return -6.0 + 1.5 * log_density + 0.8 * log_temperature +
+         0.2 * electron_fraction;
+}
+
+double log_shifted_energy(const double log_density,
+                          const double log_temperature,
+                          const double electron_fraction) noexcept {
+  return -2.0 + 0.05 * log_density + 0.9 * log_temperature -
+         0.1 * electron_fraction;
+}
+
+constexpr double energy_shift = 0.01;
+
+// With `energy_is_flat_in_temperature` the energy doesn't depend on the
+// temperature, as in some cells of the stellarcollapse.org tables
+std::shared_ptr<const EquationsOfState::Tabulated3DTable> make_table(
+    const bool energy_is_flat_in_temperature = false) noexcept {
+  EquationsOfState::Tabulated3DTable table{};
+  for (size_t i = 0; i < 5; ++i) {
+    table.log_rest_mass_density.push_back(-4.0 + 0.5 * static_cast<double>(i));
+  }
+  for (size_t i = 0; i < 6; ++i) {
+    table.log_temperature.push_back(-1.0 + 0.4 * static_cast<double>(i));
+  }
+  table.electron_fraction = {0.05, 0.25, 0.45};
+  for (const double electron_fraction : table.electron_fraction) {
+    for (const double log_temperature : table.log_temperature) {
+      for (const double log_density : table.log_rest_mass_density) {
+        table.log_pressure.push_back(
+            log_pressure(log_density, log_temperature, electron_fraction));
+        table.log_shifted_specific_internal_energy.push_back(
+            log_shifted_energy(log_density,
+                               energy_is_flat_in_temperature ? 0.0
+                                                             : log_temperature,
+                               electron_fraction));
+      }
+    }
+  }
+  table.energy_shift = energy_shift;
+  return std::make_shared<const EquationsOfState::Tabulated3DTable>(
+      std::move(table));
+}
+
+void test_interpolation(
+    const EquationsOfState::Tabulated3D<true>& eos) noexcept {
+  Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.0);
+  const double electron_fraction = 0.3;
+  // Points in different cells, in an order that makes the cached temperature
+  // cell both hit and miss
+  const DataVector log_density{-3.8, -3.7, -2.3, -2.1, -3.0, -2.9};
+  const DataVector log_temperature{-0.9, -0.85, 0.3, 0.35, 0.9, -0.5};
+  DataVector expected_log_pressure{log_density.size()};
+  DataVector expected_log_shifted_energy{log_density.size()};
+  for (size_t s = 0; s < log_density.size(); ++s) {
+    expected_log_pressure[s] =
+        log_pressure(log_density[s], log_temperature[s], electron_fraction);
+    expected_log_shifted_energy[s] = log_shifted_energy(
+        log_density[s], log_temperature[s], electron_fraction);
+  }
+  const Scalar<DataVector> rest_mass_density{exp10(log_density)};
+  const Scalar<DataVector> pressure{exp10(expected_log_pressure)};
+  const Scalar<DataVector> specific_internal_energy{
+      exp10(expected_log_shifted_energy) - energy_shift};
+  const Scalar<DataVector> specific_enthalpy{
+      1.0 + get(specific_internal_energy) +
+      get(pressure) / get(rest_mass_density)};
+
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.pressure_from_density_and_energy(rest_mass_density,
+                                           specific_internal_energy),
+      pressure, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.pressure_from_density_and_enthalpy(rest_mass_density,
+                                             specific_enthalpy),
+      pressure, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.specific_enthalpy_from_density_and_energy(rest_mass_density,
+                                                    specific_internal_energy),
+      specific_enthalpy, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.specific_internal_energy_from_density_and_pressure(rest_mass_density,
+                                                             pressure),
+      specific_internal_energy, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.chi_from_density_and_energy(rest_mass_density,
+                                      specific_internal_energy),
+      Scalar<DataVector>(get(pressure) / get(rest_mass_density) *
+                         (1.5 - 0.8 * 0.05 / 0.9)),
+      custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.kappa_times_p_over_rho_squared_from_density_and_energy(
+          rest_mass_density, specific_internal_energy),
+      Scalar<DataVector>(square(get(pressure)) * 0.8 / 0.9 /
+                         ((get(specific_internal_energy) + energy_shift) *
+                          square(get(rest_mass_density)))),
+      custom_approx);
+
+  // The double overloads
+  for (size_t s = 0; s < log_density.size(); ++s) {
+    CHECK(get(eos.pressure_from_density_and_energy(
+              Scalar<double>{get(rest_mass_density)[s]},
+              Scalar<double>{get(specific_internal_energy)[s]})) ==
+          custom_approx(get(pressure)[s]));
+    CHECK(get(eos.pressure_from_density_and_enthalpy(
+              Scalar<double>{get(rest_mass_density)[s]},
+              Scalar<double>{get(specific_enthalpy)[s]})) ==
+          custom_approx(get(pressure)[s]));
+    CHECK(get(eos.specific_internal_energy_from_density_and_pressure(
+              Scalar<double>{get(rest_mass_density)[s]},
+              Scalar<double>{get(pressure)[s]})) ==
+          custom_approx(get(specific_internal_energy)[s]));
+  }
+
+  // Values outside of the table are evaluated at the table boundary
+  CHECK(get(eos.pressure_from_density_and_energy(
+            Scalar<double>{1.0e-5},
+            Scalar<double>{pow(10.0, log_shifted_energy(-4.0, 0.2,
+                                                        electron_fraction)) -
+                           energy_shift})) ==
+        custom_approx(pow(10.0, log_pressure(-4.0, 0.2, electron_fraction))));
+}
+
+void test_bounds(const EquationsOfState::Tabulated3D<true>& eos) noexcept {
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  const double electron_fraction = 0.3;
+  CHECK(eos.rest_mass_density_lower_bound() == custom_approx(1.0e-4));
+  CHECK(eos.rest_mass_density_upper_bound() == custom_approx(1.0e-2));
+  CHECK(eos.specific_internal_energy_lower_bound(pow(10.0, -3.2)) ==
+        custom_approx(
+            pow(10.0, log_shifted_energy(-3.2, -1.0, electron_fraction)) -
+            energy_shift));
+  CHECK(eos.specific_internal_energy_upper_bound(pow(10.0, -3.2)) ==
+        custom_approx(
+            pow(10.0, log_shifted_energy(-3.2, 1.0, electron_fraction)) -
+            energy_shift));
+  double specific_enthalpy_lower_bound = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < 5; ++i) {
+    const double log_density = -4.0 + 0.5 * static_cast<double>(i);
+    specific_enthalpy_lower_bound = std::min(
+        specific_enthalpy_lower_bound,
+        1.0 +
+            pow(10.0,
+                log_shifted_energy(log_density, -1.0, electron_fraction)) -
+            energy_shift +
+            pow(10.0, log_pressure(log_density, -1.0, electron_fraction) -
+                          log_density));
+  }
+  CHECK(eos.specific_enthalpy_lower_bound() ==
+        custom_approx(specific_enthalpy_lower_bound));
+}
+
+void test_energy_flat_in_temperature() noexcept {
+  // The energy doesn't determine the temperature, so the derivatives of the
+  // pressure at constant density drop their temperature terms. They would be
+  // 0/0 otherwise, which traps with floating-point exceptions enabled.
+  Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.0);
+  const EquationsOfState::Tabulated3D<true> eos{make_table(true), 0.3};
+  const DataVector log_density{-3.8, -2.3, -2.9};
+  DataVector log_energy{log_density.size()};
+  for (size_t s = 0; s < log_density.size(); ++s) {
+    log_energy[s] = log_shifted_energy(log_density[s], 0.0, 0.3);
+  }
+  const Scalar<DataVector> rest_mass_density{exp10(log_density)};
+  const Scalar<DataVector> specific_internal_energy{exp10(log_energy) -
+                                                    energy_shift};
+  const auto pressure = eos.pressure_from_density_and_energy(
+      rest_mass_density, specific_internal_energy);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      eos.chi_from_density_and_energy(rest_mass_density,
+                                      specific_internal_energy),
+      Scalar<DataVector>(get(pressure) / get(rest_mass_density) * 1.5),
+      custom_approx);
+  CHECK(eos.kappa_times_p_over_rho_squared_from_density_and_energy(
+            rest_mass_density, specific_internal_energy) ==
+        Scalar<DataVector>(log_density.size(), 0.0));
+}
+
+void test_stellar_collapse_file() noexcept {
+  const std::string file_name =
+      unit_test_src_path() + "/IO/StellarCollapse2017Sample.h5";
+  const auto check = [](const auto& eos) noexcept {
+    Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+    // The density grid of the sample table is converted from g/cm^3
+    CHECK(eos.rest_mass_density_lower_bound() ==
+          custom_approx(pow(10.0, 3.0239960056064277) * 1.619215954548962e-18));
+    CHECK(eos.rest_mass_density_upper_bound() ==
+          custom_approx(pow(10.0, 3.0573293389397609) * 1.619215954548962e-18));
+  };
+  const EquationsOfState::Tabulated3D<true> eos{file_name, "/", 0.01};
+  check(eos);
+  check(serialize_and_deserialize(eos));
+  check(*TestHelpers::test_creation<
+        std::unique_ptr<EquationsOfState::EquationOfState<true, 2>>>(
+      "Tabulated3D:\n"
+      "  TableFilename: " +
+      file_name +
+      "\n"
+      "  TableSubgroup: /\n"
+      "  ElectronFraction: 0.01\n"));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
+                  "[Unit][EquationsOfState]") {
+  Parallel::register_derived_classes_with_charm<
+      EquationsOfState::EquationOfState<true, 2>>();
+  const EquationsOfState::Tabulated3D<true> eos{make_table(), 0.3};
+  test_interpolation(eos);
+  test_bounds(eos);
+  {
+    INFO("Serialization of tables that weren't read from a file");
+    const auto deserialized_eos = serialize_and_deserialize(eos);
+    test_interpolation(deserialized_eos);
+    test_bounds(deserialized_eos);
+  }
+  test_energy_flat_in_temperature();
+  test_stellar_collapse_file();
+}
@@ -175,6 +175,40 @@ SPECTRE_TEST_CASE("Unit.Time.History", "[Unit][Time]") {
   CHECK(copy.integration_order() == 2);
 }
 
+SPECTRE_TEST_CASE("Unit.Time.History.RingBuffer", "[Unit][Time]") {
+  HistoryType history{2};
+  history.insert(make_time_id(0.), get_output(0));
+  history.insert(make_time_id(1.), get_output(1));
+  for (size_t step = 2; step < 7; ++step) {
+    const std::string* const oldest_derivative = &history.begin().derivative();
+    history.mark_unneeded(history.begin() + 1);
+    history.insert(make_time_id(static_cast<double>(step)), get_output(step));
+    CHECK(history.size() == 2);
+    CHECK(history.capacity() == 2);
+    // The storage of the unneeded entry is reused for the new one
+    CHECK(&(history.end() - 1).derivative() == oldest_derivative);
+    CHECK(history.front() == make_time(static_cast<double>(step) - 1.0));
+    CHECK(history.back() == make_time(static_cast<double>(step)));
+    CHECK(history.begin().derivative() == get_output(step - 1));
+    CHECK((history.begin() + 1).derivative() == get_output(step));
+  }
+
+  // Entries can be added at both ends after the ring buffer has wrapped
+  history.insert(make_time_id(7.), get_output(7));
+  history.insert_initial(make_time_id(4.), get_output(4));
+  const auto check_entries = [](const HistoryType& hist) noexcept {
+    CHECK(hist.size() == 4);
+    auto it = hist.begin();
+    for (size_t i = 0; i < hist.size(); ++i, ++it) {
+      CHECK(it.time_step_id() == make_time_id(static_cast<double>(i) + 4.0));
+      CHECK(it.derivative() == get_output(i + 4));
+    }
+    CHECK(it == hist.end());
+  };
+  check_entries(history);
+  check_entries(serialize_and_deserialize(history));
+}
+
 namespace {
 using BoundaryHistoryType =
     TimeSteppers::BoundaryHistory<std::string, std::vector<int>, double>;
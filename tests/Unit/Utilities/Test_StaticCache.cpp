@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -198,6 +200,61 @@ SPECTRE_TEST_CASE("Unit.Utilities.StaticCache", "[Utilities][Unit]") {
   }
 }
 
+SPECTRE_TEST_CASE("Unit.Utilities.KeyedStaticCache", "[Utilities][Unit]") {
+  // [keyed_static_cache]
+  static const KeyedStaticCache<std::pair<std::string, size_t>, std::string>
+      cache{};
+  const auto repeat = [](const std::string& word, const size_t count) noexcept {
+    std::string result{};
+    for (size_t i = 0; i < count; ++i) {
+      result += word;
+    }
+    return result;
+  };
+  const std::string& cached_result = cache(
+      std::make_pair(std::string{"ab"}, 2_st),
+      [&repeat]() noexcept { return repeat("ab", 2); });
+  CHECK(cached_result == "abab");
+  // [keyed_static_cache]
+
+  size_t calls = 0;
+  const KeyedStaticCache<size_t, size_t> counting_cache{};
+  const auto square = [&calls](const size_t x) noexcept {
+    return [&calls, x]() noexcept {
+      ++calls;
+      return x * x;
+    };
+  };
+  CHECK(calls == 0);
+  const size_t& three_squared = counting_cache(3, square(3));
+  CHECK(three_squared == 9);
+  CHECK(calls == 1);
+  CHECK(counting_cache(4, square(4)) == 16);
+  CHECK(calls == 2);
+  // Cached objects are neither regenerated nor moved
+  CHECK(&counting_cache(3, square(3)) == &three_squared);
+  CHECK(counting_cache(4, square(4)) == 16);
+  CHECK(calls == 2);
+
+  // Concurrent lookups of a new key all share one object
+  const KeyedStaticCache<size_t, std::vector<size_t>> shared_cache{};
+  std::vector<const std::vector<size_t>*> concurrent_results(4);
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < concurrent_results.size(); ++i) {
+    threads.emplace_back([&concurrent_results, &shared_cache, i]() noexcept {
+      concurrent_results[i] = &shared_cache(
+          5, []() noexcept { return std::vector<size_t>(5, 5); });
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto* concurrent_result : concurrent_results) {
+    CHECK(concurrent_result == concurrent_results.front());
+  }
+  CHECK(*concurrent_results.front() == std::vector<size_t>(5, 5));
+}
+
 // [[OutputRegex, Index out of range: 3 <= 2 < 5]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.Utilities.StaticCache.out_of_range.low",
                                "[Utilities][Unit]") {